@@ -23,16 +23,26 @@
 ****************************************************************************/
 
 #include "2d/renderer/Batcher2d.h"
+#include <algorithm>
+#include <cstring>
 #include "application/ApplicationManager.h"
 #include "base/TypeDef.h"
+#include "base/job-system/JobChunks.h"
 #include "core/Root.h"
 #include "core/scene-graph/Scene.h"
 #include "editor-support/MiddlewareManager.h"
+#include "math/Mat4.h"
+#include "math/Vec4.h"
+#include "profiler/Profiler.h"
 #include "renderer/pipeline/Define.h"
 #include "scene/Pass.h"
 
 namespace cc {
 
+namespace {
+constexpr uint32_t PARALLEL_FILL_MIN_VERTICES_PER_CHUNK = 4096;
+} // namespace
+
 Batcher2d::Batcher2d() : Batcher2d(nullptr) {
 }
 
@@ -56,6 +66,11 @@ Batcher2d::~Batcher2d() { // NOLINT
     for (auto* drawBatch : _batches) {
         delete drawBatch;
     }
+    for (auto& iter : _retainedRoots) {
+        for (auto& retainedBatch : iter.second.batches) {
+            delete retainedBatch.batch;
+        }
+    }
     _attributes.clear();
 
     if (_maskClearModel != nullptr) {
@@ -71,6 +86,8 @@ Batcher2d::~Batcher2d() { // NOLINT
 }
 
 void Batcher2d::syncMeshBuffersToNative(uint16_t accId, ccstd::vector<UIMeshBuffer*>&& buffers) {
+    // retained roots may refer to the replaced buffers
+    releaseRetainedRoots();
     _meshBuffersMap[accId] = std::move(buffers);
 }
 
@@ -91,22 +108,395 @@ void Batcher2d::updateDescriptorSet() {
 
 void Batcher2d::syncRootNodesToNative(ccstd::vector<Node*>&& rootNodes) {
     _rootNodeArr = std::move(rootNodes);
+
+    for (auto iter = _retainedRoots.begin(); iter != _retainedRoots.end();) {
+        if (std::find(_rootNodeArr.begin(), _rootNodeArr.end(), iter->first) == _rootNodeArr.end()) {
+            releaseRetainedRoot(iter->second);
+            iter = _retainedRoots.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void Batcher2d::setRetainedMode(bool enabled) {
+    if (!enabled) {
+        releaseRetainedRoots();
+        _retainedRoots.clear();
+    }
+    _retainedMode = enabled;
 }
 
 void Batcher2d::fillBuffersAndMergeBatches() {
+    _retainedEntityCount = 0;
+    _rebuiltEntityCount = 0;
+    _retainedBatchCount = 0;
+
     size_t index = 0;
     for (auto* rootNode : _rootNodeArr) {
-        // _batches will add by generateBatch
-        walk(rootNode, 1);
-        generateBatch(_currEntity, _currDrawInfo);
-
         auto* scene = rootNode->getScene()->getRenderScene();
+        // batching never continues from the previous root, so that every root can be retained on its own
+        resetRenderStates();
+        _currHash = 0;
+
+        if (_retainedMode) {
+            auto& retained = _retainedRoots[rootNode];
+            if (!reuseRetainedRoot(rootNode, retained)) {
+                recordRetainedRoot(rootNode, retained);
+            }
+            for (const auto& retainedBatch : retained.batches) {
+                scene->addBatch(retainedBatch.batch);
+            }
+            _retainedBatchCount += static_cast<uint32_t>(retained.batches.size());
+        } else {
+            // _batches will add by generateBatch
+            walk(rootNode, 1);
+            generateBatch(_currEntity, _currDrawInfo);
+        }
+
         size_t const count = _batches.size();
         for (size_t i = index; i < count; i++) {
             scene->addBatch(_batches.at(i));
         }
         index = count;
     }
+
+    fillVertexData();
+
+    CC_PROFILE_OBJECT_UPDATE(UIRetainedEntities, _retainedEntityCount);
+    CC_PROFILE_OBJECT_UPDATE(UIRebuiltEntities, _rebuiltEntityCount);
+}
+
+void Batcher2d::planVertexFill(RenderEntity* entity, RenderDrawInfo* drawInfo, Node* node, uint32_t indexOffset, bool fillIndices) {
+    VertexFill fill{entity, drawInfo, nullptr, indexOffset, entity->getVBColorDirty(), fillIndices};
+    if (node->getChangedFlags() || drawInfo->getVertDirty()) {
+        // world matrices are updated lazily, resolve them before filling in parallel
+        fill.worldMatrix = &entity->getNode()->getWorldMatrix();
+    }
+    if (fill.worldMatrix || fill.fillColors || fill.fillIndices) {
+        _vertexFills.emplace_back(fill);
+    }
+}
+
+void Batcher2d::fillVertexData() {
+    const auto fillCount = static_cast<uint32_t>(_vertexFills.size());
+    if (fillCount == 0) {
+        return;
+    }
+    uint32_t vertexCount = 0;
+    for (const auto& fill : _vertexFills) {
+        vertexCount += fill.drawInfo->getVbCount();
+    }
+
+    const uint32_t maxChunks = getJobChunkCount(vertexCount, PARALLEL_FILL_MIN_VERTICES_PER_CHUNK);
+
+    // split by vertices rather than draw infos, a label has many more vertices than a sprite
+    const uint32_t verticesPerChunk = (vertexCount + maxChunks - 1) / maxChunks;
+    _vertexFillChunks.clear();
+    _vertexFillChunks.emplace_back(0);
+    uint32_t chunkVertices = 0;
+    for (uint32_t i = 0; i < fillCount - 1; ++i) {
+        chunkVertices += _vertexFills[i].drawInfo->getVbCount();
+        if (chunkVertices >= verticesPerChunk) {
+            _vertexFillChunks.emplace_back(i + 1);
+            chunkVertices = 0;
+        }
+    }
+    _vertexFillChunks.emplace_back(fillCount);
+    const auto chunkCount = static_cast<uint32_t>(_vertexFillChunks.size() - 1);
+
+    auto fillChunk = [this](uint32_t chunk) {
+        const uint32_t end = _vertexFillChunks[chunk + 1];
+        for (uint32_t i = _vertexFillChunks[chunk]; i < end; ++i) {
+            const auto& fill = _vertexFills[i];
+            if (fill.worldMatrix) {
+                fillVertexBuffers(fill);
+            }
+            if (fill.fillColors) {
+                fillColors(fill);
+            }
+            if (fill.fillIndices) {
+                fillIndexBuffers(fill);
+            }
+        }
+    };
+
+    runJobChunks(chunkCount, fillChunk);
+    _vertexFills.clear();
+
+    CC_PROFILE_OBJECT_UPDATE(UIVertexFillChunks, chunkCount);
+}
+
+void Batcher2d::fillVertexBuffers(const VertexFill& fill) {
+    // positions are transformed in blocks, so that the matrix kernel runs over many vertices at once
+    constexpr uint32_t BLOCK_SIZE = 64;
+    Vec4 block[BLOCK_SIZE];
+
+    const auto* drawInfo = fill.drawInfo;
+    const uint32_t stride = drawInfo->getStride();
+    const uint32_t vertexCount = drawInfo->getVbCount();
+    float* vbBuffer = drawInfo->getVbBuffer();
+    for (uint32_t first = 0; first < vertexCount; first += BLOCK_SIZE) {
+        const uint32_t count = std::min(BLOCK_SIZE, vertexCount - first);
+        for (uint32_t i = 0; i < count; ++i) {
+            const Vec3& position = drawInfo->getRender2dLayout((first + i) * stride)->position;
+            block[i].set(position.x, position.y, position.z, 1.0F);
+        }
+        fill.worldMatrix->transformVectors(block, block, count);
+        for (uint32_t i = 0; i < count; ++i) {
+            float* vertex = vbBuffer + (first + i) * stride;
+            const float rhw = math::isNotZeroF(block[i].w) ? 1.0F / block[i].w : 1.0F;
+            vertex[0] = block[i].x * rhw;
+            vertex[1] = block[i].y * rhw;
+            vertex[2] = block[i].z * rhw;
+        }
+    }
+}
+
+void Batcher2d::fillColors(const VertexFill& fill) {
+    const Color temp = fill.entity->getColor();
+    const float r = static_cast<float>(temp.r) / 255.0F;
+    const float g = static_cast<float>(temp.g) / 255.0F;
+    const float b = static_cast<float>(temp.b) / 255.0F;
+    const float opacity = fill.entity->getOpacity();
+
+    const auto* drawInfo = fill.drawInfo;
+    const uint32_t stride = drawInfo->getStride();
+    const uint32_t size = drawInfo->getVbCount() * stride;
+    float* vbBuffer = drawInfo->getVbBuffer();
+    for (uint32_t i = 0; i < size; i += stride) {
+        float* color = vbBuffer + i + 5;
+        color[0] = r;
+        color[1] = g;
+        color[2] = b;
+        color[3] = opacity;
+    }
+}
+
+void Batcher2d::fillIndexBuffers(const VertexFill& fill) {
+    const auto* drawInfo = fill.drawInfo;
+    memcpy(&drawInfo->getIDataBuffer()[fill.indexOffset], drawInfo->getIbBuffer(), drawInfo->getIbCount() * sizeof(uint16_t));
+}
+
+bool Batcher2d::reuseRetainedRoot(Node* rootNode, RetainedRoot& retained) {
+    if (!retained.retainable) {
+        return false;
+    }
+    // the index data of the root must not have been moved by the roots before it
+    for (const auto& meshBuffer : retained.meshBuffers) {
+        if (meshBuffer.buffer->getIndexOffset() != meshBuffer.indexStart) {
+            return false;
+        }
+    }
+
+    // dirty flags are only cleared once the whole root matched, a rebuild needs them
+    const size_t firstFill = _vertexFills.size();
+    _retainedEntityCursor = 0;
+    _retainedDrawInfoCursor = 0;
+    if (!walkRetained(rootNode, 1, retained) ||
+        _retainedEntityCursor != retained.entities.size() ||
+        _retainedDrawInfoCursor != retained.drawInfos.size()) {
+        _vertexFills.resize(firstFill);
+        return false;
+    }
+    for (size_t i = firstFill; i < _vertexFills.size(); ++i) {
+        _vertexFills[i].drawInfo->setVertDirty(false);
+    }
+    for (const auto& record : retained.entities) {
+        if (record.drawInfoCount > 0) {
+            record.entity->setVBColorDirty(false);
+        }
+    }
+
+    for (const auto& meshBuffer : retained.meshBuffers) {
+        meshBuffer.buffer->setIndexOffset(meshBuffer.indexEnd);
+        meshBuffer.buffer->setDirty(true);
+    }
+    for (const auto& retainedBatch : retained.batches) {
+        // what fillPass and generateBatch do besides building the batch
+        for (const auto& pass : *retainedBatch.material->getPasses()) {
+            pass->update();
+        }
+        const auto& pass = retainedBatch.batch->getPasses().at(0);
+        retainedBatch.batch->setDescriptorSet(getDescriptorSet(retainedBatch.texture, retainedBatch.sampler, pass->getLocalSetLayout()));
+    }
+    _retainedEntityCount += static_cast<uint32_t>(retained.entities.size());
+    return true;
+}
+
+bool Batcher2d::walkRetained(Node* node, float parentOpacity, RetainedRoot& retained) { // NOLINT(misc-no-recursion)
+    if (!node->isActiveInHierarchy()) {
+        return true;
+    }
+    bool breakWalk = false;
+    auto* entity = static_cast<RenderEntity*>(node->getUserData());
+    if (entity) {
+        if (_retainedEntityCursor == retained.entities.size() || retained.entities[_retainedEntityCursor].entity != entity) {
+            return false;
+        }
+        const auto& record = retained.entities[_retainedEntityCursor++];
+
+        if (entity->getColorDirty()) {
+            float localOpacity = entity->getLocalOpacity();
+            float localColorAlpha = entity->getColorAlpha();
+            entity->setOpacity(parentOpacity * localOpacity * localColorAlpha);
+            entity->setColorDirty(false);
+            entity->setVBColorDirty(true);
+        }
+        bool isDrawn = false;
+        if (math::isEqualF(entity->getOpacity(), 0)) {
+            breakWalk = true;
+        } else if (entity->isEnabled()) {
+            isDrawn = true;
+        }
+        const uint32_t drawInfoCount = isDrawn ? entity->getRenderDrawInfosSize() : 0;
+        if (drawInfoCount != record.drawInfoCount) {
+            return false;
+        }
+        for (uint32_t i = 0; i < drawInfoCount; i++) {
+            if (!refreshRetainedDrawInfo(entity, entity->getRenderDrawInfoAt(i), node, retained)) {
+                return false;
+            }
+        }
+        if (entity->getRenderEntityType() == RenderEntityType::CROSSED) {
+            breakWalk = true;
+        }
+    }
+
+    if (!breakWalk) {
+        const auto& children = node->getChildren();
+        float thisOpacity = entity ? entity->getOpacity() : parentOpacity;
+        for (const auto& child : children) {
+            if (!walkRetained(child, thisOpacity, retained)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool Batcher2d::refreshRetainedDrawInfo(RenderEntity* entity, RenderDrawInfo* drawInfo, Node* node, RetainedRoot& retained) { // NOLINT(misc-no-recursion)
+    const auto stage = _stencilManager->getStencilStage();
+    if (_retainedDrawInfoCursor == retained.drawInfos.size() ||
+        !isRetainedDrawInfoEqual(retained.drawInfos[_retainedDrawInfoCursor], entity, drawInfo, stage)) {
+        return false;
+    }
+    const auto& record = retained.drawInfos[_retainedDrawInfoCursor++];
+
+    if (record.type == RenderDrawInfoType::SUB_NODE) {
+        return walkRetained(record.subNode, entity->getOpacity(), retained);
+    }
+
+    entity->setEnumStencilStage(stage);
+    // indices may change with the same count, e.g. a sprite changing its type
+    planVertexFill(entity, drawInfo, node, record.indexOffset, drawInfo->getVertDirty());
+    return true;
+}
+
+bool Batcher2d::isRetainedDrawInfoEqual(const RetainedDrawInfo& record, RenderEntity* entity, RenderDrawInfo* drawInfo, StencilStage stage) {
+    if (record.drawInfo != drawInfo || record.type != drawInfo->getEnumDrawInfoType()) {
+        return false;
+    }
+    if (record.type == RenderDrawInfoType::SUB_NODE) {
+        return record.subNode == drawInfo->getSubNode();
+    }
+    return !drawInfo->getIsMeshBuffer() &&
+           !entity->getIsMask() &&
+           !entity->getUseLocal() &&
+           record.stencilStage == stage &&
+           record.layer == entity->getNode()->getLayer() &&
+           record.material == drawInfo->getMaterial() &&
+           record.materialHash == drawInfo->getMaterial()->getHash() &&
+           record.texture == drawInfo->getTexture() &&
+           record.sampler == drawInfo->getSampler() &&
+           record.meshBuffer == drawInfo->getMeshBuffer() &&
+           record.vbBuffer == drawInfo->getVbBuffer() &&
+           record.ibBuffer == drawInfo->getIbBuffer() &&
+           record.iDataBuffer == drawInfo->getIDataBuffer() &&
+           record.dataHash == drawInfo->getDataHash() &&
+           record.vbCount == drawInfo->getVbCount() &&
+           record.ibCount == drawInfo->getIbCount();
+}
+
+void Batcher2d::recordRetainedRoot(Node* rootNode, RetainedRoot& retained) {
+    releaseRetainedRoot(retained);
+    retained.retainable = true;
+
+    const size_t firstBatch = _batches.size();
+    _recordingRoot = &retained;
+    walk(rootNode, 1);
+    generateBatch(_currEntity, _currDrawInfo);
+    _recordingRoot = nullptr;
+
+    if (!retained.retainable || retained.batches.size() != _batches.size() - firstBatch) {
+        // batches stay in _batches and are recycled at the end of the frame
+        retained.batches.clear();
+        releaseRetainedRoot(retained);
+        return;
+    }
+    for (auto& meshBuffer : retained.meshBuffers) {
+        meshBuffer.indexEnd = meshBuffer.buffer->getIndexOffset();
+    }
+    _batches.resize(firstBatch);
+}
+
+void Batcher2d::recordRetainedDrawInfo(RenderEntity* entity, RenderDrawInfo* drawInfo) {
+    auto& retained = *_recordingRoot;
+    RetainedDrawInfo record;
+    record.drawInfo = drawInfo;
+    record.type = drawInfo->getEnumDrawInfoType();
+    if (record.type == RenderDrawInfoType::SUB_NODE) {
+        record.subNode = drawInfo->getSubNode();
+        retained.drawInfos.emplace_back(record);
+        return;
+    }
+    if (record.type != RenderDrawInfoType::COMP || drawInfo->getIsMeshBuffer() || !drawInfo->getMaterial() ||
+        entity->getIsMask() || entity->getUseLocal()) {
+        // stop recording, the rest of the root is batched as usual
+        retained.retainable = false;
+        _recordingRoot = nullptr;
+        return;
+    }
+    record.stencilStage = _stencilManager->getStencilStage();
+    record.layer = entity->getNode()->getLayer();
+    record.material = drawInfo->getMaterial();
+    record.materialHash = drawInfo->getMaterial()->getHash();
+    record.texture = drawInfo->getTexture();
+    record.sampler = drawInfo->getSampler();
+    record.meshBuffer = drawInfo->getMeshBuffer();
+    record.vbBuffer = drawInfo->getVbBuffer();
+    record.ibBuffer = drawInfo->getIbBuffer();
+    record.iDataBuffer = drawInfo->getIDataBuffer();
+    record.dataHash = drawInfo->getDataHash();
+    record.vbCount = drawInfo->getVbCount();
+    record.ibCount = drawInfo->getIbCount();
+    record.indexOffset = record.meshBuffer->getIndexOffset();
+    retained.drawInfos.emplace_back(record);
+
+    auto iter = std::find_if(retained.meshBuffers.begin(), retained.meshBuffers.end(), [&](const RetainedMeshBuffer& meshBuffer) {
+        return meshBuffer.buffer == record.meshBuffer;
+    });
+    if (iter == retained.meshBuffers.end()) {
+        retained.meshBuffers.emplace_back(RetainedMeshBuffer{record.meshBuffer, record.indexOffset, record.indexOffset});
+    }
+}
+
+void Batcher2d::releaseRetainedRoot(RetainedRoot& retained) {
+    for (auto& retainedBatch : retained.batches) {
+        retainedBatch.batch->clear();
+        _drawBatchPool.free(retainedBatch.batch);
+    }
+    retained.retainable = false;
+    retained.entities.clear();
+    retained.drawInfos.clear();
+    retained.meshBuffers.clear();
+    retained.batches.clear();
+}
+
+void Batcher2d::releaseRetainedRoots() {
+    for (auto& iter : _retainedRoots) {
+        releaseRetainedRoot(iter.second);
+    }
 }
 
 void Batcher2d::walk(Node* node, float parentOpacity) { // NOLINT(misc-no-recursion)
@@ -116,6 +506,7 @@ void Batcher2d::walk(Node* node, float parentOpacity) { // NOLINT(misc-no-recurs
     bool breakWalk = false;
     auto* entity = static_cast<RenderEntity*>(node->getUserData());
     if (entity) {
+        ++_rebuiltEntityCount;
         if (entity->getColorDirty()) {
             float localOpacity = entity->getLocalOpacity();
             float localColorAlpha = entity->getColorAlpha();
@@ -125,13 +516,21 @@ void Batcher2d::walk(Node* node, float parentOpacity) { // NOLINT(misc-no-recurs
         }
         if (math::isEqualF(entity->getOpacity(), 0)) {
             breakWalk = true;
+            if (_recordingRoot) {
+                _recordingRoot->entities.emplace_back(RetainedEntity{entity, 0});
+            }
         } else if (entity->isEnabled()) {
             uint32_t size = entity->getRenderDrawInfosSize();
+            if (_recordingRoot) {
+                _recordingRoot->entities.emplace_back(RetainedEntity{entity, size});
+            }
             for (uint32_t i = 0; i < size; i++) {
                 auto* drawInfo = entity->getRenderDrawInfoAt(i);
                 handleDrawInfo(entity, drawInfo, node);
             }
             entity->setVBColorDirty(false);
+        } else if (_recordingRoot) {
+            _recordingRoot->entities.emplace_back(RetainedEntity{entity, 0});
         }
         if (entity->getRenderEntityType() == RenderEntityType::CROSSED) {
             breakWalk = true;
@@ -206,15 +605,13 @@ CC_FORCE_INLINE void Batcher2d::handleComponentDraw(RenderEntity* entity, Render
     }
 
     if (!drawInfo->getIsMeshBuffer()) {
-        if (node->getChangedFlags() || drawInfo->getVertDirty()) {
-            fillVertexBuffers(entity, drawInfo);
-            drawInfo->setVertDirty(false);
-        }
-        if (entity->getVBColorDirty()) {
-            fillColors(entity, drawInfo);
-        }
+        // reserve the index range now, the data is filled after the walk
+        UIMeshBuffer* buffer = drawInfo->getMeshBuffer();
+        const uint32_t indexOffset = buffer->getIndexOffset();
+        buffer->setIndexOffset(indexOffset + drawInfo->getIbCount());
 
-        fillIndexBuffers(drawInfo);
+        planVertexFill(entity, drawInfo, node, indexOffset, true);
+        drawInfo->setVertDirty(false);
     }
 
     if (isMask) {
@@ -302,6 +699,10 @@ CC_FORCE_INLINE void Batcher2d::handleDrawInfo(RenderEntity* entity, RenderDrawI
     CC_ASSERT(drawInfo);
     RenderDrawInfoType drawInfoType = drawInfo->getEnumDrawInfoType();
 
+    if (_recordingRoot) {
+        recordRetainedDrawInfo(entity, drawInfo);
+    }
+
     switch (drawInfoType) {
         case RenderDrawInfoType::COMP:
             handleComponentDraw(entity, drawInfo, node);
@@ -379,6 +780,9 @@ void Batcher2d::generateBatch(RenderEntity* entity, RenderDrawInfo* drawInfo) {
         curdrawBatch->setDescriptorSet(getDescriptorSet(_currTexture, _currSampler, pass->getLocalSetLayout()));
     }
     _batches.push_back(curdrawBatch);
+    if (_recordingRoot) {
+        _recordingRoot->batches.emplace_back(RetainedBatch{curdrawBatch, _currMaterial, _currTexture, _currSampler});
+    }
 }
 
 void Batcher2d::generateBatchForMiddleware(RenderEntity* entity, RenderDrawInfo* drawInfo) {
@@ -476,6 +880,8 @@ void Batcher2d::releaseDescriptorSetCache(gfx::Texture* texture, gfx::Sampler* s
     }
     auto iter = _descriptorSetCache.find(hash);
     if (iter != _descriptorSetCache.end()) {
+        // the texture may be destroyed, and another one created at the same address
+        releaseRetainedRoots();
         delete iter->second;
         _descriptorSetCache.erase(hash);
     }
@@ -492,7 +898,7 @@ void Batcher2d::update() {
 }
 
 void Batcher2d::uploadBuffers() {
-    if (_batches.empty()) {
+    if (_batches.empty() && _retainedBatchCount == 0) {
         return;
     }
 
@@ -500,12 +906,14 @@ void Batcher2d::uploadBuffers() {
         meshRenderData->uploadBuffers();
     }
 
+    uint32_t uploadedBytes = 0;
     for (auto& map : _meshBuffersMap) {
         for (auto& buffer : map.second) {
-            buffer->uploadBuffers();
+            uploadedBytes += buffer->uploadBuffers();
             buffer->reset();
         }
     }
+    CC_PROFILE_OBJECT_UPDATE(UIUploadBytes, uploadedBytes);
     updateDescriptorSet();
 }
 
@@ -74,38 +74,82 @@ public:
     void generateBatchForMiddleware(RenderEntity* entity, RenderDrawInfo* drawInfo);
     void resetRenderStates();
 
+    /**
+     * @en
+     * Retained mode: a root node whose entities, draw infos and batching states are the same as
+     * in the previous frame reuses its batches and index data, only the vertices and colors of
+     * changed entities are filled again. Roots containing masks, models, middleware, mesh buffer
+     * draw infos or local transforms are always rebuilt.
+     * @zh
+     * 保留模式：若根节点的实体、绘制信息和合批状态与上一帧相同，则复用其合批和索引数据，只重新填充有变化的实体的顶点和颜色。
+     * 包含遮罩、模型、中间件、独立网格缓冲或局部变换的根节点每帧重建。
+     */
+    void setRetainedMode(bool enabled);
+    inline bool isRetainedMode() const { return _retainedMode; }
+    // entities of the last frame whose batches were reused
+    inline uint32_t getRetainedEntityCount() const { return _retainedEntityCount; }
+    // entities of the last frame that were batched again
+    inline uint32_t getRebuiltEntityCount() const { return _rebuiltEntityCount; }
+
 private:
-    bool _isInit = false;
+    struct RetainedEntity {
+        RenderEntity* entity{nullptr};
+        uint32_t drawInfoCount{0};
+    };
 
-    inline void fillIndexBuffers(RenderDrawInfo* drawInfo) { // NOLINT(readability-convert-member-functions-to-static)
-        uint16_t* ib = drawInfo->getIDataBuffer();
+    // states of a draw info that batching depends on
+    struct RetainedDrawInfo {
+        RenderDrawInfo* drawInfo{nullptr};
+        RenderDrawInfoType type{RenderDrawInfoType::COMP};
+        StencilStage stencilStage{StencilStage::DISABLED};
+        uint32_t layer{0};
+        Node* subNode{nullptr};
+        Material* material{nullptr};
+        ccstd::hash_t materialHash{0};
+        gfx::Texture* texture{nullptr};
+        gfx::Sampler* sampler{nullptr};
+        UIMeshBuffer* meshBuffer{nullptr};
+        float* vbBuffer{nullptr};
+        uint16_t* ibBuffer{nullptr};
+        uint16_t* iDataBuffer{nullptr};
+        ccstd::hash_t dataHash{0};
+        uint32_t vbCount{0};
+        uint32_t ibCount{0};
+        uint32_t indexOffset{0};
+    };
 
-        UIMeshBuffer* buffer = drawInfo->getMeshBuffer();
-        uint32_t indexOffset = buffer->getIndexOffset();
+    struct RetainedMeshBuffer {
+        UIMeshBuffer* buffer{nullptr};
+        uint32_t indexStart{0};
+        uint32_t indexEnd{0};
+    };
 
-        uint16_t* indexb = drawInfo->getIbBuffer();
-        uint32_t indexCount = drawInfo->getIbCount();
+    struct RetainedBatch {
+        scene::DrawBatch2D* batch{nullptr};
+        Material* material{nullptr};
+        gfx::Texture* texture{nullptr};
+        gfx::Sampler* sampler{nullptr};
+    };
 
-        memcpy(&ib[indexOffset], indexb, indexCount * sizeof(uint16_t));
-        indexOffset += indexCount;
+    struct RetainedRoot {
+        bool retainable{false};
+        ccstd::vector<RetainedEntity> entities;
+        ccstd::vector<RetainedDrawInfo> drawInfos;
+        ccstd::vector<RetainedMeshBuffer> meshBuffers;
+        // owned by the root until it is rebuilt or released
+        ccstd::vector<RetainedBatch> batches;
+    };
 
-        buffer->setIndexOffset(indexOffset);
-    }
+    bool reuseRetainedRoot(Node* rootNode, RetainedRoot& retained);
+    bool walkRetained(Node* node, float parentOpacity, RetainedRoot& retained);
+    bool refreshRetainedDrawInfo(RenderEntity* entity, RenderDrawInfo* drawInfo, Node* node, RetainedRoot& retained);
+    void recordRetainedRoot(Node* rootNode, RetainedRoot& retained);
+    void recordRetainedDrawInfo(RenderEntity* entity, RenderDrawInfo* drawInfo);
+    void releaseRetainedRoot(RetainedRoot& retained);
+    void releaseRetainedRoots();
+    static bool isRetainedDrawInfoEqual(const RetainedDrawInfo& record, RenderEntity* entity, RenderDrawInfo* drawInfo, StencilStage stage);
 
-    inline void fillVertexBuffers(RenderEntity* entity, RenderDrawInfo* drawInfo) { // NOLINT(readability-convert-member-functions-to-static)
-        Node* node = entity->getNode();
-        const Mat4& matrix = node->getWorldMatrix();
-        uint8_t stride = drawInfo->getStride();
-        uint32_t size = drawInfo->getVbCount() * stride;
-        float* vbBuffer = drawInfo->getVbBuffer();
-        for (int i = 0; i < size; i += stride) {
-            Render2dLayout* curLayout = drawInfo->getRender2dLayout(i);
-            // make sure that the layout of Vec3 is three consecutive floats
-            static_assert(sizeof(Vec3) == 3 * sizeof(float));
-            // cast to reduce value copy instructions
-            reinterpret_cast<Vec3*>(vbBuffer + i)->transformMat4(curLayout->position, matrix);
-        }
-    }
+    bool _isInit = false;
 
     inline void setIndexRange(RenderDrawInfo* drawInfo) { // NOLINT(readability-convert-member-functions-to-static)
         UIMeshBuffer* buffer = drawInfo->getMeshBuffer();
@@ -117,22 +161,24 @@ private:
         }
     }
 
-    inline void fillColors(RenderEntity* entity, RenderDrawInfo* drawInfo) { // NOLINT(readability-convert-member-functions-to-static)
-        Color temp = entity->getColor();
-
-        uint8_t stride = drawInfo->getStride();
-        uint32_t size = drawInfo->getVbCount() * stride;
-        float* vbBuffer = drawInfo->getVbBuffer();
+    // Vertex data of a draw info, planned during the walk and filled after it.
+    struct VertexFill {
+        // weak reference
+        RenderEntity* entity{nullptr};
+        // weak reference
+        RenderDrawInfo* drawInfo{nullptr};
+        // null when the vertices are unchanged
+        const Mat4* worldMatrix{nullptr};
+        uint32_t indexOffset{0};
+        bool fillColors{false};
+        bool fillIndices{false};
+    };
 
-        uint32_t offset = 0;
-        for (int i = 0; i < size; i += stride) {
-            offset = i + 5;
-            vbBuffer[offset++] = static_cast<float>(temp.r) / 255.0F;
-            vbBuffer[offset++] = static_cast<float>(temp.g) / 255.0F;
-            vbBuffer[offset++] = static_cast<float>(temp.b) / 255.0F;
-            vbBuffer[offset++] = entity->getOpacity();
-        }
-    }
+    void planVertexFill(RenderEntity* entity, RenderDrawInfo* drawInfo, Node* node, uint32_t indexOffset, bool fillIndices);
+    void fillVertexData();
+    static void fillVertexBuffers(const VertexFill& fill);
+    static void fillColors(const VertexFill& fill);
+    static void fillIndexBuffers(const VertexFill& fill);
 
     void insertMaskBatch(RenderEntity* entity);
     void createClearModel();
@@ -197,6 +243,21 @@ private:
     };
     gfx::PrimitiveMode _primitiveMode{gfx::PrimitiveMode::TRIANGLE_LIST};
 
+    // Retained mode
+    bool _retainedMode{true};
+    ccstd::unordered_map<Node*, RetainedRoot> _retainedRoots;
+    // weak reference, the root being recorded by walk
+    RetainedRoot* _recordingRoot{nullptr};
+    uint32_t _retainedEntityCursor{0};
+    uint32_t _retainedDrawInfoCursor{0};
+    uint32_t _retainedEntityCount{0};
+    uint32_t _rebuiltEntityCount{0};
+    uint32_t _retainedBatchCount{0};
+
+    ccstd::vector<VertexFill> _vertexFills;
+    // first fill of every parallel chunk, followed by the fill count
+    ccstd::vector<uint32_t> _vertexFillChunks;
+
     CC_DISALLOW_COPY_MOVE_ASSIGN(Batcher2d);
 };
 } // namespace cc
@@ -23,10 +23,21 @@
 ****************************************************************************/
 
 #include "2d/renderer/UIMeshBuffer.h"
+#include <algorithm>
+#include <cstring>
 #include "renderer/gfx-base/GFXDevice.h"
 
 namespace cc {
 
+namespace {
+// granularity of the comparison against the last uploaded content
+constexpr uint32_t UPLOAD_BLOCK_BYTES = 256;
+// dirty blocks closer than this are sent in one range, a few clean bytes are cheaper than another call
+constexpr uint32_t UPLOAD_MERGE_GAP_BYTES = 4096;
+// beyond this many ranges a single span covering them all is uploaded instead
+constexpr uint32_t MAX_UPLOAD_RANGES = 16;
+} // namespace
+
 static uint32_t getAttributesStride(ccstd::vector<gfx::Attribute>& attrs) {
     uint32_t stride = 0;
     for (auto& attr : attrs) {
@@ -70,6 +81,8 @@ void UIMeshBuffer::destroy() {
     _attributes.clear();
     _vb = nullptr;
     _ib = nullptr;
+    _vShadow = {};
+    _iShadow = {};
     if (_needDeleteVData) {
         delete _vData;
         delete _iData;
@@ -91,31 +104,84 @@ gfx::InputAssembler* UIMeshBuffer::requireFreeIA(gfx::Device* device) {
     return createNewIA(device);
 }
 
-void UIMeshBuffer::uploadBuffers() {
+uint32_t UIMeshBuffer::uploadBuffers() {
+    if (_meshBufferLayout == nullptr) {
+        return 0;
+    }
     uint32_t byteOffset = getByteOffset();
     bool dirty = getDirty();
-    if (_meshBufferLayout == nullptr || byteOffset == 0 || !dirty || !_ia) {
-        return;
+    if (byteOffset == 0 || !dirty || !_ia) {
+        return 0;
     }
 
     uint32_t indexCount = getIndexOffset();
     uint32_t byteCount = getByteOffset();
+    uint32_t uploadedBytes = 0;
 
-    gfx::BufferList vBuffers = _ia->getVertexBuffers();
+    const gfx::BufferList& vBuffers = _ia->getVertexBuffers();
     if (!vBuffers.empty()) {
-        gfx::Buffer* vBuffer = vBuffers[0];
-        if (byteCount > vBuffer->getSize()) {
-            vBuffer->resize(byteCount);
+        uploadedBytes += uploadDirtyRanges(vBuffers[0], reinterpret_cast<const uint8_t*>(_vData), byteCount, _vShadow);
+    }
+    uploadedBytes += uploadDirtyRanges(_ia->getIndexBuffer(), reinterpret_cast<const uint8_t*>(_iData), indexCount * sizeof(uint16_t), _iShadow);
+
+    setDirty(false);
+    return uploadedBytes;
+}
+
+uint32_t UIMeshBuffer::uploadDirtyRanges(gfx::Buffer* gpuBuffer, const uint8_t* data, uint32_t byteCount, UploadShadow& shadow) {
+    if (byteCount == 0) {
+        return 0;
+    }
+    if (byteCount > gpuBuffer->getSize()) {
+        // grow geometrically so that a slowly growing ui doesn't reallocate every frame
+        gpuBuffer->resize(std::max(byteCount, gpuBuffer->getSize() * 2));
+        shadow.validBytes = 0;
+    }
+    if (shadow.data.size() < byteCount) {
+        shadow.data.resize(gpuBuffer->getSize());
+    }
+
+    // js assemblers and middleware write the shared buffers directly, so the changes are found by
+    // comparing against what the gpu already holds instead of trusting the writers to report them
+    _uploadRanges.clear();
+    auto markDirty = [&](uint32_t begin, uint32_t end) {
+        if (!_uploadRanges.empty() && begin <= _uploadRanges.back().end + UPLOAD_MERGE_GAP_BYTES) {
+            _uploadRanges.back().end = end;
+        } else {
+            _uploadRanges.push_back({begin, end});
+        }
+    };
+
+    uint8_t* shadowData = shadow.data.data();
+    const uint32_t compareBytes = std::min(byteCount, shadow.validBytes);
+    for (uint32_t begin = 0; begin < compareBytes; begin += UPLOAD_BLOCK_BYTES) {
+        const uint32_t end = std::min(begin + UPLOAD_BLOCK_BYTES, compareBytes);
+        if (memcmp(shadowData + begin, data + begin, end - begin) != 0) {
+            memcpy(shadowData + begin, data + begin, end - begin);
+            markDirty(begin, end);
         }
-        vBuffer->update(_vData);
     }
-    gfx::Buffer* iBuffer = _ia->getIndexBuffer();
-    if (indexCount * 2 > iBuffer->getSize()) {
-        iBuffer->resize(indexCount * 2);
+    if (compareBytes < byteCount) {
+        memcpy(shadowData + compareBytes, data + compareBytes, byteCount - compareBytes);
+        markDirty(compareBytes, byteCount);
     }
-    iBuffer->update(_iData);
+    shadow.validBytes = std::max(shadow.validBytes, byteCount);
 
-    setDirty(false);
+    if (_uploadRanges.empty()) {
+        return 0;
+    }
+    if (_uploadRanges.size() > MAX_UPLOAD_RANGES) {
+        const uint32_t begin = _uploadRanges.front().begin;
+        const uint32_t end = _uploadRanges.back().end;
+        gpuBuffer->update(data + begin, begin, end - begin);
+        return end - begin;
+    }
+    uint32_t uploadedBytes = 0;
+    for (const auto& range : _uploadRanges) {
+        gpuBuffer->update(data + range.begin, range.begin, range.end - range.begin);
+        uploadedBytes += range.end - range.begin;
+    }
+    return uploadedBytes;
 }
 
 // use less
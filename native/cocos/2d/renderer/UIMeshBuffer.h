@@ -29,6 +29,7 @@
 #include "renderer/gfx-base/GFXInputAssembler.h"
 #include "renderer/gfx-base/GFXDef-common.h"
 #include "renderer/gfx-base/GFXBuffer.h"
+#include "base/std/container/vector.h"
 
 namespace cc {
 
@@ -53,7 +54,8 @@ public:
     void reset();
     void destroy();
     void setDirty();
-    void uploadBuffers();
+    // returns the number of bytes sent to the gpu buffers
+    uint32_t uploadBuffers();
     void syncSharedBufferToNative(uint32_t* buffer);
     void resetIA();
     void recycleIA(gfx::InputAssembler* ia);
@@ -78,6 +80,19 @@ protected:
     CC_DISALLOW_COPY_MOVE_ASSIGN(UIMeshBuffer);
 
 private:
+    // copy of the bytes last sent to a gpu buffer, the first validBytes match the gpu content
+    struct UploadShadow {
+        ccstd::vector<uint8_t> data;
+        uint32_t validBytes{0};
+    };
+
+    struct UploadRange {
+        uint32_t begin{0};
+        uint32_t end{0};
+    };
+
+    uint32_t uploadDirtyRanges(gfx::Buffer* gpuBuffer, const uint8_t* data, uint32_t byteCount, UploadShadow& shadow);
+
     float* _vData{nullptr};
     uint16_t* _iData{nullptr};
 
@@ -93,6 +108,10 @@ private:
     IntrusivePtr<gfx::Buffer> _vb;
     IntrusivePtr<gfx::Buffer> _ib;
 
+    UploadShadow _vShadow;
+    UploadShadow _iShadow;
+    ccstd::vector<UploadRange> _uploadRanges;
+
     bool _dirty{false};
     bool _needDeleteVData{false};
     bool _needDeleteLayout{false};
@@ -23,14 +23,20 @@
 ****************************************************************************/
 
 #include "3d/assets/Mesh.h"
+#include <algorithm>
+#include <cstring>
 #include "3d/assets/Morph.h"
 #include "3d/assets/Skeleton.h"
 #include "3d/misc/BufferBlob.h"
+#include "base/Utils.h"
+#include "base/job-system/JobChunks.h"
 #include "base/std/hash/hash.h"
 #include "core/DataView.h"
 #include "core/assets/RenderingSubMesh.h"
 #include "core/platform/Debug.h"
+#include "math/Mat4.h"
 #include "math/Quaternion.h"
+#include "math/Vec4.h"
 #include "renderer/gfx-base/GFXDevice.h"
 #include "core/Root.h"
 #include "renderer/pipeline/PipelineSceneData.h"
@@ -235,6 +241,169 @@ void convertRG32FToRG16F(const float *src, uint16_t *dst) {
 
 #endif // #if CC_OPTIMIZE_MESH_DATA
 
+// Vertices are gathered into blocks of this size and transformed by the batched Mat4 kernel.
+constexpr uint32_t VERTEX_TRANSFORM_BLOCK_SIZE = 64;
+constexpr uint32_t PARALLEL_MERGE_MIN_VERTICES = 16384;
+
+struct Float32Component {
+    static constexpr uint32_t SIZE = 4;
+    static inline float load(const uint8_t *src) {
+        float value;
+        memcpy(&value, src, SIZE);
+        return value;
+    }
+    static inline void store(uint8_t *dst, float value) {
+        memcpy(dst, &value, SIZE);
+    }
+};
+
+struct Float16Component {
+    static constexpr uint32_t SIZE = 2;
+    static inline float load(const uint8_t *src) {
+        uint16_t raw;
+        memcpy(&raw, src, SIZE);
+        return utils::halfToFloat(utils::rawUint16ToHalf(raw));
+    }
+    static inline void store(uint8_t *dst, float value) {
+        const uint16_t raw = utils::rawHalfAsUint16(utils::floatToHalf(value));
+        memcpy(dst, &raw, SIZE);
+    }
+};
+
+// Transform the xyz components of count vertices from src to dst, which may alias.
+// Positions are transformed as points with the perspective divide of Vec3::transformMat4, normals as directions.
+template <typename Component, bool IS_POSITION>
+void transformVertices(const uint8_t *src, uint32_t srcStride, uint8_t *dst, uint32_t dstStride, uint32_t count, const Mat4 &matrix) {
+    Vec4 input[VERTEX_TRANSFORM_BLOCK_SIZE];
+    Vec4 output[VERTEX_TRANSFORM_BLOCK_SIZE];
+    for (uint32_t first = 0; first < count; first += VERTEX_TRANSFORM_BLOCK_SIZE) {
+        const uint32_t blockSize = std::min(VERTEX_TRANSFORM_BLOCK_SIZE, count - first);
+        const uint8_t *vertex = src + static_cast<size_t>(first) * srcStride;
+        for (uint32_t i = 0; i < blockSize; ++i, vertex += srcStride) {
+            input[i].set(Component::load(vertex),
+                         Component::load(vertex + Component::SIZE),
+                         Component::load(vertex + Component::SIZE * 2),
+                         IS_POSITION ? 1.F : 0.F);
+        }
+        matrix.transformVectors(input, output, blockSize);
+        uint8_t *out = dst + static_cast<size_t>(first) * dstStride;
+        for (uint32_t i = 0; i < blockSize; ++i, out += dstStride) {
+            float rhw = 1.F;
+            if (IS_POSITION && math::isNotZeroF(output[i].w)) {
+                rhw = 1.F / output[i].w;
+            }
+            Component::store(out, output[i].x * rhw);
+            Component::store(out + Component::SIZE, output[i].y * rhw);
+            Component::store(out + Component::SIZE * 2, output[i].z * rhw);
+        }
+    }
+}
+
+// Vec3::transformQuat is linear, build its matrix so that normals go through the batched kernel as well.
+Mat4 getNormalMatrix(const Quaternion &rotation) {
+    Mat4 matrix;
+    const Vec3 axes[3] = {Vec3::UNIT_X, Vec3::UNIT_Y, Vec3::UNIT_Z};
+    for (uint32_t i = 0; i < 3; ++i) {
+        Vec3 axis = axes[i];
+        axis.transformQuat(rotation);
+        matrix.m[i * 4 + 0] = axis.x;
+        matrix.m[i * 4 + 1] = axis.y;
+        matrix.m[i * 4 + 2] = axis.z;
+    }
+    return matrix;
+}
+
+using VertexTransformFunc = void (*)(const uint8_t *, uint32_t, uint8_t *, uint32_t, uint32_t, const Mat4 &);
+
+// Select the transform specialized for the attribute format, nullptr if the attribute is not transformed.
+VertexTransformFunc getVertexTransform(const gfx::Attribute &attribute) {
+    const bool isPosition = attribute.name == gfx::ATTR_NAME_POSITION;
+    if (!isPosition && attribute.name != gfx::ATTR_NAME_NORMAL) {
+        return nullptr;
+    }
+    const auto &info = gfx::GFX_FORMAT_INFOS[static_cast<uint32_t>(attribute.format)];
+    if (info.type != gfx::FormatType::FLOAT || info.count < 3) {
+        return nullptr;
+    }
+    switch (info.size / info.count) {
+        case Float32Component::SIZE:
+            return isPosition ? &transformVertices<Float32Component, true> : &transformVertices<Float32Component, false>;
+        case Float16Component::SIZE:
+            return isPosition ? &transformVertices<Float16Component, true> : &transformVertices<Float16Component, false>;
+        default:
+            return nullptr;
+    }
+}
+
+// Copy or transform one attribute of the vertices of a bundle into another bundle.
+struct VertexAttributeCopy {
+    uint32_t inputOffset{0};
+    uint32_t outputOffset{0};
+    uint32_t size{0};
+    VertexTransformFunc transform{nullptr};
+    const Mat4 *matrix{nullptr};
+};
+
+void copyVertexAttributes(const ccstd::vector<VertexAttributeCopy> &copies,
+                          const uint8_t *input, uint32_t inputStride, uint8_t *output, uint32_t outputStride,
+                          uint32_t begin, uint32_t end) {
+    input += static_cast<size_t>(begin) * inputStride;
+    output += static_cast<size_t>(begin) * outputStride;
+    const uint32_t count = end - begin;
+    for (const auto &copy : copies) {
+        if (copy.transform) {
+            copy.transform(input + copy.inputOffset, inputStride, output + copy.outputOffset, outputStride, count, *copy.matrix);
+        } else if (input != output || copy.inputOffset != copy.outputOffset) {
+            const uint8_t *inputAttr = input + copy.inputOffset;
+            uint8_t *outputAttr = output + copy.outputOffset;
+            for (uint32_t v = 0; v < count; ++v, inputAttr += inputStride, outputAttr += outputStride) {
+                memcpy(outputAttr, inputAttr, copy.size);
+            }
+        }
+    }
+}
+
+template <typename Dst, typename Src>
+void rebaseIndices(Dst *dst, const Src *src, uint32_t count, uint32_t base) {
+    for (uint32_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<Dst>(base + src[i]);
+    }
+}
+
+template <typename Dst>
+void rebaseIndices(Dst *dst, const uint8_t *src, uint32_t srcStride, uint32_t count, uint32_t base) {
+    if (srcStride == sizeof(Dst) && base == 0) {
+        memcpy(dst, src, static_cast<size_t>(count) * srcStride);
+        return;
+    }
+    switch (srcStride) {
+        case 1:
+            rebaseIndices(dst, src, count, base);
+            break;
+        case 2:
+            rebaseIndices(dst, reinterpret_cast<const uint16_t *>(src), count, base);
+            break;
+        default:
+            rebaseIndices(dst, reinterpret_cast<const uint32_t *>(src), count, base);
+            break;
+    }
+}
+
+// Write count indices of srcStride bytes into dst with dstStride bytes, offsetting them by base.
+void rebaseIndices(uint8_t *dst, uint32_t dstStride, const uint8_t *src, uint32_t srcStride, uint32_t count, uint32_t base) {
+    switch (dstStride) {
+        case 1:
+            rebaseIndices(dst, src, srcStride, count, base);
+            break;
+        case 2:
+            rebaseIndices(reinterpret_cast<uint16_t *>(dst), src, srcStride, count, base);
+            break;
+        default:
+            rebaseIndices(reinterpret_cast<uint32_t *>(dst), src, srcStride, count, base);
+            break;
+    }
+}
+
 } // namespace
 
 Mesh::~Mesh() = default;
@@ -564,49 +733,31 @@ bool Mesh::merge(Mesh *mesh, const Mat4 *worldMatrix /* = nullptr */, bool valid
                 Vec3::add(boundingBox.center, boundingBox.halfExtents, &structInfo.maxPosition.value());
                 Vec3::subtract(boundingBox.center, boundingBox.halfExtents, &structInfo.minPosition.value());
             }
-            for (auto &vtxBdl : structInfo.vertexBundles) {
-                for (int j = 0; j < vtxBdl.attributes.size(); j++) {
-                    if (vtxBdl.attributes[j].name == gfx::ATTR_NAME_POSITION || vtxBdl.attributes[j].name == gfx::ATTR_NAME_NORMAL) {
-                        const gfx::Format format = vtxBdl.attributes[j].format;
-
-                        DataView inputView(data.buffer(), vtxBdl.view.offset + getOffset(vtxBdl.attributes, j));
-
-                        auto reader = getReader(inputView, format);
-                        if (reader == nullptr) {
-                            continue;
-                        }
-
-                        auto writer = getWriter(inputView, format);
-                        if (writer == nullptr) {
-                            continue;
-                        }
-
-                        const uint32_t vertexCount = vtxBdl.view.count;
-
-                        const uint32_t vertexStride = vtxBdl.view.stride;
-                        const uint32_t attrComponentByteLength = getComponentByteLength(format);
-                        for (uint32_t vtxIdx = 0; vtxIdx < vertexCount; vtxIdx++) {
-                            const uint32_t xOffset = vtxIdx * vertexStride;
-                            const uint32_t yOffset = xOffset + attrComponentByteLength;
-                            const uint32_t zOffset = yOffset + attrComponentByteLength;
-                            vec3Temp.set(
-                                getTypedArrayElementValue<float>(reader(xOffset)),
-                                getTypedArrayElementValue<float>(reader(yOffset)),
-                                getTypedArrayElementValue<float>(reader(zOffset)));
-                            const auto &attrName = vtxBdl.attributes[j].name;
-
-                            if (attrName == gfx::ATTR_NAME_POSITION) {
-                                vec3Temp.transformMat4(vec3Temp, *worldMatrix);
-                            } else if (attrName == gfx::ATTR_NAME_NORMAL) {
-                                vec3Temp.transformQuat(rotate);
-                            }
-
-                            writer(xOffset, vec3Temp.x);
-                            writer(yOffset, vec3Temp.y);
-                            writer(zOffset, vec3Temp.z);
-                        }
+            const Mat4 normalMatrix = getNormalMatrix(rotate);
+            uint8_t *bytes = data.buffer()->getData();
+            ccstd::vector<VertexAttributeCopy> transforms;
+            for (const auto &vtxBdl : structInfo.vertexBundles) {
+                transforms.clear();
+                uint32_t attrOffset = 0;
+                for (const auto &attr : vtxBdl.attributes) {
+                    VertexAttributeCopy copy;
+                    copy.inputOffset = attrOffset;
+                    copy.outputOffset = attrOffset;
+                    copy.transform = getVertexTransform(attr);
+                    copy.matrix = attr.name == gfx::ATTR_NAME_POSITION ? worldMatrix : &normalMatrix;
+                    if (copy.transform) {
+                        transforms.emplace_back(copy);
                     }
+                    attrOffset += gfx::GFX_FORMAT_INFOS[static_cast<uint32_t>(attr.format)].size;
+                }
+                if (transforms.empty()) {
+                    continue;
                 }
+                uint8_t *vertices = bytes + vtxBdl.view.offset;
+                const uint32_t stride = vtxBdl.view.stride;
+                parallelForRange(vtxBdl.view.count, PARALLEL_MERGE_MIN_VERTICES, [&](uint32_t begin, uint32_t end) {
+                    copyVertexAttributes(transforms, vertices, stride, vertices, stride, begin, end);
+                });
             }
         }
         reset({structInfo, data});
@@ -621,73 +772,53 @@ bool Mesh::merge(Mesh *mesh, const Mat4 *worldMatrix /* = nullptr */, bool valid
     uint32_t vertCount = 0;
     uint32_t vertStride = 0;
 
-    uint32_t srcAttrOffset = 0;
-    uint32_t srcVBOffset = 0;
-    uint32_t dstVBOffset = 0;
-    uint32_t attrSize = 0;
-
-    bool hasAttr = false;
+    const Mat4 normalMatrix = getNormalMatrix(rotate);
 
     ccstd::vector<Mesh::IVertexBundle> vertexBundles;
     vertexBundles.resize(_struct.vertexBundles.size());
+    ccstd::vector<VertexAttributeCopy> copies;
 
     for (size_t i = 0; i < _struct.vertexBundles.size(); ++i) {
-        Uint8Array dstAttrView;
-
         const auto &bundle = _struct.vertexBundles[i];
-        auto &dstBundle = mesh->_struct.vertexBundles[i];
+        const auto &dstBundle = mesh->_struct.vertexBundles[i];
 
         vertStride = bundle.view.stride;
         vertCount = bundle.view.count + dstBundle.view.count;
 
         auto *vb = ccnew ArrayBuffer(vertCount * vertStride);
-        Uint8Array vbView(vb);
-
-        Uint8Array srcVBView = _data.subarray(bundle.view.offset, bundle.view.offset + bundle.view.length);
-        Uint8Array dstVBView = mesh->_data.subarray(dstBundle.view.offset, dstBundle.view.offset + dstBundle.view.length);
+        memcpy(vb->getData(), _data.buffer()->getData() + _data.byteOffset() + bundle.view.offset, bundle.view.length);
 
-        vbView.set(srcVBView);
-
-        srcAttrOffset = 0;
+        // the vertices of the merged mesh are appended attribute by attribute, as the layouts may differ
+        copies.clear();
+        uint32_t srcAttrOffset = 0;
         for (const auto &attr : bundle.attributes) {
-            dstVBOffset = 0;
-            hasAttr = false;
+            uint32_t dstAttrOffset = 0;
             for (const auto &dstAttr : dstBundle.attributes) {
                 if (attr.name == dstAttr.name && attr.format == dstAttr.format) {
-                    hasAttr = true;
-                    break;
-                }
-                dstVBOffset += gfx::GFX_FORMAT_INFOS[static_cast<uint32_t>(dstAttr.format)].size;
-            }
-            if (hasAttr) {
-                attrSize = gfx::GFX_FORMAT_INFOS[static_cast<uint32_t>(attr.format)].size;
-                srcVBOffset = bundle.view.length + srcAttrOffset;
-                for (uint32_t v = 0; v < dstBundle.view.count; ++v) {
-                    // Important note: the semantics of subarray are different in typescript and native
-                    dstAttrView = dstVBView.subarray(dstBundle.view.offset + dstVBOffset, dstBundle.view.offset + dstVBOffset + attrSize);
-                    vbView.set(dstAttrView, srcVBOffset);
-                    if ((attr.name == gfx::ATTR_NAME_POSITION || attr.name == gfx::ATTR_NAME_NORMAL) && worldMatrix != nullptr) {
-                        Float32Array f32Temp(vbView.buffer(), srcVBOffset, 3);
-                        vec3Temp.set(f32Temp[0], f32Temp[1], f32Temp[2]);
-                        if (attr.name == gfx::ATTR_NAME_POSITION) {
-                            vec3Temp.transformMat4(vec3Temp, *worldMatrix);
-                        } else if (attr.name == gfx::ATTR_NAME_NORMAL) {
-                            vec3Temp.transformQuat(rotate);
-                        }
-
-                        f32Temp[0] = vec3Temp.x;
-                        f32Temp[1] = vec3Temp.y;
-                        f32Temp[2] = vec3Temp.z;
+                    VertexAttributeCopy copy;
+                    copy.inputOffset = dstAttrOffset;
+                    copy.outputOffset = srcAttrOffset;
+                    copy.size = gfx::GFX_FORMAT_INFOS[static_cast<uint32_t>(attr.format)].size;
+                    if (worldMatrix != nullptr) {
+                        copy.transform = getVertexTransform(attr);
+                        copy.matrix = attr.name == gfx::ATTR_NAME_POSITION ? worldMatrix : &normalMatrix;
                     }
-                    srcVBOffset += bundle.view.stride;
-                    dstVBOffset += dstBundle.view.stride;
+                    copies.emplace_back(copy);
+                    break;
                 }
+                dstAttrOffset += gfx::GFX_FORMAT_INFOS[static_cast<uint32_t>(dstAttr.format)].size;
             }
             srcAttrOffset += gfx::GFX_FORMAT_INFOS[static_cast<uint32_t>(attr.format)].size;
         }
 
+        const uint8_t *dstVertices = mesh->_data.buffer()->getData() + mesh->_data.byteOffset() + dstBundle.view.offset;
+        uint8_t *mergedVertices = vb->getData() + bundle.view.length;
+        parallelForRange(dstBundle.view.count, PARALLEL_MERGE_MIN_VERTICES, [&](uint32_t begin, uint32_t end) {
+            copyVertexAttributes(copies, dstVertices, dstBundle.view.stride, mergedVertices, vertStride, begin, end);
+        });
+
         auto &vertexBundle = vertexBundles[i];
-        vertexBundle.attributes = bundle.attributes,
+        vertexBundle.attributes = bundle.attributes;
         vertexBundle.view.offset = bufferBlob.getLength();
         vertexBundle.view.length = vb->byteLength();
         vertexBundle.view.count = vertCount;
@@ -729,72 +860,13 @@ bool Mesh::merge(Mesh *mesh, const Mat4 *worldMatrix /* = nullptr */, bool valid
 
             auto *ib = ccnew ArrayBuffer(idxCount * idxStride);
 
-            TypedArray ibView;
-            TypedArray srcIBView;
-            TypedArray dstIBView;
-
-            if (idxStride == 2) {
-                ibView = Uint16Array(ib);
-            } else if (idxStride == 1) {
-                ibView = Uint8Array(ib);
-            } else { // Uint32
-                ibView = Uint32Array(ib);
-            }
-
-            // merge src indices
-            if (prim.indexView.value().stride == 2) {
-                srcIBView = Uint16Array(_data.buffer(), prim.indexView.value().offset, prim.indexView.value().count);
-            } else if (prim.indexView.value().stride == 1) {
-                srcIBView = Uint8Array(_data.buffer(), prim.indexView.value().offset, prim.indexView.value().count);
-            } else { // Uint32
-                srcIBView = Uint32Array(_data.buffer(), prim.indexView.value().offset, prim.indexView.value().count);
-            }
-            //
-            if (idxStride == prim.indexView.value().stride) {
-                switch (idxStride) {
-                    case 2:
-                        ccstd::get<Uint16Array>(ibView).set(ccstd::get<Uint16Array>(srcIBView));
-                        break;
-                    case 1:
-                        ccstd::get<Uint8Array>(ibView).set(ccstd::get<Uint8Array>(srcIBView));
-                        break;
-                    default:
-                        ccstd::get<Uint32Array>(ibView).set(ccstd::get<Uint32Array>(srcIBView));
-                        break;
-                }
-            } else {
-                for (uint32_t n = 0; n < prim.indexView.value().count; ++n) {
-                    if (idxStride == 2) {
-                        ccstd::get<Uint16Array>(ibView)[n] = static_cast<uint16_t>(getTypedArrayValue<uint32_t>(srcIBView, n));
-                    } else if (idxStride == 1) {
-                        ccstd::get<Uint8Array>(ibView)[n] = static_cast<uint8_t>(getTypedArrayValue<uint32_t>(srcIBView, n));
-                    } else {
-                        ccstd::get<Uint32Array>(ibView)[n] = getTypedArrayValue<uint32_t>(srcIBView, n);
-                    }
-                }
-            }
-
-            // merge dst indices
-            uint32_t indexViewStride = dstPrim.indexView.value().stride;
-            if (indexViewStride == 2) {
-                dstIBView = Uint16Array(mesh->_data.buffer(), dstPrim.indexView.value().offset, dstPrim.indexView->count);
-            } else if (indexViewStride == 1) {
-                dstIBView = Uint8Array(mesh->_data.buffer(), dstPrim.indexView.value().offset, dstPrim.indexView->count);
-            } else { // Uint32
-                dstIBView = Uint32Array(mesh->_data.buffer(), dstPrim.indexView.value().offset, dstPrim.indexView->count);
-            }
-            for (uint32_t n = 0; n < dstPrim.indexView.value().count; ++n) {
-                if (idxStride == 2) {
-                    ccstd::get<Uint16Array>(ibView)[prim.indexView->count + n] =
-                        vertBatchCount + static_cast<uint16_t>(getTypedArrayValue<uint32_t>(dstIBView, n));
-                } else if (idxStride == 1) {
-                    ccstd::get<Uint8Array>(ibView)[prim.indexView->count + n] =
-                        vertBatchCount + static_cast<uint8_t>(getTypedArrayValue<uint32_t>(dstIBView, n));
-                } else {
-                    ccstd::get<Uint32Array>(ibView)[prim.indexView->count + n] =
-                        vertBatchCount + getTypedArrayValue<uint32_t>(dstIBView, n);
-                }
-            }
+            // merge src indices, then dst indices offset by the src vertex count
+            const auto &srcIndexView = prim.indexView.value();
+            const auto &dstIndexView = dstPrim.indexView.value();
+            rebaseIndices(ib->getData(), idxStride,
+                          _data.buffer()->getData() + srcIndexView.offset, srcIndexView.stride, srcIndexView.count, 0);
+            rebaseIndices(ib->getData() + srcIndexView.count * idxStride, idxStride,
+                          mesh->_data.buffer()->getData() + dstIndexView.offset, dstIndexView.stride, dstIndexView.count, vertBatchCount);
 
             IBufferView indexView;
             indexView.offset = bufferBlob.getLength();
@@ -33,6 +33,14 @@
 #include "scene/Pass.h"
 #include "scene/RenderScene.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define CC_SKINNING_PALETTE_SSE
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #include <arm_neon.h>
+    #define CC_SKINNING_PALETTE_NEON
+#endif
+
 const uint32_t REALTIME_JOINT_TEXTURE_WIDTH = 256;
 const uint32_t REALTIME_JOINT_TEXTURE_HEIGHT = 3;
 
@@ -53,6 +61,56 @@ void getRelevantBuffers(ccstd::vector<index_t> &outIndices, ccstd::vector<int32_
     }
 }
 
+/**
+ * Compute world * bindpose and store the upper 3 rows in the skinning layout:
+ * each row holds the xyz of one basis column followed by one translation component.
+ */
+void storeSkinningMatrix(const cc::Mat4 &world, const cc::Mat4 &bindpose, float *row0, float *row1, float *row2) {
+    const float *a = world.m;
+    const float *b = bindpose.m;
+#if defined(CC_SKINNING_PALETTE_SSE)
+    const __m128 a0 = _mm_loadu_ps(a);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+    __m128 col[4];
+    for (int j = 0; j < 4; ++j) {
+        col[j] = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(b[j * 4 + 0])), _mm_mul_ps(a1, _mm_set1_ps(b[j * 4 + 1]))),
+            _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(b[j * 4 + 2])), _mm_mul_ps(a3, _mm_set1_ps(b[j * 4 + 3]))));
+    }
+    // (c.x, c.y, c.z, t.i): lanes 0 and 1 from the column, lanes 2 and 3 from (c.z, c.z, t.i, t.i)
+    const __m128 zt0 = _mm_shuffle_ps(col[0], col[3], _MM_SHUFFLE(0, 0, 2, 2));
+    const __m128 zt1 = _mm_shuffle_ps(col[1], col[3], _MM_SHUFFLE(1, 1, 2, 2));
+    const __m128 zt2 = _mm_shuffle_ps(col[2], col[3], _MM_SHUFFLE(2, 2, 2, 2));
+    _mm_storeu_ps(row0, _mm_shuffle_ps(col[0], zt0, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(row1, _mm_shuffle_ps(col[1], zt1, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(row2, _mm_shuffle_ps(col[2], zt2, _MM_SHUFFLE(2, 0, 1, 0)));
+#elif defined(CC_SKINNING_PALETTE_NEON)
+    const float32x4_t a0 = vld1q_f32(a);
+    const float32x4_t a1 = vld1q_f32(a + 4);
+    const float32x4_t a2 = vld1q_f32(a + 8);
+    const float32x4_t a3 = vld1q_f32(a + 12);
+    float32x4_t col[4];
+    for (int j = 0; j < 4; ++j) {
+        col[j] = vaddq_f32(
+            vaddq_f32(vmulq_n_f32(a0, b[j * 4 + 0]), vmulq_n_f32(a1, b[j * 4 + 1])),
+            vaddq_f32(vmulq_n_f32(a2, b[j * 4 + 2]), vmulq_n_f32(a3, b[j * 4 + 3])));
+    }
+    vst1q_f32(row0, vsetq_lane_f32(vgetq_lane_f32(col[3], 0), col[0], 3));
+    vst1q_f32(row1, vsetq_lane_f32(vgetq_lane_f32(col[3], 1), col[1], 3));
+    vst1q_f32(row2, vsetq_lane_f32(vgetq_lane_f32(col[3], 2), col[2], 3));
+#else
+    float *rows[3] = {row0, row1, row2};
+    for (int j = 0; j < 3; ++j) {
+        for (int i = 0; i < 3; ++i) {
+            rows[j][i] = a[i] * b[j * 4 + 0] + a[4 + i] * b[j * 4 + 1] + a[8 + i] * b[j * 4 + 2] + a[12 + i] * b[j * 4 + 3];
+        }
+        rows[j][3] = a[j] * b[12] + a[4 + j] * b[13] + a[8 + j] * b[14] + a[12 + j] * b[15];
+    }
+#endif
+}
+
 ccstd::vector<cc::scene::IMacroPatch> uniformPatches{{"CC_USE_SKINNING", true}, {"CC_USE_REAL_TIME_JOINT_TEXTURE", false}};
 ccstd::vector<cc::scene::IMacroPatch> texturePatches{{"CC_USE_SKINNING", true}, {"CC_USE_REAL_TIME_JOINT_TEXTURE", true}};
 
@@ -126,6 +184,7 @@ void SkinningModel::updateTransform(uint32_t stamp) {
     geometry::AABB ab1;
     Vec3 v31;
     Vec3 v32;
+    // bounds and joint palette are computed in the same pass over the joints
     for (JointInfo &jointInfo : _joints) {
         auto &transform = jointInfo.transform;
         Mat4 worldMatrix = cc::getWorldMatrix(transform, static_cast<int32_t>(stamp));
@@ -133,6 +192,7 @@ void SkinningModel::updateTransform(uint32_t stamp) {
         ab1.getBoundary(&v31, &v32);
         Vec3::min(v3Min, v31, &v3Min);
         Vec3::max(v3Max, v32, &v3Max);
+        updateJointData(jointInfo, worldMatrix);
     }
     if (_modelBounds && _modelBounds->isValid() && _worldBounds) {
         geometry::AABB::fromPoints(v3Min, v3Max, _modelBounds);
@@ -143,20 +203,20 @@ void SkinningModel::updateTransform(uint32_t stamp) {
 
 void SkinningModel::updateUBOs(uint32_t stamp) {
     Super::updateUBOs(stamp);
-    uint32_t bIdx = 0;
-    Mat4 mat4;
-    for (const JointInfo &jointInfo : _joints) {
-        Mat4::multiply(jointInfo.transform->world, jointInfo.bindpose, &mat4);
-        for (uint32_t buffer : jointInfo.buffers) {
-            uploadJointData(jointInfo.indices[bIdx] * 12, mat4, _dataArray[buffer]);
-            bIdx++;
-        }
-        bIdx = 0;
-    }
+    uploadJointData();
+}
+
+void SkinningModel::commitParallelUpdate() {
+    Super::commitParallelUpdate();
+    uploadJointData();
+}
+
+void SkinningModel::uploadJointData() {
+    // joint data has been filled in updateTransform
     if (_realTimeTextureMode) {
         updateRealTimeJointTextureBuffer();
     } else {
-        bIdx = 0;
+        uint32_t bIdx = 0;
         for (gfx::Buffer *buffer : _buffers) {
             buffer->update(_dataArray[bIdx], buffer->getSize());
             bIdx++;
@@ -187,11 +247,23 @@ ccstd::vector<scene::IMacroPatch> SkinningModel::getMacroPatches(index_t subMode
     return myPatches;
 }
 
-void SkinningModel::uploadJointData(uint32_t base, const Mat4 &mat, float *dst) {
-    memcpy(reinterpret_cast<void *>(dst + base), mat.m, sizeof(float) * 12);
-    dst[base + 3] = mat.m[12];
-    dst[base + 7] = mat.m[13];
-    dst[base + 11] = mat.m[14];
+void SkinningModel::updateJointData(const JointInfo &jointInfo, const Mat4 &worldMatrix) {
+    const auto bufferCount = jointInfo.buffers.size();
+    if (bufferCount == 0) {
+        return;
+    }
+    // Uniform buffers store the 3 rows of a joint contiguously,
+    // the real time joint texture stores each row in its own texture line.
+    const uint32_t rowStride = _realTimeTextureMode ? 4 * REALTIME_JOINT_TEXTURE_WIDTH : 4;
+    const uint32_t jointStride = _realTimeTextureMode ? 4 : 12;
+    float *first = _dataArray[jointInfo.buffers[0]] + jointInfo.indices[0] * jointStride;
+    storeSkinningMatrix(worldMatrix, jointInfo.bindpose, first, first + rowStride, first + 2 * rowStride);
+    for (size_t i = 1; i < bufferCount; ++i) {
+        float *dst = _dataArray[jointInfo.buffers[i]] + jointInfo.indices[i] * jointStride;
+        for (uint32_t row = 0; row < 3; ++row) {
+            memcpy(dst + row * rowStride, first + row * rowStride, sizeof(float) * 4);
+        }
+    }
 }
 
 void SkinningModel::updateLocalDescriptors(index_t submodelIdx, gfx::DescriptorSet *descriptorset) {
@@ -269,7 +341,6 @@ void SkinningModel::initRealTimeJointTexture() {
         textureFormat = gfx::Format::RGBA8;
         texWidth = texWidth * 4;
     }
-    uint32_t length = 4 * REALTIME_JOINT_TEXTURE_WIDTH * REALTIME_JOINT_TEXTURE_HEIGHT;
     const size_t count = _dataArray.size();
     for (size_t i = 0; i < count; i++) {
         gfx::TextureInfo textureInfo;
@@ -280,7 +351,6 @@ void SkinningModel::initRealTimeJointTexture() {
         IntrusivePtr<gfx::Texture> texture = device->createTexture(textureInfo);
         _realTimeJointTexture->textures.push_back(texture);
     }
-    _realTimeJointTexture->buffer = new float[length];
 }
 
 void SkinningModel::bindRealTimeJointTexture(uint32_t idx, gfx::DescriptorSet *descriptorset) {
@@ -307,21 +377,8 @@ void SkinningModel::updateRealTimeJointTextureBuffer() {
     uint32_t width = REALTIME_JOINT_TEXTURE_WIDTH;
     uint32_t height = REALTIME_JOINT_TEXTURE_HEIGHT;
     for (const auto &texture : _realTimeJointTexture->textures) {
-        auto *buffer = _realTimeJointTexture->buffer;
-        auto *dst = buffer;
-        auto *src = _dataArray[bIdx];
-        uint32_t count = width;
-        for (uint32_t i = 0; i < count; i++) {
-            dst = buffer + (4 * i);
-            memcpy(dst, src, 16);
-            src = src + 4;
-            dst = buffer + (4 * (i + width));
-            memcpy(dst, src, 16);
-            src = src + 4;
-            dst = buffer + 4 * (i + 2 * width);
-            memcpy(dst, src, 16);
-            src = src + 4;
-        }
+        // joint data is already stored in texture layout
+        const auto *buffer = reinterpret_cast<const uint8_t *>(_dataArray[bIdx]);
         uint32_t buffOffset = 0;
         gfx::TextureSubresLayers layer;
         gfx::Offset texOffset;
@@ -335,7 +392,7 @@ void SkinningModel::updateRealTimeJointTextureBuffer() {
             layer};
         auto *device = gfx::Device::getInstance();
 
-        device->copyBuffersToTexture(reinterpret_cast<const uint8_t *const *>(&buffer), texture, &region, 1);
+        device->copyBuffersToTexture(&buffer, texture, &region, 1);
         bIdx++;
     }
 }
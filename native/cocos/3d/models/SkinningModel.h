@@ -56,6 +56,7 @@ public:
     void updateLocalDescriptors(index_t submodelIdx, gfx::DescriptorSet *descriptorset) override;
     void updateTransform(uint32_t stamp) override;
     void updateUBOs(uint32_t stamp) override;
+    void commitParallelUpdate() override;
     void destroy() override;
 
     void initSubModel(index_t idx, RenderingSubMesh *subMeshData, Material *mat) override;
@@ -65,7 +66,8 @@ public:
     void bindSkeleton(Skeleton *skeleton, Node *skinningRoot, Mesh *mesh);
 
 private:
-    static void uploadJointData(uint32_t base, const Mat4 &mat, float *dst);
+    void updateJointData(const JointInfo &jointInfo, const Mat4 &worldMatrix);
+    void uploadJointData();
     void ensureEnoughBuffers(uint32_t count);
     void updateRealTimeJointTextureBuffer();
     void initRealTimeJointTexture();
@@ -24,6 +24,7 @@
 ****************************************************************************/
 
 #include "base/ThreadPool.h"
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include "base/memory/Memory.h"
@@ -41,6 +42,12 @@
 
 namespace cc {
 
+namespace {
+// the pool and the index of the worker running on the current thread
+thread_local LegacyThreadPool *tCurrentPool = nullptr;
+thread_local int tCurrentThreadId = -1;
+} // namespace
+
 #define DEFAULT_THREAD_POOL_MIN_NUM (4)
 #define DEFAULT_THREAD_POOL_MAX_NUM (20)
 
@@ -107,9 +114,7 @@ LegacyThreadPool::~LegacyThreadPool() {
 
 // number of idle threads
 int LegacyThreadPool::getIdleThreadNum() const {
-    auto *thiz = const_cast<LegacyThreadPool *>(this);
-    std::lock_guard<std::mutex> lk(thiz->_idleThreadNumMutex);
-    return _idleThreadNum;
+    return _idleThreadNum.load(std::memory_order_relaxed);
 }
 
 void LegacyThreadPool::init() {
@@ -121,6 +126,11 @@ void LegacyThreadPool::init() {
     _abortFlags.resize(_maxThreadNum);
     _idleFlags.resize(_maxThreadNum);
     _initedFlags.resize(_maxThreadNum);
+    _workerQueues.resize(_maxThreadNum);
+
+    for (int i = 0; i < _maxThreadNum; ++i) {
+        _workerQueues[i] = std::make_unique<WorkerQueues>();
+    }
 
     for (int i = 0; i < _maxThreadNum; ++i) {
         _idleFlags[i] = std::make_shared<std::atomic<bool>>(false);
@@ -210,13 +220,18 @@ void LegacyThreadPool::stretchPool(int count) {
 
 void LegacyThreadPool::pushTask(const std::function<void(int)> &runnable,
                                 TaskType type /* = DEFAULT*/) {
-    if (!_isFixedSize) {
-        _idleThreadNumMutex.lock();
-        int idleNum = _idleThreadNum;
-        _idleThreadNumMutex.unlock();
+    pushTask(Task{TaskFunction(runnable), type});
+}
+
+void LegacyThreadPool::pushTask(Task &&task) {
+    const bool isWorker = tCurrentPool == this;
+
+    // resizing is only done by the owner thread, a worker pushing a task is busy and will pick it up itself
+    if (!_isFixedSize && !isWorker) {
+        int idleNum = getIdleThreadNum();
 
         if (idleNum > _minThreadNum) {
-            if (_taskQueue.empty()) {
+            if (_taskNum.load(std::memory_order_relaxed) == 0) {
                 auto now = std::chrono::high_resolution_clock::now();
                 float seconds = TIME_MINUS(now, _lastShrinkTime);
                 if (seconds > _shrinkInterval) {
@@ -229,49 +244,106 @@ void LegacyThreadPool::pushTask(const std::function<void(int)> &runnable,
         }
     }
 
-    auto callback = ccnew std::function<void(int)>([runnable](int tid) {
-        runnable(tid);
-    });
+    task.cancelSlot = getCancelSlot(task.type);
+    task.cancelGeneration = _cancelGenerations[task.cancelSlot].load(std::memory_order_acquire);
+    task.cancelAllGeneration = _cancelAllGeneration.load(std::memory_order_acquire);
 
-    Task task;
-    task.type = type;
-    task.callback = callback;
-    _taskQueue.push(task);
+    const uint32_t priority = getTaskPriority(task.type);
+    const uint32_t queueIndex = isWorker ? static_cast<uint32_t>(tCurrentThreadId)
+                                         : _nextQueue.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(_workerQueues.size());
 
-    {
+    // counters go first so that a worker never sees a queued task it has not been told about
+    _priorityTaskNums[priority].fetch_add(1);
+    _taskNum.fetch_add(1);
+    _workerQueues[queueIndex]->queues[priority].enqueue(std::move(task));
+
+    // the idle counter is increased under the lock before a worker checks the task counter, see setThread
+    if (_idleThreadNum.load() > 0) {
         std::unique_lock<std::mutex> lock(_mutex);
         _cv.notify_one();
     }
 }
 
-void LegacyThreadPool::stopAllTasks() {
-    Task task;
-    while (_taskQueue.pop(task)) {
-        delete task.callback; // empty the queue
+bool LegacyThreadPool::popTask(int tid, Task &task) {
+    const auto queueNum = static_cast<int>(_workerQueues.size());
+    for (uint32_t priority = 0; priority < PRIORITY_COUNT; ++priority) {
+        if (_priorityTaskNums[priority].load(std::memory_order_relaxed) <= 0) {
+            continue;
+        }
+        // own queue first, then steal from the others
+        for (int i = 0; i < queueNum; ++i) {
+            auto &queue = _workerQueues[(tid + i) % queueNum]->queues[priority];
+            if (queue.try_dequeue(task)) {
+                _priorityTaskNums[priority].fetch_sub(1);
+                _taskNum.fetch_sub(1);
+                return true;
+            }
+        }
     }
+    return false;
 }
 
-void LegacyThreadPool::stopTasksByType(TaskType type) {
-    Task task;
-
-    ccstd::vector<Task> notStopTasks;
-    notStopTasks.reserve(_taskQueue.size());
+void LegacyThreadPool::runTask(Task &task, int tid) {
+    const bool isCanceled = _cancelGenerations[task.cancelSlot].load(std::memory_order_acquire) != task.cancelGeneration ||
+                            _cancelAllGeneration.load(std::memory_order_acquire) != task.cancelAllGeneration;
+    if (!isCanceled) {
+        task.callback(tid);
+    }
+    task.callback.reset();
+}
 
-    while (_taskQueue.pop(task)) {
-        if (task.type == type) { // Delete the task from queue
-            delete task.callback;
-        } else { // If task type isn't match, push it into a vector, then insert to task queue again
-            notStopTasks.push_back(task);
+uint32_t LegacyThreadPool::getCancelSlot(TaskType type) {
+    // open addressing table of the task types ever pushed, 0 marks an empty slot
+    const int key = static_cast<int>(type) + 1;
+    const auto hash = static_cast<uint32_t>(key) * 2654435761U;
+    for (uint32_t i = 0; i < CANCEL_SLOT_COUNT; ++i) {
+        const uint32_t slot = (hash + i) % CANCEL_SLOT_COUNT;
+        int current = _cancelTypes[slot].load(std::memory_order_acquire);
+        if (current == key) {
+            return slot;
+        }
+        if (current == 0) {
+            if (_cancelTypes[slot].compare_exchange_strong(current, key) || current == key) {
+                return slot;
+            }
         }
     }
+    // too many task types, the rest share the last slot, stopping one of them stops all of them
+    return CANCEL_SLOT_COUNT - 1;
+}
+
+uint32_t LegacyThreadPool::getTaskPriority(TaskType type) {
+    switch (type) {
+        case TaskType::AUDIO:
+            return 0;
+        case TaskType::NETWORK:
+            return 2;
+        default:
+            return 1;
+    }
+}
 
-    if (!notStopTasks.empty()) {
-        for (const auto &t : notStopTasks) {
-            _taskQueue.push(t);
+void LegacyThreadPool::stopAllTasks() {
+    // tasks that are being pushed concurrently are discarded when they are popped
+    _cancelAllGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+    Task task;
+    for (auto &worker : _workerQueues) {
+        for (uint32_t priority = 0; priority < PRIORITY_COUNT; ++priority) {
+            while (worker->queues[priority].try_dequeue(task)) { // empty the queue
+                _priorityTaskNums[priority].fetch_sub(1);
+                _taskNum.fetch_sub(1);
+                task.callback.reset();
+            }
         }
     }
 }
 
+void LegacyThreadPool::stopTasksByType(TaskType type) {
+    // the queued tasks of this type are discarded by the threads when they are popped
+    _cancelGenerations[getCancelSlot(type)].fetch_add(1, std::memory_order_acq_rel);
+}
+
 void LegacyThreadPool::joinThread(int tid) {
     if (tid < 0 || tid >= (int)_threads.size()) {
         LOGD("Invalid thread id %d\n", tid);
@@ -287,7 +359,7 @@ void LegacyThreadPool::joinThread(int tid) {
 }
 
 int LegacyThreadPool::getTaskNum() const {
-    return (int)_taskQueue.size();
+    return std::max(_taskNum.load(std::memory_order_relaxed), 0);
 }
 
 void LegacyThreadPool::setFixedSize(bool isFixedSize) {
@@ -332,6 +404,7 @@ void LegacyThreadPool::stop() {
     stopAllTasks();
     _threads.clear();
     _abortFlags.clear();
+    _workerQueues.clear();
 }
 
 void LegacyThreadPool::setThread(int tid) {
@@ -339,37 +412,29 @@ void LegacyThreadPool::setThread(int tid) {
         _abortFlags[tid]); // a copy of the shared ptr to the flag
     auto f = [this, tid, abortPtr /* a copy of the shared ptr to the abort */]() {
         std::atomic<bool> &abort = *abortPtr;
+        tCurrentPool = this;
+        tCurrentThreadId = tid;
         Task task;
-        bool isPop = _taskQueue.pop(task);
         while (true) {
-            while (isPop) { // if there is anything in the queue
-                std::unique_ptr<std::function<void(int)>> func(
-                    task.callback); // at return, delete the function even if an exception occurred
-                (*task.callback)(tid);
+            while (popTask(tid, task)) { // if there is anything in the queues
+                runTask(task, tid);
                 if (abort) {
                     return; // the thread is wanted to stop, return even if the queue is not empty yet
                 }
-
-                isPop = _taskQueue.pop(task);
             }
-            // the queue is empty here, wait for the next command
+            // the queues are empty here, wait for the next command
             std::unique_lock<std::mutex> lock(_mutex);
-            _idleThreadNumMutex.lock();
             ++_idleThreadNum;
-            _idleThreadNumMutex.unlock();
 
             *_idleFlags[tid] = true;
-            _cv.wait(lock, [this, &task, &isPop, &abort]() {
-                isPop = _taskQueue.pop(task);
-                return isPop || _isDone || abort;
+            _cv.wait(lock, [this, &abort]() {
+                return _taskNum.load() > 0 || _isDone || abort;
             });
             *_idleFlags[tid] = false;
-            _idleThreadNumMutex.lock();
             --_idleThreadNum;
-            _idleThreadNumMutex.unlock();
 
-            if (!isPop) {
-                return; // if the queue is empty and isDone == true or *flag then return
+            if (abort || (_isDone && _taskNum.load() <= 0)) {
+                return; // aborted, or done with the queues empty; a task stolen by another thread only means going back to wait
             }
         }
     };
@@ -28,12 +28,17 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
 #include "base/Utils.h"
-#include "base/std/container/queue.h"
+#include "base/memory/Memory.h"
+#include "base/std/container/vector.h"
+#include "concurrentqueue/concurrentqueue.h"
 
 namespace cc {
 
@@ -82,14 +87,22 @@ public:
     /* Pushs a task to thread pool
      *  @param runnable The callback of the task executed in sub thread
      *  @param type The task type, it's TASK_TYPE_DEFAULT if this argument isn't assigned
-     *  @note This function has to be invoked in cocos thread
+     *  @note This function has to be invoked in cocos thread or in a thread of this pool.
+     *        Tasks pushed from a thread of this pool are queued on that thread first, idle threads steal them.
+     *        AUDIO tasks run before the others, NETWORK tasks after them.
      */
     void pushTask(const std::function<void(int /*threadId*/)> &runnable, TaskType type = TaskType::DEFAULT);
 
+    // Same as above, the callable is stored in the task without allocation if it is small enough
+    template <typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, std::function<void(int)>>::value>>
+    void pushTask(F &&runnable, TaskType type = TaskType::DEFAULT) {
+        pushTask(Task{TaskFunction(std::forward<F>(runnable)), type});
+    }
+
     // Stops all tasks, it will remove all tasks in queue
     void stopAllTasks();
 
-    // Stops some tasks by type
+    // Stops some tasks by type, queued tasks of this type are discarded when they are dequeued
     void stopTasksByType(TaskType type);
 
     // Gets the minimum thread numbers
@@ -142,62 +155,123 @@ private:
 
     void stretchPool(int count);
 
-    ccstd::vector<std::unique_ptr<std::thread>> _threads;
-    ccstd::vector<std::shared_ptr<std::atomic<bool>>> _abortFlags;
-    ccstd::vector<std::shared_ptr<std::atomic<bool>>> _idleFlags;
-    ccstd::vector<std::shared_ptr<std::atomic<bool>>> _initedFlags;
-
-    template <typename T>
-    class ThreadSafeQueue {
+    // Type erased callable with small buffer storage.
+    class TaskFunction {
     public:
-        bool push(T const &value) {
-            std::unique_lock<std::mutex> lock(this->mutex);
-            this->q.push(value);
-            return true;
+        static constexpr size_t INLINE_SIZE = 64;
+
+        TaskFunction() = default;
+        ~TaskFunction() { reset(); }
+
+        template <typename F, typename Fn = std::decay_t<F>>
+        explicit TaskFunction(F &&f) {
+            if constexpr (sizeof(Fn) <= INLINE_SIZE && alignof(Fn) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible<Fn>::value) {
+                ccnew_placement(_storage) Fn(std::forward<F>(f));
+                _invoke = [](void *storage, int tid) { (*static_cast<Fn *>(storage))(tid); };
+                _manage = [](void *dst, void *src) {
+                    auto *fn = static_cast<Fn *>(src);
+                    if (dst) {
+                        ccnew_placement(dst) Fn(std::move(*fn));
+                    }
+                    fn->~Fn();
+                };
+            } else {
+                *reinterpret_cast<Fn **>(_storage) = ccnew Fn(std::forward<F>(f));
+                _invoke = [](void *storage, int tid) { (**static_cast<Fn **>(storage))(tid); };
+                _manage = [](void *dst, void *src) {
+                    if (dst) {
+                        *static_cast<Fn **>(dst) = *static_cast<Fn **>(src);
+                    } else {
+                        delete *static_cast<Fn **>(src);
+                    }
+                };
+            }
         }
 
-        // deletes the retrieved element, do not use for non integral types
-        bool pop(T &v) {
-            std::unique_lock<std::mutex> lock(this->mutex);
-            if (this->q.empty())
-                return false;
-            v = this->q.front();
-            this->q.pop();
-            return true;
+        TaskFunction(TaskFunction &&rhs) noexcept { moveFrom(rhs); }
+        TaskFunction &operator=(TaskFunction &&rhs) noexcept {
+            if (this != &rhs) {
+                reset();
+                moveFrom(rhs);
+            }
+            return *this;
         }
-
-        bool empty() const {
-            auto thiz = const_cast<ThreadSafeQueue *>(this);
-            std::unique_lock<std::mutex> lock(thiz->mutex);
-            return this->q.empty();
+        TaskFunction(const TaskFunction &) = delete;
+        TaskFunction &operator=(const TaskFunction &) = delete;
+
+        inline void operator()(int tid) { _invoke(_storage, tid); }
+        inline explicit operator bool() const { return _invoke != nullptr; }
+
+        void reset() {
+            if (_manage) {
+                _manage(nullptr, _storage);
+            }
+            _invoke = nullptr;
+            _manage = nullptr;
         }
 
-        size_t size() const {
-            auto thiz = const_cast<ThreadSafeQueue *>(this);
-            std::unique_lock<std::mutex> lock(thiz->mutex);
-            return this->q.size();
+    private:
+        void moveFrom(TaskFunction &rhs) {
+            if (rhs._manage) {
+                rhs._manage(_storage, rhs._storage);
+            }
+            _invoke = rhs._invoke;
+            _manage = rhs._manage;
+            rhs._invoke = nullptr;
+            rhs._manage = nullptr;
         }
 
-    private:
-        ccstd::queue<T> q;
-        std::mutex mutex;
+        alignas(std::max_align_t) unsigned char _storage[INLINE_SIZE];
+        void (*_invoke)(void *, int){nullptr};
+        // moves src to dst and destroys src, only destroys src if dst is null
+        void (*_manage)(void *, void *){nullptr};
     };
 
     struct Task {
-        TaskType type;
-        std::function<void(int)> *callback;
+        TaskFunction callback;
+        TaskType type{TaskType::DEFAULT};
+        // cancellation token: the task is discarded once the generation of its slot has changed
+        uint32_t cancelSlot{0};
+        uint32_t cancelGeneration{0};
+        uint32_t cancelAllGeneration{0};
+    };
+
+    static constexpr uint32_t PRIORITY_COUNT = 3;
+    static constexpr uint32_t CANCEL_SLOT_COUNT = 32;
+
+    // Task queues owned by a thread, lock free, other threads steal from them when their own queues are empty.
+    struct WorkerQueues {
+        moodycamel::ConcurrentQueue<Task> queues[PRIORITY_COUNT];
     };
 
+    void pushTask(Task &&task);
+
+    bool popTask(int tid, Task &task);
+
+    void runTask(Task &task, int tid);
+
+    uint32_t getCancelSlot(TaskType type);
+
+    static uint32_t getTaskPriority(TaskType type);
+
+    ccstd::vector<std::unique_ptr<std::thread>> _threads;
+    ccstd::vector<std::shared_ptr<std::atomic<bool>>> _abortFlags;
+    ccstd::vector<std::shared_ptr<std::atomic<bool>>> _idleFlags;
+    ccstd::vector<std::shared_ptr<std::atomic<bool>>> _initedFlags;
+    ccstd::vector<std::unique_ptr<WorkerQueues>> _workerQueues;
+
     static LegacyThreadPool *_instance;
 
-    ThreadSafeQueue<Task> _taskQueue;
+    std::atomic<int> _taskNum{0};
+    std::atomic<int> _priorityTaskNums[PRIORITY_COUNT]{};
+    std::atomic<uint32_t> _nextQueue{0};
+    std::atomic<int> _cancelTypes[CANCEL_SLOT_COUNT]{};
+    std::atomic<uint32_t> _cancelGenerations[CANCEL_SLOT_COUNT]{};
+    std::atomic<uint32_t> _cancelAllGeneration{0};
     std::atomic<bool> _isDone{false};
     std::atomic<bool> _isStop{false};
 
-    //IDEA: std::atomic<int> isn't supported by ndk-r10e while compiling with `armeabi` arch.
-    // So using a mutex here instead.
-    int _idleThreadNum{0}; // how many threads are waiting
-    std::mutex _idleThreadNumMutex;
+    std::atomic<int> _idleThreadNum{0}; // how many threads are waiting
 
     std::mutex _mutex;
     std::condition_variable _cv;
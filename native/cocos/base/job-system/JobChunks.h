@@ -0,0 +1,77 @@
+/****************************************************************************
+ Copyright (c) 2020-2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include "base/job-system/JobSystem.h"
+
+namespace cc {
+
+/**
+ * Number of chunks to split count items into, one per job thread plus the calling thread.
+ * Chunks hold at least minItemsPerChunk items, smaller ones cost more to schedule than to process.
+ */
+inline uint32_t getJobChunkCount(uint32_t count, uint32_t minItemsPerChunk) {
+    const uint32_t maxChunkCount = (count + minItemsPerChunk - 1) / minItemsPerChunk;
+    return std::max(1U, std::min(JobSystem::getInstance()->threadCount() + 1, maxChunkCount));
+}
+
+/**
+ * Run func(chunk) for each chunk in [0, chunkCount) and wait for all of them.
+ * Chunk 0 runs on the calling thread while the others run on the job system.
+ */
+template <typename Func>
+void runJobChunks(uint32_t chunkCount, const Func &func) {
+    if (chunkCount > 1) {
+        JobGraph g(JobSystem::getInstance());
+        g.createForEachIndexJob(1U, chunkCount, 1U, func);
+        g.run();
+        func(0);
+        g.waitForAll();
+    } else {
+        func(0);
+    }
+}
+
+/**
+ * Split [0, count) into even ranges of at least minItemsPerChunk items and run func(begin, end) for each of them.
+ * Returns the number of chunks used.
+ */
+template <typename Func>
+uint32_t parallelForRange(uint32_t count, uint32_t minItemsPerChunk, const Func &func) {
+    const uint32_t chunkCount = getJobChunkCount(count, minItemsPerChunk);
+    const uint32_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    runJobChunks(chunkCount, [&func, count, chunkSize](uint32_t chunk) {
+        const uint32_t begin = chunk * chunkSize;
+        const uint32_t end = std::min(begin + chunkSize, count);
+        if (begin < end) {
+            func(begin, end);
+        }
+    });
+    return chunkCount;
+}
+
+} // namespace cc
@@ -34,6 +34,7 @@
 #if CC_USE_DEBUG_RENDERER
     #include "profiler/DebugRenderer.h"
 #endif
+#include "core/scene-graph/TransformSystem.h"
 #include "engine/EngineEvents.h"
 #include "profiler/Profiler.h"
 #include "renderer/gfx-base/GFXDevice.h"
@@ -167,6 +168,8 @@ void Root::destroy() {
 
     _debugView.reset();
 
+    TransformSystem::destroyInstance();
+
     // TODO(minggo):
     //    this.dataPoolManager.clear();
 }
@@ -410,6 +413,7 @@ void Root::frameMoveProcess(bool isNeedUpdateScene, int32_t totalFrames) {
         }
 
         if (isNeedUpdateScene) {
+            TransformSystem::getInstance()->update();
             for (const auto &scene : _scenes) {
                 scene->update(stamp);
             }
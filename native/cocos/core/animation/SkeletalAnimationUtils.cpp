@@ -23,6 +23,7 @@
 ****************************************************************************/
 
 #include "core/animation/SkeletalAnimationUtils.h"
+#include <thread>
 #include "core/scene-graph/Node.h"
 
 namespace cc {
@@ -30,36 +31,39 @@ namespace cc {
 namespace {
 ccstd::vector<IJointTransform *> stack;
 ccstd::unordered_map<ccstd::string, IJointTransform *> pool;
-} // namespace
 
-Mat4 getWorldMatrix(IJointTransform *transform, int32_t stamp) {
-    uint32_t i = 0;
-    Mat4 *res = nullptr;
-    while (transform != nullptr) {
-        if ((transform->stamp == stamp || transform->stamp + 1 == stamp) && !transform->node->getChangedFlags()) {
-            res = &transform->world;
-            transform->stamp = stamp;
-            break;
+const Mat4 &resolveWorldMatrix(IJointTransform *transform, int32_t stamp) { // NOLINT(misc-no-recursion)
+    if (transform->stamp.load(std::memory_order_acquire) == stamp) {
+        return transform->world;
+    }
+    int32_t claimed = transform->claimStamp.load(std::memory_order_relaxed);
+    if (claimed == stamp || !transform->claimStamp.compare_exchange_strong(claimed, stamp, std::memory_order_acq_rel)) {
+        // Another thread is computing this joint. It only waits on ancestors, so this can not deadlock.
+        while (transform->stamp.load(std::memory_order_acquire) != stamp) {
+            std::this_thread::yield();
         }
-        transform->stamp = stamp;
-        stack.resize(i + 1);
-        stack[i++] = transform;
-        transform = transform->parent;
+        return transform->world;
     }
-    while (i > 0) {
-        transform = stack[--i];
-        stack[i] = nullptr;
-        const auto *node = transform->node;
-        CC_ASSERT_NOT_NULL(node);
+
+    const auto *node = transform->node;
+    CC_ASSERT_NOT_NULL(node);
+    const int32_t lastStamp = transform->stamp.load(std::memory_order_relaxed);
+    if (lastStamp + 1 != stamp || node->getChangedFlags()) {
         Mat4::fromRTS(node->getRotation(), node->getPosition(), node->getScale(), &transform->local);
-        if (res != nullptr) {
-            Mat4::multiply(*res, transform->local, &transform->world);
+        if (transform->parent != nullptr) {
+            Mat4::multiply(resolveWorldMatrix(transform->parent, stamp), transform->local, &transform->world);
         } else {
             transform->world = transform->local;
         }
-        res = &transform->world;
     }
-    return res != nullptr ? *res : Mat4::IDENTITY;
+    transform->stamp.store(stamp, std::memory_order_release);
+    return transform->world;
+}
+
+} // namespace
+
+Mat4 getWorldMatrix(IJointTransform *transform, int32_t stamp) {
+    return transform != nullptr ? resolveWorldMatrix(transform, stamp) : Mat4::IDENTITY;
 }
 
 IJointTransform *getTransform(Node *node, Node *root) {
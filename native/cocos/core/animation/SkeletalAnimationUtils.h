@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <atomic>
 #include "base/Ptr.h"
 #include "base/RefCounted.h"
 #include "math/Mat4.h"
@@ -37,21 +38,29 @@ struct IJointTransform : RefCounted {
     Node *node{nullptr};
     Mat4 local;
     Mat4 world;
-    int stamp{-1};
+    // stamp of the frame `world` is valid for, published after `world` is written
+    std::atomic<int32_t> stamp{-1};
+    // stamp of the frame being computed, claimed by the first thread reaching this joint
+    std::atomic<int32_t> claimStamp{-1};
     IntrusivePtr<IJointTransform> parent;
 };
 
 struct RealTimeJointTexture {
     ~RealTimeJointTexture() {
-        CC_SAFE_DELETE_ARRAY(buffer);
         for (auto &texture : textures) {
             texture->destroy();
         }
     }
     std::vector<IntrusivePtr<gfx::Texture>> textures;
-    float *buffer = nullptr;
 };
 
+/**
+ * @en Get the world matrix of a joint relative to the skinning root, cached per frame stamp.
+ * Joint transforms are shared by all models bound to the same nodes, this function may be
+ * called concurrently from several threads: each joint is computed once per stamp.
+ * @zh 获取关节相对蒙皮根节点的世界矩阵，按帧 stamp 缓存。
+ * 关节变换由绑定相同节点的所有模型共享，此函数可在多个线程中并发调用，每个关节每帧只计算一次。
+ */
 Mat4 getWorldMatrix(IJointTransform *transform, int32_t stamp);
 
 IJointTransform *getTransform(Node *node, Node *root);
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include "3d/assets/Mesh.h"
 #include "3d/misc/Buffer.h"
+#include "base/TemplateUtils.h"
 #include "core/DataView.h"
 #include "core/TypedArray.h"
 #include "math/Vec3.h"
@@ -146,6 +147,80 @@ const IGeometricInfo &RenderingSubMesh::getGeometricInfo() {
     return EMPTY_GEOMETRIC_INFO;
 }
 
+namespace {
+
+uint32_t getTriangleCount(const IGeometricInfo &info, gfx::PrimitiveMode primitiveMode) {
+    if (info.positions.empty() || !info.indices.has_value()) {
+        return 0;
+    }
+    const auto indexCount = ccstd::visit(overloaded{
+                                             [](const auto &arr) { return arr.length(); },
+                                             [](const ccstd::monostate & /*unused*/) { return static_cast<uint32_t>(0); }},
+                                         info.indices.value());
+    switch (primitiveMode) {
+        case gfx::PrimitiveMode::TRIANGLE_LIST: return indexCount / 3;
+        case gfx::PrimitiveMode::TRIANGLE_STRIP: return indexCount > 2 ? indexCount - 2 : 0;
+        case gfx::PrimitiveMode::TRIANGLE_FAN: return indexCount > 2 ? indexCount - 2 : 0;
+        default: return 0;
+    }
+}
+
+// vertex indices of every triangle, in the same order and winding as geometry::raySubMesh visits them
+void assembleTriangles(const IGeometricInfo &info, gfx::PrimitiveMode primitiveMode, ccstd::vector<uint32_t> &triangles) {
+    const auto vertexCount = info.positions.length() / 3;
+    const auto addTriangle = [&](uint32_t i0, uint32_t i1, uint32_t i2) {
+        if (i0 < vertexCount && i1 < vertexCount && i2 < vertexCount) {
+            triangles.insert(triangles.end(), {i0, i1, i2});
+        }
+    };
+    triangles.reserve(static_cast<size_t>(getTriangleCount(info, primitiveMode)) * 3);
+    ccstd::visit(overloaded{
+                     [&](const auto &ib) {
+                         const uint32_t indexCount = ib.length();
+                         if (primitiveMode == gfx::PrimitiveMode::TRIANGLE_LIST) {
+                             for (uint32_t j = 0; j + 2 < indexCount; j += 3) {
+                                 addTriangle(ib[j], ib[j + 1], ib[j + 2]);
+                             }
+                         } else if (primitiveMode == gfx::PrimitiveMode::TRIANGLE_STRIP) {
+                             for (uint32_t j = 0; j + 2 < indexCount; ++j) {
+                                 // every other triangle is flipped to keep the winding
+                                 const bool isOdd = (j & 1U) != 0;
+                                 addTriangle(ib[isOdd ? j + 1 : j], ib[isOdd ? j : j + 1], ib[j + 2]);
+                             }
+                         } else if (primitiveMode == gfx::PrimitiveMode::TRIANGLE_FAN) {
+                             for (uint32_t j = 1; j + 1 < indexCount; ++j) {
+                                 addTriangle(ib[0], ib[j], ib[j + 1]);
+                             }
+                         }
+                     },
+                     [](const ccstd::monostate & /*unused*/) {}},
+                 info.indices.value());
+}
+
+} // namespace
+
+const geometry::TriangleBVH *RenderingSubMesh::getTriangleBVH() {
+    if (!_triangleBVH.has_value()) {
+        if (getTriangleCount(getGeometricInfo(), _primitiveMode) < BVH_MIN_TRIANGLE_COUNT) {
+            return nullptr;
+        }
+        return buildTriangleBVH();
+    }
+    return _triangleBVH->empty() ? nullptr : &_triangleBVH.value();
+}
+
+const geometry::TriangleBVH *RenderingSubMesh::buildTriangleBVH() {
+    const auto &info = getGeometricInfo();
+    _triangleBVH.emplace();
+    if (getTriangleCount(info, _primitiveMode) == 0) {
+        return nullptr;
+    }
+    ccstd::vector<uint32_t> triangles;
+    assembleTriangles(info, _primitiveMode, triangles);
+    _triangleBVH->build(&info.positions[0], triangles.data(), static_cast<uint32_t>(triangles.size() / 3));
+    return _triangleBVH->empty() ? nullptr : &_triangleBVH.value();
+}
+
 void RenderingSubMesh::genFlatBuffers() {
     if (!_flatBuffers.empty() || _mesh == nullptr || !_subMeshIdx.has_value()) {
         return;
@@ -30,6 +30,7 @@
 #include "base/std/variant.h"
 #include "core/TypedArray.h"
 #include "core/Types.h"
+#include "core/geometry/TriangleBVH.h"
 #include "renderer/gfx-base/GFXDef.h"
 
 namespace cc {
@@ -143,7 +144,28 @@ public:
      * @en Invalidate the geometric info of the sub mesh after geometry changed.
      * @zh 网格更新后，设置（用于射线检测的）几何信息为无效，需要重新计算。
      */
-    inline void invalidateGeometricInfo() { _geometricInfo.reset(); }
+    inline void invalidateGeometricInfo() {
+        _geometricInfo.reset();
+        _triangleBVH.reset();
+    }
+
+    /**
+     * @en
+     * The triangle BVH used to accelerate raycast, built from the geometric info on first access.
+     * Sub meshes with less than BVH_MIN_TRIANGLE_COUNT triangles are tested linearly and return nullptr.
+     * @zh
+     * 用于加速射线检测的三角形层次包围盒，首次访问时由几何信息构建。
+     * 三角形数少于 BVH_MIN_TRIANGLE_COUNT 的子网格直接逐个检测，返回 nullptr。
+     */
+    const geometry::TriangleBVH *getTriangleBVH();
+
+    /**
+     * @en Build the triangle BVH regardless of the triangle count, e.g. at load time to avoid a hitch on the first raycast.
+     * @zh 无论三角形数量多少都构建三角形层次包围盒，例如在加载时构建以避免首次射线检测时卡顿。
+     */
+    const geometry::TriangleBVH *buildTriangleBVH();
+
+    static constexpr uint32_t BVH_MIN_TRIANGLE_COUNT = 512;
 
     /**
      * @en Primitive mode used by the sub mesh
@@ -224,6 +246,9 @@ private:
 
     ccstd::optional<IGeometricInfo> _geometricInfo;
 
+    // empty when the geometric info has no triangles
+    ccstd::optional<geometry::TriangleBVH> _triangleBVH;
+
     // As gfx::InputAssemblerInfo needs the data structure, so not use IntrusivePtr.
     RefVector<gfx::Buffer *> _vertexBuffers;
 
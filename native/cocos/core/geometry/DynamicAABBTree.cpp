@@ -0,0 +1,264 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#include "core/geometry/DynamicAABBTree.h"
+#include "base/Macros.h"
+#include "core/geometry/AABB.h"
+
+namespace cc {
+namespace geometry {
+
+namespace {
+
+// relative to the half extents, plus an absolute part for tiny boxes
+constexpr float FAT_MARGIN_RATIO = 0.1F;
+constexpr float FAT_MARGIN_MIN = 0.01F;
+
+inline float surfaceArea(const Vec3 &min, const Vec3 &max) {
+    const Vec3 d = max - min;
+    return 2.F * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+inline float combinedArea(const Vec3 &minA, const Vec3 &maxA, const Vec3 &minB, const Vec3 &maxB) {
+    return surfaceArea({std::min(minA.x, minB.x), std::min(minA.y, minB.y), std::min(minA.z, minB.z)},
+                       {std::max(maxA.x, maxB.x), std::max(maxA.y, maxB.y), std::max(maxA.z, maxB.z)});
+}
+
+inline bool contains(const Vec3 &outerMin, const Vec3 &outerMax, const Vec3 &min, const Vec3 &max) {
+    return outerMin.x <= min.x && outerMin.y <= min.y && outerMin.z <= min.z &&
+           max.x <= outerMax.x && max.y <= outerMax.y && max.z <= outerMax.z;
+}
+
+} // namespace
+
+void DynamicAABBTree::setFatBounds(Node &node, const AABB &aabb) {
+    const Vec3 &halfExtents = aabb.getHalfExtents();
+    const Vec3 extents = halfExtents * (1.F + FAT_MARGIN_RATIO) + Vec3{FAT_MARGIN_MIN, FAT_MARGIN_MIN, FAT_MARGIN_MIN};
+    node.min = aabb.getCenter() - extents;
+    node.max = aabb.getCenter() + extents;
+}
+
+uint32_t DynamicAABBTree::allocateNode() {
+    uint32_t node = _freeList;
+    if (node == NULL_NODE) {
+        node = static_cast<uint32_t>(_nodes.size());
+        _nodes.emplace_back();
+    } else {
+        _freeList = _nodes[node].parent;
+    }
+    auto &n = _nodes[node];
+    n.userData = nullptr;
+    n.parent = NULL_NODE;
+    n.child1 = NULL_NODE;
+    n.child2 = NULL_NODE;
+    n.height = 0;
+    return node;
+}
+
+void DynamicAABBTree::freeNode(uint32_t node) {
+    _nodes[node].parent = _freeList;
+    _nodes[node].height = -1;
+    _nodes[node].userData = nullptr;
+    _freeList = node;
+}
+
+void DynamicAABBTree::clear() {
+    _nodes.clear();
+    _root = NULL_NODE;
+    _freeList = NULL_NODE;
+    _proxyCount = 0;
+}
+
+uint32_t DynamicAABBTree::createProxy(const AABB &aabb, void *userData) {
+    const uint32_t proxy = allocateNode();
+    setFatBounds(_nodes[proxy], aabb);
+    _nodes[proxy].userData = userData;
+    insertLeaf(proxy);
+    ++_proxyCount;
+    return proxy;
+}
+
+void DynamicAABBTree::destroyProxy(uint32_t proxy) {
+    CC_ASSERT(proxy < _nodes.size() && _nodes[proxy].isLeaf() && _nodes[proxy].height == 0);
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --_proxyCount;
+}
+
+bool DynamicAABBTree::moveProxy(uint32_t proxy, const AABB &aabb) {
+    CC_ASSERT(proxy < _nodes.size() && _nodes[proxy].isLeaf() && _nodes[proxy].height == 0);
+    auto &node = _nodes[proxy];
+    if (contains(node.min, node.max, aabb.getCenter() - aabb.getHalfExtents(), aabb.getCenter() + aabb.getHalfExtents())) {
+        return false;
+    }
+    removeLeaf(proxy);
+    setFatBounds(_nodes[proxy], aabb);
+    insertLeaf(proxy);
+    return true;
+}
+
+void DynamicAABBTree::refit(uint32_t node) {
+    auto &n = _nodes[node];
+    const auto &c1 = _nodes[n.child1];
+    const auto &c2 = _nodes[n.child2];
+    n.height = 1 + std::max(c1.height, c2.height);
+    n.min.set(std::min(c1.min.x, c2.min.x), std::min(c1.min.y, c2.min.y), std::min(c1.min.z, c2.min.z));
+    n.max.set(std::max(c1.max.x, c2.max.x), std::max(c1.max.y, c2.max.y), std::max(c1.max.z, c2.max.z));
+}
+
+void DynamicAABBTree::insertLeaf(uint32_t leaf) {
+    if (_root == NULL_NODE) {
+        _root = leaf;
+        _nodes[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    // descend along the cheapest path by surface area heuristic
+    const Vec3 leafMin = _nodes[leaf].min;
+    const Vec3 leafMax = _nodes[leaf].max;
+    uint32_t index = _root;
+    while (!_nodes[index].isLeaf()) {
+        const auto &node = _nodes[index];
+        const float area = surfaceArea(node.min, node.max);
+        const float mergedArea = combinedArea(node.min, node.max, leafMin, leafMax);
+        // cost of creating a new parent for this node and the leaf
+        const float cost = 2.F * mergedArea;
+        // minimum cost of pushing the leaf further down the tree
+        const float inheritanceCost = 2.F * (mergedArea - area);
+
+        const auto childCost = [&](const Node &child) {
+            const float merged = combinedArea(child.min, child.max, leafMin, leafMax);
+            return (child.isLeaf() ? merged : merged - surfaceArea(child.min, child.max)) + inheritanceCost;
+        };
+        const float cost1 = childCost(_nodes[node.child1]);
+        const float cost2 = childCost(_nodes[node.child2]);
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const uint32_t sibling = index;
+    const uint32_t oldParent = _nodes[sibling].parent;
+    const uint32_t newParent = allocateNode();
+    _nodes[newParent].parent = oldParent;
+    _nodes[newParent].child1 = sibling;
+    _nodes[newParent].child2 = leaf;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+    refit(newParent);
+    if (oldParent == NULL_NODE) {
+        _root = newParent;
+    } else if (_nodes[oldParent].child1 == sibling) {
+        _nodes[oldParent].child1 = newParent;
+    } else {
+        _nodes[oldParent].child2 = newParent;
+    }
+
+    for (index = _nodes[leaf].parent; index != NULL_NODE; index = _nodes[index].parent) {
+        index = balance(index);
+        refit(index);
+    }
+}
+
+void DynamicAABBTree::removeLeaf(uint32_t leaf) {
+    if (leaf == _root) {
+        _root = NULL_NODE;
+        return;
+    }
+
+    const uint32_t parent = _nodes[leaf].parent;
+    const uint32_t grandParent = _nodes[parent].parent;
+    const uint32_t sibling = _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+    freeNode(parent);
+    if (grandParent == NULL_NODE) {
+        _root = sibling;
+        _nodes[sibling].parent = NULL_NODE;
+        return;
+    }
+
+    if (_nodes[grandParent].child1 == parent) {
+        _nodes[grandParent].child1 = sibling;
+    } else {
+        _nodes[grandParent].child2 = sibling;
+    }
+    _nodes[sibling].parent = grandParent;
+    for (uint32_t index = grandParent; index != NULL_NODE; index = _nodes[index].parent) {
+        index = balance(index);
+        refit(index);
+    }
+}
+
+// rotate the higher grandchild up when the children heights differ by more than one,
+// returns the node now at the position of a
+uint32_t DynamicAABBTree::balance(uint32_t a) {
+    auto &nodeA = _nodes[a];
+    if (nodeA.isLeaf() || nodeA.height < 2) {
+        return a;
+    }
+
+    const uint32_t b = nodeA.child1;
+    const uint32_t c = nodeA.child2;
+    const int32_t diff = _nodes[c].height - _nodes[b].height;
+    if (diff >= -1 && diff <= 1) {
+        return a;
+    }
+
+    // the higher child takes the place of a, a keeps the lower child and one grandchild
+    const bool isRightHigher = diff > 1;
+    const uint32_t up = isRightHigher ? c : b;
+    auto &nodeUp = _nodes[up];
+    const uint32_t f = nodeUp.child1;
+    const uint32_t g = nodeUp.child2;
+
+    nodeUp.child1 = a;
+    nodeUp.parent = nodeA.parent;
+    nodeA.parent = up;
+    if (nodeUp.parent == NULL_NODE) {
+        _root = up;
+    } else if (_nodes[nodeUp.parent].child1 == a) {
+        _nodes[nodeUp.parent].child1 = up;
+    } else {
+        _nodes[nodeUp.parent].child2 = up;
+    }
+
+    // the higher grandchild stays under the rotated node
+    const bool isFHigher = _nodes[f].height > _nodes[g].height;
+    const uint32_t keep = isFHigher ? f : g;
+    const uint32_t move = isFHigher ? g : f;
+    nodeUp.child2 = keep;
+    if (isRightHigher) {
+        nodeA.child2 = move;
+    } else {
+        nodeA.child1 = move;
+    }
+    _nodes[move].parent = a;
+
+    refit(a);
+    refit(up);
+    return up;
+}
+
+} // namespace geometry
+} // namespace cc
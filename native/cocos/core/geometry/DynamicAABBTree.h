@@ -0,0 +1,259 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "base/std/container/vector.h"
+#include <algorithm>
+#include <cmath>
+#include "core/geometry/FrustumCulling.h"
+#include "core/geometry/Ray.h"
+#include "core/geometry/Sphere.h"
+#include "math/Vec3.h"
+
+namespace cc {
+namespace geometry {
+
+class AABB;
+
+/**
+ * @en
+ * Bounding volume hierarchy over moving boxes, kept balanced with tree rotations.
+ * Each proxy stores a box enlarged by a margin, so that small movements do not
+ * touch the tree. Proxy ids stay valid until destroyed.
+ * @zh
+ * 动态包围盒层次结构，通过树旋转保持平衡。
+ * 每个代理存储按边距扩大的包围盒，小幅移动不会修改树结构。代理 id 在销毁前保持有效。
+ */
+class DynamicAABBTree final {
+public:
+    static constexpr uint32_t NULL_NODE = 0xFFFFFFFF;
+
+    DynamicAABBTree() = default;
+    ~DynamicAABBTree() = default;
+
+    uint32_t createProxy(const AABB &aabb, void *userData);
+    void destroyProxy(uint32_t proxy);
+    /**
+     * @en Update the box of a proxy.
+     * @zh 更新代理的包围盒。
+     * @return @en true if the proxy had to be reinserted. @zh 代理被重新插入时返回 true。
+     */
+    bool moveProxy(uint32_t proxy, const AABB &aabb);
+    void clear();
+
+    inline void *getUserData(uint32_t proxy) const { return _nodes[proxy].userData; }
+    inline const Vec3 &getFatMin(uint32_t proxy) const { return _nodes[proxy].min; }
+    inline const Vec3 &getFatMax(uint32_t proxy) const { return _nodes[proxy].max; }
+    inline uint32_t getProxyCount() const { return _proxyCount; }
+    inline int32_t getHeight() const { return _root == NULL_NODE ? 0 : _nodes[_root].height; }
+
+    /**
+     * @en Invoke func(userData) for every proxy whose box overlaps [min, max].
+     * @zh 对每个包围盒与 [min, max] 相交的代理调用 func(userData)。
+     */
+    template <class Func>
+    void queryBox(const Vec3 &min, const Vec3 &max, Func &&func) const;
+
+    template <class Func>
+    void querySphere(const Sphere &sphere, Func &&func) const;
+
+    /**
+     * @en Invoke func(userData, distance) for every proxy whose box is hit by the ray within maxDistance,
+     * distance is where the ray enters the box.
+     * @zh 对射线在 maxDistance 内击中其包围盒的每个代理调用 func(userData, distance)，distance 为射线进入包围盒的距离。
+     */
+    template <class Func>
+    void queryRay(const Ray &ray, float maxDistance, Func &&func) const;
+
+    /**
+     * @en Invoke func(userData) for every proxy whose box is not completely outside the frustum.
+     * Subtrees completely inside are reported without further tests.
+     * @zh 对包围盒不完全在视锥外的每个代理调用 func(userData)。完全在视锥内的子树不再逐个测试。
+     */
+    template <class Func>
+    void queryFrustum(const FrustumPlanes &planes, Func &&func) const;
+
+private:
+    struct Node {
+        Vec3 min;
+        Vec3 max;
+        void *userData{nullptr};
+        // next free node when the node is free
+        uint32_t parent{NULL_NODE};
+        uint32_t child1{NULL_NODE};
+        uint32_t child2{NULL_NODE};
+        // 0 for leaves, -1 for free nodes
+        int32_t height{-1};
+
+        inline bool isLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    // traversal stack, only allocates for unusually deep trees
+    class Stack {
+    public:
+        inline bool empty() const { return _size == 0; }
+        inline void push(uint32_t node) {
+            if (_size < FIXED_SIZE) {
+                _fixed[_size] = node;
+            } else {
+                _overflow.emplace_back(node);
+            }
+            ++_size;
+        }
+        inline uint32_t pop() {
+            --_size;
+            if (_size < FIXED_SIZE) {
+                return _fixed[_size];
+            }
+            const uint32_t node = _overflow.back();
+            _overflow.pop_back();
+            return node;
+        }
+
+    private:
+        static constexpr uint32_t FIXED_SIZE = 64;
+        uint32_t _fixed[FIXED_SIZE];
+        ccstd::vector<uint32_t> _overflow;
+        uint32_t _size{0};
+    };
+
+    uint32_t allocateNode();
+    void freeNode(uint32_t node);
+    void insertLeaf(uint32_t leaf);
+    void removeLeaf(uint32_t leaf);
+    uint32_t balance(uint32_t node);
+    void refit(uint32_t node);
+
+    template <class Overlap, class Func>
+    void query(Overlap &&overlap, Func &&func) const;
+
+    static void setFatBounds(Node &node, const AABB &aabb);
+
+    ccstd::vector<Node> _nodes;
+    uint32_t _root{NULL_NODE};
+    uint32_t _freeList{NULL_NODE};
+    uint32_t _proxyCount{0};
+};
+
+template <class Overlap, class Func>
+void DynamicAABBTree::query(Overlap &&overlap, Func &&func) const {
+    if (_root == NULL_NODE) {
+        return;
+    }
+    Stack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+        const auto &node = _nodes[stack.pop()];
+        if (!overlap(node.min, node.max)) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            func(node);
+        } else {
+            stack.push(node.child2);
+            stack.push(node.child1);
+        }
+    }
+}
+
+template <class Func>
+void DynamicAABBTree::queryBox(const Vec3 &min, const Vec3 &max, Func &&func) const {
+    query(
+        [&](const Vec3 &nodeMin, const Vec3 &nodeMax) {
+            return nodeMin.x <= max.x && nodeMin.y <= max.y && nodeMin.z <= max.z &&
+                   nodeMax.x >= min.x && nodeMax.y >= min.y && nodeMax.z >= min.z;
+        },
+        [&](const Node &node) { func(node.userData); });
+}
+
+template <class Func>
+void DynamicAABBTree::querySphere(const Sphere &sphere, Func &&func) const {
+    const Vec3 &center = sphere.getCenter();
+    const float radiusSqr = sphere.getRadius() * sphere.getRadius();
+    query(
+        [&](const Vec3 &nodeMin, const Vec3 &nodeMax) {
+            const float dx = std::max({nodeMin.x - center.x, 0.F, center.x - nodeMax.x});
+            const float dy = std::max({nodeMin.y - center.y, 0.F, center.y - nodeMax.y});
+            const float dz = std::max({nodeMin.z - center.z, 0.F, center.z - nodeMax.z});
+            return dx * dx + dy * dy + dz * dz <= radiusSqr;
+        },
+        [&](const Node &node) { func(node.userData); });
+}
+
+template <class Func>
+void DynamicAABBTree::queryRay(const Ray &ray, float maxDistance, Func &&func) const {
+    // a huge but finite inverse avoids 0 * inf for axis parallel rays
+    const auto inverse = [](float d) {
+        constexpr float MIN_DIRECTION = 1e-30F;
+        return std::abs(d) < MIN_DIRECTION ? (std::signbit(d) ? -1.F : 1.F) / MIN_DIRECTION : 1.F / d;
+    };
+    const Vec3 invDir{inverse(ray.d.x), inverse(ray.d.y), inverse(ray.d.z)};
+    float tNear = 0.F;
+    query(
+        [&](const Vec3 &nodeMin, const Vec3 &nodeMax) {
+            const float tx1 = (nodeMin.x - ray.o.x) * invDir.x;
+            const float tx2 = (nodeMax.x - ray.o.x) * invDir.x;
+            const float ty1 = (nodeMin.y - ray.o.y) * invDir.y;
+            const float ty2 = (nodeMax.y - ray.o.y) * invDir.y;
+            const float tz1 = (nodeMin.z - ray.o.z) * invDir.z;
+            const float tz2 = (nodeMax.z - ray.o.z) * invDir.z;
+            tNear = std::max({std::min(tx1, tx2), std::min(ty1, ty2), std::min(tz1, tz2), 0.F});
+            const float tFar = std::min({std::max(tx1, tx2), std::max(ty1, ty2), std::max(tz1, tz2)});
+            return tFar >= tNear && tNear <= maxDistance;
+        },
+        [&](const Node &node) { func(node.userData, tNear); });
+}
+
+template <class Func>
+void DynamicAABBTree::queryFrustum(const FrustumPlanes &planes, Func &&func) const {
+    if (_root == NULL_NODE) {
+        return;
+    }
+    // nodes are pushed with the inside flag in the lowest bit of the index
+    Stack stack;
+    stack.push(_root << 1);
+    while (!stack.empty()) {
+        const uint32_t entry = stack.pop();
+        const auto &node = _nodes[entry >> 1];
+        bool isInside = (entry & 1) != 0;
+        if (!isInside) {
+            const int result = planes.testBox((node.min + node.max) * 0.5F, (node.max - node.min) * 0.5F);
+            if (result == -1) {
+                continue;
+            }
+            isInside = result == 0;
+        }
+        if (node.isLeaf()) {
+            func(node.userData);
+        } else {
+            stack.push((node.child2 << 1) | (isInside ? 1 : 0));
+            stack.push((node.child1 << 1) | (isInside ? 1 : 0));
+        }
+    }
+}
+
+} // namespace geometry
+} // namespace cc
@@ -0,0 +1,375 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#include "core/geometry/FrustumCulling.h"
+#include <cmath>
+#include <limits>
+#include "base/std/container/array.h"
+#include "core/geometry/AABB.h"
+#include "core/geometry/Frustum.h"
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define CC_FRUSTUM_CULLING_SSE
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #include <arm_neon.h>
+    #define CC_FRUSTUM_CULLING_NEON
+#endif
+
+namespace cc {
+namespace geometry {
+
+namespace {
+
+struct PlaneData {
+    float nx;
+    float ny;
+    float nz;
+    float absNx;
+    float absNy;
+    float absNz;
+    float d;
+};
+
+void extractPlanes(const Frustum &frustum, ccstd::array<PlaneData, 6> &out) {
+    for (uint32_t i = 0; i != 6; ++i) {
+        const auto &plane = *frustum.planes[i];
+        out[i] = {
+            plane.n.x, plane.n.y, plane.n.z,
+            std::abs(plane.n.x), std::abs(plane.n.y), std::abs(plane.n.z),
+            plane.d,
+        };
+    }
+}
+
+void resetVisibility(uint32_t count, ccstd::vector<uint64_t> &visibility) {
+    visibility.clear();
+    visibility.resize(getVisibilityWordCount(count), 0);
+}
+
+// Clear the bits of padding boxes in the last word.
+void maskTail(uint32_t count, ccstd::vector<uint64_t> &visibility) {
+    const uint32_t tail = count % 64;
+    if (tail) {
+        visibility.back() &= (uint64_t{1} << tail) - 1;
+    }
+}
+
+} // namespace
+
+void PackedAABBs::resize(uint32_t count) {
+    const uint32_t capacity = (count + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+    // Padding boxes are degenerated at origin, their bits are masked after the test.
+    _centerX.resize(capacity, 0);
+    _centerY.resize(capacity, 0);
+    _centerZ.resize(capacity, 0);
+    _halfExtentX.resize(capacity, 0);
+    _halfExtentY.resize(capacity, 0);
+    _halfExtentZ.resize(capacity, 0);
+    _count = count;
+}
+
+void PackedAABBs::clear() {
+    _centerX.clear();
+    _centerY.clear();
+    _centerZ.clear();
+    _halfExtentX.clear();
+    _halfExtentY.clear();
+    _halfExtentZ.clear();
+    _count = 0;
+}
+
+void PackedAABBs::set(uint32_t index, const AABB &aabb) {
+    CC_ASSERT(index < _count);
+    const auto &center = aabb.getCenter();
+    const auto &halfExtents = aabb.getHalfExtents();
+    _centerX[index] = center.x;
+    _centerY[index] = center.y;
+    _centerZ[index] = center.z;
+    _halfExtentX[index] = halfExtents.x;
+    _halfExtentY[index] = halfExtents.y;
+    _halfExtentZ[index] = halfExtents.z;
+}
+
+void PackedAABBs::setUnbounded(uint32_t index) {
+    CC_ASSERT(index < _count);
+    // Large enough to pass any plane, small enough to never produce inf * 0.
+    constexpr float extent = std::numeric_limits<float>::max() / 4;
+    _centerX[index] = 0;
+    _centerY[index] = 0;
+    _centerZ[index] = 0;
+    _halfExtentX[index] = extent;
+    _halfExtentY[index] = extent;
+    _halfExtentZ[index] = extent;
+}
+
+FrustumPlanes::FrustumPlanes(const Frustum &frustum) {
+    set(frustum);
+}
+
+void FrustumPlanes::set(const Frustum &frustum) {
+    for (uint32_t i = 0; i != LANE_COUNT; ++i) {
+        if (i < frustum.planes.size()) {
+            const auto &plane = *frustum.planes[i];
+            _nx[i] = plane.n.x;
+            _ny[i] = plane.n.y;
+            _nz[i] = plane.n.z;
+            _absNx[i] = std::abs(plane.n.x);
+            _absNy[i] = std::abs(plane.n.y);
+            _absNz[i] = std::abs(plane.n.z);
+            _d[i] = plane.d;
+        } else {
+            _nx[i] = _ny[i] = _nz[i] = 0;
+            _absNx[i] = _absNy[i] = _absNz[i] = 0;
+            _d[i] = std::numeric_limits<float>::lowest();
+        }
+    }
+}
+
+int FrustumPlanes::testBox(const Vec3 &center, const Vec3 &halfExtents) const {
+#if defined(__AVX__)
+    const __m256 cx = _mm256_set1_ps(center.x);
+    const __m256 cy = _mm256_set1_ps(center.y);
+    const __m256 cz = _mm256_set1_ps(center.z);
+    const __m256 ex = _mm256_set1_ps(halfExtents.x);
+    const __m256 ey = _mm256_set1_ps(halfExtents.y);
+    const __m256 ez = _mm256_set1_ps(halfExtents.z);
+    const __m256 r = _mm256_add_ps(
+        _mm256_add_ps(
+            _mm256_mul_ps(ex, _mm256_load_ps(_absNx)),
+            _mm256_mul_ps(ey, _mm256_load_ps(_absNy))),
+        _mm256_mul_ps(ez, _mm256_load_ps(_absNz)));
+    const __m256 dot = _mm256_add_ps(
+        _mm256_add_ps(
+            _mm256_mul_ps(_mm256_load_ps(_nx), cx),
+            _mm256_mul_ps(_mm256_load_ps(_ny), cy)),
+        _mm256_mul_ps(_mm256_load_ps(_nz), cz));
+    const __m256 d = _mm256_load_ps(_d);
+    if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(dot, r), d, _CMP_LT_OQ))) {
+        return -1;
+    }
+    return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_sub_ps(dot, r), d, _CMP_GT_OQ)) == 0xFF ? 0 : 1;
+#elif defined(CC_FRUSTUM_CULLING_SSE)
+    const __m128 cx = _mm_set1_ps(center.x);
+    const __m128 cy = _mm_set1_ps(center.y);
+    const __m128 cz = _mm_set1_ps(center.z);
+    const __m128 ex = _mm_set1_ps(halfExtents.x);
+    const __m128 ey = _mm_set1_ps(halfExtents.y);
+    const __m128 ez = _mm_set1_ps(halfExtents.z);
+    int outside = 0;
+    int inside = 0;
+    for (uint32_t i = 0; i != LANE_COUNT; i += 4) {
+        const __m128 r = _mm_add_ps(
+            _mm_add_ps(
+                _mm_mul_ps(ex, _mm_load_ps(_absNx + i)),
+                _mm_mul_ps(ey, _mm_load_ps(_absNy + i))),
+            _mm_mul_ps(ez, _mm_load_ps(_absNz + i)));
+        const __m128 dot = _mm_add_ps(
+            _mm_add_ps(
+                _mm_mul_ps(_mm_load_ps(_nx + i), cx),
+                _mm_mul_ps(_mm_load_ps(_ny + i), cy)),
+            _mm_mul_ps(_mm_load_ps(_nz + i), cz));
+        const __m128 d = _mm_load_ps(_d + i);
+        outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(dot, r), d));
+        inside |= _mm_movemask_ps(_mm_cmpgt_ps(_mm_sub_ps(dot, r), d)) << i;
+    }
+    if (outside) {
+        return -1;
+    }
+    return inside == 0xFF ? 0 : 1;
+#elif defined(CC_FRUSTUM_CULLING_NEON)
+    uint32x4_t outside = vdupq_n_u32(0);
+    uint32x4_t inside = vdupq_n_u32(0xFFFFFFFF);
+    for (uint32_t i = 0; i != LANE_COUNT; i += 4) {
+        const float32x4_t r = vaddq_f32(
+            vaddq_f32(
+                vmulq_n_f32(vld1q_f32(_absNx + i), halfExtents.x),
+                vmulq_n_f32(vld1q_f32(_absNy + i), halfExtents.y)),
+            vmulq_n_f32(vld1q_f32(_absNz + i), halfExtents.z));
+        const float32x4_t dot = vaddq_f32(
+            vaddq_f32(
+                vmulq_n_f32(vld1q_f32(_nx + i), center.x),
+                vmulq_n_f32(vld1q_f32(_ny + i), center.y)),
+            vmulq_n_f32(vld1q_f32(_nz + i), center.z));
+        const float32x4_t d = vld1q_f32(_d + i);
+        outside = vorrq_u32(outside, vcltq_f32(vaddq_f32(dot, r), d));
+        inside = vandq_u32(inside, vcgtq_f32(vsubq_f32(dot, r), d));
+    }
+    if (vmaxvq_u32(outside)) {
+        return -1;
+    }
+    return vminvq_u32(inside) ? 0 : 1;
+#else
+    bool inside = true;
+    for (uint32_t i = 0; i != LANE_COUNT; ++i) {
+        const float r = halfExtents.x * _absNx[i] + halfExtents.y * _absNy[i] + halfExtents.z * _absNz[i];
+        const float dot = _nx[i] * center.x + _ny[i] * center.y + _nz[i] * center.z;
+        if (dot + r < _d[i]) {
+            return -1;
+        }
+        inside = inside && dot - r > _d[i];
+    }
+    return inside ? 0 : 1;
+#endif
+}
+
+void frustumCullingScalar(const Frustum &frustum, const PackedAABBs &bounds, ccstd::vector<uint64_t> &visibility) {
+    const uint32_t count = bounds.size();
+    resetVisibility(count, visibility);
+
+    ccstd::array<PlaneData, 6> planes{};
+    extractPlanes(frustum, planes);
+
+    const float *cx = bounds.getCenterX();
+    const float *cy = bounds.getCenterY();
+    const float *cz = bounds.getCenterZ();
+    const float *ex = bounds.getHalfExtentX();
+    const float *ey = bounds.getHalfExtentY();
+    const float *ez = bounds.getHalfExtentZ();
+
+    for (uint32_t i = 0; i != count; ++i) {
+        bool visible = true;
+        for (const auto &p : planes) {
+            // same arithmetic as AABB::aabbPlane
+            const float r = ex[i] * p.absNx + ey[i] * p.absNy + ez[i] * p.absNz;
+            const float dot = p.nx * cx[i] + p.ny * cy[i] + p.nz * cz[i];
+            if (dot + r < p.d) {
+                visible = false;
+                break;
+            }
+        }
+        if (visible) {
+            visibility[i / 64] |= uint64_t{1} << (i % 64);
+        }
+    }
+}
+
+void frustumCullingBatch(const Frustum &frustum, const PackedAABBs &bounds, ccstd::vector<uint64_t> &visibility) {
+#if defined(__AVX__) || defined(CC_FRUSTUM_CULLING_SSE) || defined(CC_FRUSTUM_CULLING_NEON)
+    const uint32_t count = bounds.size();
+    const uint32_t capacity = bounds.capacity();
+    resetVisibility(count, visibility);
+
+    ccstd::array<PlaneData, 6> planes{};
+    extractPlanes(frustum, planes);
+
+    const float *cx = bounds.getCenterX();
+    const float *cy = bounds.getCenterY();
+    const float *cz = bounds.getCenterZ();
+    const float *ex = bounds.getHalfExtentX();
+    const float *ey = bounds.getHalfExtentY();
+    const float *ez = bounds.getHalfExtentZ();
+
+    #if defined(__AVX__)
+    constexpr uint32_t width = 8;
+    for (uint32_t i = 0; i < capacity; i += width) {
+        const __m256 centerX = _mm256_loadu_ps(cx + i);
+        const __m256 centerY = _mm256_loadu_ps(cy + i);
+        const __m256 centerZ = _mm256_loadu_ps(cz + i);
+        const __m256 extentX = _mm256_loadu_ps(ex + i);
+        const __m256 extentY = _mm256_loadu_ps(ey + i);
+        const __m256 extentZ = _mm256_loadu_ps(ez + i);
+        __m256 outside = _mm256_setzero_ps();
+        for (const auto &p : planes) {
+            const __m256 r = _mm256_add_ps(
+                _mm256_add_ps(
+                    _mm256_mul_ps(extentX, _mm256_set1_ps(p.absNx)),
+                    _mm256_mul_ps(extentY, _mm256_set1_ps(p.absNy))),
+                _mm256_mul_ps(extentZ, _mm256_set1_ps(p.absNz)));
+            const __m256 dot = _mm256_add_ps(
+                _mm256_add_ps(
+                    _mm256_mul_ps(_mm256_set1_ps(p.nx), centerX),
+                    _mm256_mul_ps(_mm256_set1_ps(p.ny), centerY)),
+                _mm256_mul_ps(_mm256_set1_ps(p.nz), centerZ));
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(dot, r), _mm256_set1_ps(p.d), _CMP_LT_OQ));
+        }
+        const auto mask = static_cast<uint64_t>(~_mm256_movemask_ps(outside) & 0xFF);
+        visibility[i / 64] |= mask << (i % 64);
+    }
+    #elif defined(CC_FRUSTUM_CULLING_SSE)
+    constexpr uint32_t width = 4;
+    for (uint32_t i = 0; i < capacity; i += width) {
+        const __m128 centerX = _mm_loadu_ps(cx + i);
+        const __m128 centerY = _mm_loadu_ps(cy + i);
+        const __m128 centerZ = _mm_loadu_ps(cz + i);
+        const __m128 extentX = _mm_loadu_ps(ex + i);
+        const __m128 extentY = _mm_loadu_ps(ey + i);
+        const __m128 extentZ = _mm_loadu_ps(ez + i);
+        __m128 outside = _mm_setzero_ps();
+        for (const auto &p : planes) {
+            const __m128 r = _mm_add_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(extentX, _mm_set1_ps(p.absNx)),
+                    _mm_mul_ps(extentY, _mm_set1_ps(p.absNy))),
+                _mm_mul_ps(extentZ, _mm_set1_ps(p.absNz)));
+            const __m128 dot = _mm_add_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(_mm_set1_ps(p.nx), centerX),
+                    _mm_mul_ps(_mm_set1_ps(p.ny), centerY)),
+                _mm_mul_ps(_mm_set1_ps(p.nz), centerZ));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dot, r), _mm_set1_ps(p.d)));
+        }
+        const auto mask = static_cast<uint64_t>(~_mm_movemask_ps(outside) & 0xF);
+        visibility[i / 64] |= mask << (i % 64);
+    }
+    #else // CC_FRUSTUM_CULLING_NEON
+    constexpr uint32_t width = 4;
+    const uint32x4_t laneBits = {1, 2, 4, 8};
+    for (uint32_t i = 0; i < capacity; i += width) {
+        const float32x4_t centerX = vld1q_f32(cx + i);
+        const float32x4_t centerY = vld1q_f32(cy + i);
+        const float32x4_t centerZ = vld1q_f32(cz + i);
+        const float32x4_t extentX = vld1q_f32(ex + i);
+        const float32x4_t extentY = vld1q_f32(ey + i);
+        const float32x4_t extentZ = vld1q_f32(ez + i);
+        uint32x4_t outside = vdupq_n_u32(0);
+        for (const auto &p : planes) {
+            const float32x4_t r = vaddq_f32(
+                vaddq_f32(
+                    vmulq_n_f32(extentX, p.absNx),
+                    vmulq_n_f32(extentY, p.absNy)),
+                vmulq_n_f32(extentZ, p.absNz));
+            const float32x4_t dot = vaddq_f32(
+                vaddq_f32(
+                    vmulq_n_f32(centerX, p.nx),
+                    vmulq_n_f32(centerY, p.ny)),
+                vmulq_n_f32(centerZ, p.nz));
+            outside = vorrq_u32(outside, vcltq_f32(vaddq_f32(dot, r), vdupq_n_f32(p.d)));
+        }
+        const auto mask = static_cast<uint64_t>(vaddvq_u32(vbicq_u32(laneBits, outside)));
+        visibility[i / 64] |= mask << (i % 64);
+    }
+    #endif
+    static_assert(PackedAABBs::LANE_COUNT % width == 0, "storage must be padded to whole vectors");
+    static_assert(64 % width == 0, "a vector must not straddle two words");
+    maskTail(count, visibility);
+#else
+    frustumCullingScalar(frustum, bounds, visibility);
+#endif
+}
+
+} // namespace geometry
+} // namespace cc
@@ -0,0 +1,172 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "base/std/container/vector.h"
+#include "math/Vec3.h"
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace cc {
+namespace geometry {
+
+class AABB;
+class Frustum;
+
+/**
+ * @en
+ * World space AABBs stored as structure of arrays, so that several boxes can be
+ * tested against a frustum plane at once. Storage is padded to a whole number of
+ * SIMD lanes, padding boxes are never reported as visible.
+ * @zh
+ * 以 SoA 方式存储的世界空间包围盒，可一次对多个包围盒进行视锥平面测试。
+ * 存储按 SIMD 宽度补齐，补齐的包围盒不会被判定为可见。
+ */
+class PackedAABBs final {
+public:
+    /**
+     * @en Number of boxes processed per iteration, storage is padded to a multiple of it.
+     * @zh 每次迭代处理的包围盒数量，存储会按此数补齐。
+     */
+    static constexpr uint32_t LANE_COUNT = 8;
+
+    void resize(uint32_t count);
+    void clear();
+
+    void set(uint32_t index, const AABB &aabb);
+    /**
+     * @en Store an unbounded box at index, it always passes the frustum test.
+     * @zh 在指定位置存储一个无限大的包围盒，它总能通过视锥测试。
+     */
+    void setUnbounded(uint32_t index);
+
+    inline uint32_t size() const { return _count; }
+    inline uint32_t capacity() const { return static_cast<uint32_t>(_centerX.size()); }
+
+    inline const float *getCenterX() const { return _centerX.data(); }
+    inline const float *getCenterY() const { return _centerY.data(); }
+    inline const float *getCenterZ() const { return _centerZ.data(); }
+    inline const float *getHalfExtentX() const { return _halfExtentX.data(); }
+    inline const float *getHalfExtentY() const { return _halfExtentY.data(); }
+    inline const float *getHalfExtentZ() const { return _halfExtentZ.data(); }
+
+private:
+    ccstd::vector<float> _centerX;
+    ccstd::vector<float> _centerY;
+    ccstd::vector<float> _centerZ;
+    ccstd::vector<float> _halfExtentX;
+    ccstd::vector<float> _halfExtentY;
+    ccstd::vector<float> _halfExtentZ;
+    uint32_t _count{0};
+};
+
+/**
+ * @en
+ * The planes of a frustum laid out for SIMD, prepared once and then used to test
+ * boxes one at a time, all planes at once.
+ * @zh
+ * 按 SIMD 布局存储的视锥平面，准备一次后可逐个测试包围盒，每次同时测试所有平面。
+ */
+class FrustumPlanes final {
+public:
+    FrustumPlanes() = default;
+    explicit FrustumPlanes(const Frustum &frustum);
+
+    void set(const Frustum &frustum);
+
+    /**
+     * @en
+     * Test a box against all planes, with the same arithmetic as AABB::aabbPlane.
+     * @zh
+     * 使用与 AABB::aabbPlane 相同的计算方式，测试包围盒与所有平面的关系。
+     * @return @en -1 if completely outside, 0 if completely inside, 1 if intersecting.
+     * @zh 完全在外返回 -1，完全在内返回 0，相交返回 1。
+     */
+    int testBox(const Vec3 &center, const Vec3 &halfExtents) const;
+
+private:
+    // 6 planes padded to 8 lanes, padding planes contain every box
+    static constexpr uint32_t LANE_COUNT = 8;
+
+    alignas(32) float _nx[LANE_COUNT]{};
+    alignas(32) float _ny[LANE_COUNT]{};
+    alignas(32) float _nz[LANE_COUNT]{};
+    alignas(32) float _absNx[LANE_COUNT]{};
+    alignas(32) float _absNy[LANE_COUNT]{};
+    alignas(32) float _absNz[LANE_COUNT]{};
+    alignas(32) float _d[LANE_COUNT]{};
+};
+
+/**
+ * @en
+ * Test all boxes against the frustum with SSE/AVX/NEON when available.
+ * Bit i of the result is set when box i is not completely outside the frustum,
+ * which matches AABB::aabbFrustum.
+ * @zh
+ * 在支持时使用 SSE/AVX/NEON 对所有包围盒进行视锥测试。
+ * 包围盒 i 不完全位于视锥外时，结果的第 i 位被置位，与 AABB::aabbFrustum 一致。
+ * @param frustum @en The frustum to test. @zh 测试用视锥。
+ * @param bounds @en The packed boxes. @zh 紧凑存储的包围盒。
+ * @param visibility @en The output bitset, resized to hold bounds.size() bits. @zh 输出位集，会被调整为 bounds.size() 位。
+ */
+void frustumCullingBatch(const Frustum &frustum, const PackedAABBs &bounds, ccstd::vector<uint64_t> &visibility);
+
+/**
+ * @en Reference implementation of frustumCullingBatch, one box at a time.
+ * @zh frustumCullingBatch 的逐个测试版本，用作参考实现。
+ */
+void frustumCullingScalar(const Frustum &frustum, const PackedAABBs &bounds, ccstd::vector<uint64_t> &visibility);
+
+inline uint32_t getVisibilityWordCount(uint32_t count) {
+    return (count + 63) / 64;
+}
+
+/**
+ * @en Invoke func with the index of every set bit, in increasing order.
+ * @zh 按升序对每个被置位的索引调用 func。
+ */
+template <class Func>
+void forEachVisible(const ccstd::vector<uint64_t> &visibility, Func &&func) {
+    const auto wordCount = static_cast<uint32_t>(visibility.size());
+    for (uint32_t wordID = 0; wordID != wordCount; ++wordID) {
+        uint64_t bits = visibility[wordID];
+        while (bits) {
+#if defined(_MSC_VER)
+            unsigned long bit = 0; // NOLINT(google-runtime-int)
+            _BitScanForward64(&bit, bits);
+#else
+            const auto bit = static_cast<uint32_t>(__builtin_ctzll(bits));
+#endif
+            func(wordID * 64 + static_cast<uint32_t>(bit));
+            bits &= bits - 1;
+        }
+    }
+}
+
+} // namespace geometry
+} // namespace cc
@@ -39,6 +39,7 @@
 #include "core/geometry/Spec.h"
 #include "core/geometry/Sphere.h"
 #include "core/geometry/Triangle.h"
+#include "core/geometry/TriangleBVH.h"
 #include "math/Mat3.h"
 #include "math/Math.h"
 #include "math/Vec3.h"
@@ -236,27 +237,31 @@ float rayCapsule(const Ray &ray, const Capsule &capsule) {
 }
 
 namespace {
-void fillResult(float *minDis, ERaycastMode m, float d, float i0, float i1, float i2, ccstd::optional<ccstd::vector<IRaySubMeshResult>> &r) {
+void fillResult(float *minDis, ERaycastMode m, float d, uint32_t v0, uint32_t v1, uint32_t v2, ccstd::optional<ccstd::vector<IRaySubMeshResult>> &r) {
     if (m == ERaycastMode::CLOSEST) {
         if (*minDis > d || *minDis == 0.0F) {
             *minDis = d;
             if (r) {
                 if (r->empty()) {
-                    r->emplace_back(IRaySubMeshResult{d, static_cast<uint32_t>(i0 / 3), static_cast<uint32_t>(i1 / 3), static_cast<uint32_t>(i2 / 3)});
+                    r->emplace_back(IRaySubMeshResult{d, v0, v1, v2});
                 } else {
                     (*r)[0].distance = d;
-                    (*r)[0].vertexIndex0 = static_cast<uint32_t>(i0 / 3);
-                    (*r)[0].vertexIndex1 = static_cast<uint32_t>(i1 / 3);
-                    (*r)[0].vertexIndex2 = static_cast<uint32_t>(i2 / 3);
+                    (*r)[0].vertexIndex0 = v0;
+                    (*r)[0].vertexIndex1 = v1;
+                    (*r)[0].vertexIndex2 = v2;
                 }
             }
         }
     } else {
         *minDis = d;
-        if (r) r->emplace_back(IRaySubMeshResult{d, static_cast<uint32_t>(i0 / 3), static_cast<uint32_t>(i1 / 3), static_cast<uint32_t>(i2 / 3)});
+        if (r) r->emplace_back(IRaySubMeshResult{d, v0, v1, v2});
     }
 }
 
+void fillResult(float *minDis, ERaycastMode m, float d, float i0, float i1, float i2, ccstd::optional<ccstd::vector<IRaySubMeshResult>> &r) {
+    fillResult(minDis, m, d, static_cast<uint32_t>(i0 / 3), static_cast<uint32_t>(i1 / 3), static_cast<uint32_t>(i2 / 3), r);
+}
+
 float narrowphase(float *minDis, const Float32Array &vb, const IBArray &ib, gfx::PrimitiveMode pm, const Ray &ray, IRaySubMeshOptions *opt) {
     Triangle tri;
     auto ibSize = ccstd::visit(overloaded{
@@ -319,6 +324,15 @@ float narrowphase(float *minDis, const Float32Array &vb, const IBArray &ib, gfx:
                                    [](const ccstd::monostate & /*unused*/) { return 0.F; }},
                         ib);
 }
+
+float bvhNarrowphase(float *minDis, const TriangleBVH &bvh, const Ray &ray, IRaySubMeshOptions *opt) {
+    ccstd::vector<IRaySubMeshResult> hits;
+    bvh.raycast(ray, opt->mode, opt->distance, opt->doubleSided, hits);
+    for (const auto &hit : hits) {
+        fillResult(minDis, opt->mode, hit.distance, hit.vertexIndex0, hit.vertexIndex1, hit.vertexIndex2, opt->result);
+    }
+    return *minDis;
+}
 } // namespace
 
 float raySubMesh(const Ray &ray, const RenderingSubMesh &submesh, IRaySubMeshOptions *options) {
@@ -336,7 +350,11 @@ float raySubMesh(const Ray &ray, const RenderingSubMesh &submesh, IRaySubMeshOpt
     if (rayAABB2(ray, min, max) != 0.0F) {
         const auto &pm = mesh.getPrimitiveMode();
         const auto &info = mesh.getGeometricInfo();
-        narrowphase(&minDis, info.positions, info.indices.value(), pm, ray, opt);
+        if (const auto *bvh = mesh.getTriangleBVH()) {
+            bvhNarrowphase(&minDis, *bvh, ray, opt);
+        } else {
+            narrowphase(&minDis, info.positions, info.indices.value(), pm, ray, opt);
+        }
     }
     return minDis;
 }
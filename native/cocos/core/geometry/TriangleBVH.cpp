@@ -0,0 +1,378 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#include "core/geometry/TriangleBVH.h"
+#include <algorithm>
+#include <cmath>
+#include "base/Macros.h"
+#include "core/geometry/Ray.h"
+#include "math/Math.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define CC_TRIANGLE_BVH_SSE
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #include <arm_neon.h>
+    #define CC_TRIANGLE_BVH_NEON
+#endif
+
+namespace cc {
+namespace geometry {
+
+namespace {
+
+// enough for any tree built from 32 bit triangle counts
+constexpr uint32_t MAX_STACK_SIZE = 64;
+
+inline float getAxis(const Vec3 &v, uint32_t axis) {
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+inline Vec3 getPosition(const float *positions, uint32_t vertexIndex) {
+    const float *p = positions + static_cast<size_t>(vertexIndex) * 3;
+    return {p[0], p[1], p[2]};
+}
+
+// avoids 0 * inf in the slab test when the ray is parallel to an axis
+inline float safeInverse(float d) {
+    constexpr float MIN_DIRECTION = 1e-30F;
+    if (std::abs(d) < MIN_DIRECTION) {
+        return std::signbit(d) ? -1.F / MIN_DIRECTION : 1.F / MIN_DIRECTION;
+    }
+    return 1.F / d;
+}
+
+inline bool rayBox(const Vec3 &origin, const Vec3 &invDir, const Vec3 &min, const Vec3 &max, float *tNear) {
+    const float tx1 = (min.x - origin.x) * invDir.x;
+    const float tx2 = (max.x - origin.x) * invDir.x;
+    const float ty1 = (min.y - origin.y) * invDir.y;
+    const float ty2 = (max.y - origin.y) * invDir.y;
+    const float tz1 = (min.z - origin.z) * invDir.z;
+    const float tz2 = (max.z - origin.z) * invDir.z;
+    const float tMin = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::max(std::min(tz1, tz2), 0.F));
+    const float tMax = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+    *tNear = tMin;
+    return tMax >= tMin;
+}
+
+} // namespace
+
+void TriangleBVH::clear() {
+    _nodes.clear();
+    _packets.clear();
+    _triangleCount = 0;
+}
+
+void TriangleBVH::build(const float *positions, const uint32_t *indices, uint32_t triangleCount) {
+    clear();
+    if (triangleCount == 0) {
+        return;
+    }
+    _triangleCount = triangleCount;
+
+    ccstd::vector<BuildTriangle> triangles(triangleCount);
+    for (uint32_t i = 0; i != triangleCount; ++i) {
+        const Vec3 a = getPosition(positions, indices[i * 3]);
+        const Vec3 b = getPosition(positions, indices[i * 3 + 1]);
+        const Vec3 c = getPosition(positions, indices[i * 3 + 2]);
+        auto &tri = triangles[i];
+        tri.min.set(std::min({a.x, b.x, c.x}), std::min({a.y, b.y, c.y}), std::min({a.z, b.z, c.z}));
+        tri.max.set(std::max({a.x, b.x, c.x}), std::max({a.y, b.y, c.y}), std::max({a.z, b.z, c.z}));
+        tri.centroid = (tri.min + tri.max) * 0.5F;
+        tri.index = i;
+    }
+
+    const uint32_t leafCount = (triangleCount + LANE_COUNT - 1) / LANE_COUNT;
+    _nodes.reserve(static_cast<size_t>(leafCount) * 4);
+    _packets.reserve(static_cast<size_t>(leafCount) * 2);
+    _nodes.emplace_back();
+    buildNode(0, triangles.data(), triangleCount, positions, indices);
+}
+
+void TriangleBVH::buildNode(uint32_t nodeIndex, BuildTriangle *triangles, uint32_t count, const float *positions, const uint32_t *indices) {
+    Vec3 min{triangles[0].min};
+    Vec3 max{triangles[0].max};
+    Vec3 centroidMin{triangles[0].centroid};
+    Vec3 centroidMax{triangles[0].centroid};
+    for (uint32_t i = 1; i != count; ++i) {
+        const auto &tri = triangles[i];
+        min.set(std::min(min.x, tri.min.x), std::min(min.y, tri.min.y), std::min(min.z, tri.min.z));
+        max.set(std::max(max.x, tri.max.x), std::max(max.y, tri.max.y), std::max(max.z, tri.max.z));
+        centroidMin.set(std::min(centroidMin.x, tri.centroid.x), std::min(centroidMin.y, tri.centroid.y), std::min(centroidMin.z, tri.centroid.z));
+        centroidMax.set(std::max(centroidMax.x, tri.centroid.x), std::max(centroidMax.y, tri.centroid.y), std::max(centroidMax.z, tri.centroid.z));
+    }
+    // padded so that the box test stays conservative for flat nodes, e.g. terrain patches
+    const float padding = max.distance(min) * 1e-4F + 1e-6F;
+    const Vec3 pad{padding, padding, padding};
+    _nodes[nodeIndex].min = min - pad;
+    _nodes[nodeIndex].max = max + pad;
+
+    if (count <= LANE_COUNT) {
+        _nodes[nodeIndex].index = static_cast<uint32_t>(_packets.size());
+        _nodes[nodeIndex].count = count;
+        auto &packet = _packets.emplace_back();
+        for (uint32_t lane = 0; lane != LANE_COUNT; ++lane) {
+            if (lane >= count) {
+                // degenerate triangle, rejected by the determinant test
+                packet.ax[lane] = packet.ay[lane] = packet.az[lane] = 0.F;
+                packet.abx[lane] = packet.aby[lane] = packet.abz[lane] = 0.F;
+                packet.acx[lane] = packet.acy[lane] = packet.acz[lane] = 0.F;
+                packet.vertexIndex0[lane] = packet.vertexIndex1[lane] = packet.vertexIndex2[lane] = 0;
+                continue;
+            }
+            const uint32_t *tri = indices + static_cast<size_t>(triangles[lane].index) * 3;
+            const Vec3 a = getPosition(positions, tri[0]);
+            const Vec3 ab = getPosition(positions, tri[1]) - a;
+            const Vec3 ac = getPosition(positions, tri[2]) - a;
+            packet.ax[lane] = a.x;
+            packet.ay[lane] = a.y;
+            packet.az[lane] = a.z;
+            packet.abx[lane] = ab.x;
+            packet.aby[lane] = ab.y;
+            packet.abz[lane] = ab.z;
+            packet.acx[lane] = ac.x;
+            packet.acy[lane] = ac.y;
+            packet.acz[lane] = ac.z;
+            packet.vertexIndex0[lane] = tri[0];
+            packet.vertexIndex1[lane] = tri[1];
+            packet.vertexIndex2[lane] = tri[2];
+        }
+        return;
+    }
+
+    // median split along the longest axis of the centroids
+    const Vec3 extent = centroidMax - centroidMin;
+    uint32_t axis = 0;
+    if (extent.y > extent.x) {
+        axis = 1;
+    }
+    if (extent.z > getAxis(extent, axis)) {
+        axis = 2;
+    }
+    const uint32_t half = count / 2;
+    std::nth_element(triangles, triangles + half, triangles + count, [axis](const BuildTriangle &lhs, const BuildTriangle &rhs) {
+        return getAxis(lhs.centroid, axis) < getAxis(rhs.centroid, axis);
+    });
+
+    const auto child = static_cast<uint32_t>(_nodes.size());
+    _nodes[nodeIndex].index = child;
+    _nodes[nodeIndex].count = 0;
+    _nodes.emplace_back();
+    _nodes.emplace_back();
+    buildNode(child, triangles, half, positions, indices);
+    buildNode(child + 1, triangles + half, count - half, positions, indices);
+}
+
+void TriangleBVH::intersect(const TrianglePacket &packet, const Ray &ray, bool doubleSided, float *distances) {
+    // same arithmetic as rayTriangle, four triangles at once
+#if defined(CC_TRIANGLE_BVH_SSE)
+    const __m128 dx = _mm_set1_ps(ray.d.x);
+    const __m128 dy = _mm_set1_ps(ray.d.y);
+    const __m128 dz = _mm_set1_ps(ray.d.z);
+    const __m128 abx = _mm_loadu_ps(packet.abx);
+    const __m128 aby = _mm_loadu_ps(packet.aby);
+    const __m128 abz = _mm_loadu_ps(packet.abz);
+    const __m128 acx = _mm_loadu_ps(packet.acx);
+    const __m128 acy = _mm_loadu_ps(packet.acy);
+    const __m128 acz = _mm_loadu_ps(packet.acz);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.F);
+
+    const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, acz), _mm_mul_ps(dz, acy));
+    const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, acx), _mm_mul_ps(dx, acz));
+    const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, acy), _mm_mul_ps(dy, acx));
+    const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(abx, px), _mm_mul_ps(aby, py)), _mm_mul_ps(abz, pz));
+    __m128 valid = _mm_cmpge_ps(det, _mm_set1_ps(math::EPSILON));
+    if (doubleSided) {
+        valid = _mm_or_ps(valid, _mm_cmple_ps(det, _mm_set1_ps(-math::EPSILON)));
+    }
+    if (_mm_movemask_ps(valid) == 0) {
+        _mm_storeu_ps(distances, zero);
+        return;
+    }
+    const __m128 invDet = _mm_div_ps(one, det);
+
+    const __m128 aox = _mm_sub_ps(_mm_set1_ps(ray.o.x), _mm_loadu_ps(packet.ax));
+    const __m128 aoy = _mm_sub_ps(_mm_set1_ps(ray.o.y), _mm_loadu_ps(packet.ay));
+    const __m128 aoz = _mm_sub_ps(_mm_set1_ps(ray.o.z), _mm_loadu_ps(packet.az));
+    const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aox, px), _mm_mul_ps(aoy, py)), _mm_mul_ps(aoz, pz)), invDet);
+    valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+    const __m128 qx = _mm_sub_ps(_mm_mul_ps(aoy, abz), _mm_mul_ps(aoz, aby));
+    const __m128 qy = _mm_sub_ps(_mm_mul_ps(aoz, abx), _mm_mul_ps(aox, abz));
+    const __m128 qz = _mm_sub_ps(_mm_mul_ps(aox, aby), _mm_mul_ps(aoy, abx));
+    const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+    valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+    const __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(acx, qx), _mm_mul_ps(acy, qy)), _mm_mul_ps(acz, qz)), invDet);
+    valid = _mm_and_ps(valid, _mm_cmpgt_ps(t, zero));
+    _mm_storeu_ps(distances, _mm_and_ps(valid, t));
+#elif defined(CC_TRIANGLE_BVH_NEON)
+    const float32x4_t dx = vdupq_n_f32(ray.d.x);
+    const float32x4_t dy = vdupq_n_f32(ray.d.y);
+    const float32x4_t dz = vdupq_n_f32(ray.d.z);
+    const float32x4_t abx = vld1q_f32(packet.abx);
+    const float32x4_t aby = vld1q_f32(packet.aby);
+    const float32x4_t abz = vld1q_f32(packet.abz);
+    const float32x4_t acx = vld1q_f32(packet.acx);
+    const float32x4_t acy = vld1q_f32(packet.acy);
+    const float32x4_t acz = vld1q_f32(packet.acz);
+    const float32x4_t zero = vdupq_n_f32(0.F);
+    const float32x4_t one = vdupq_n_f32(1.F);
+
+    const float32x4_t px = vsubq_f32(vmulq_f32(dy, acz), vmulq_f32(dz, acy));
+    const float32x4_t py = vsubq_f32(vmulq_f32(dz, acx), vmulq_f32(dx, acz));
+    const float32x4_t pz = vsubq_f32(vmulq_f32(dx, acy), vmulq_f32(dy, acx));
+    const float32x4_t det = vaddq_f32(vaddq_f32(vmulq_f32(abx, px), vmulq_f32(aby, py)), vmulq_f32(abz, pz));
+    uint32x4_t valid = vcgeq_f32(det, vdupq_n_f32(math::EPSILON));
+    if (doubleSided) {
+        valid = vorrq_u32(valid, vcleq_f32(det, vdupq_n_f32(-math::EPSILON)));
+    }
+    if (vmaxvq_u32(valid) == 0) {
+        vst1q_f32(distances, zero);
+        return;
+    }
+    const float32x4_t invDet = vdivq_f32(one, det);
+
+    const float32x4_t aox = vsubq_f32(vdupq_n_f32(ray.o.x), vld1q_f32(packet.ax));
+    const float32x4_t aoy = vsubq_f32(vdupq_n_f32(ray.o.y), vld1q_f32(packet.ay));
+    const float32x4_t aoz = vsubq_f32(vdupq_n_f32(ray.o.z), vld1q_f32(packet.az));
+    const float32x4_t u = vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(aox, px), vmulq_f32(aoy, py)), vmulq_f32(aoz, pz)), invDet);
+    valid = vandq_u32(valid, vandq_u32(vcgeq_f32(u, zero), vcleq_f32(u, one)));
+
+    const float32x4_t qx = vsubq_f32(vmulq_f32(aoy, abz), vmulq_f32(aoz, aby));
+    const float32x4_t qy = vsubq_f32(vmulq_f32(aoz, abx), vmulq_f32(aox, abz));
+    const float32x4_t qz = vsubq_f32(vmulq_f32(aox, aby), vmulq_f32(aoy, abx));
+    const float32x4_t v = vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(dx, qx), vmulq_f32(dy, qy)), vmulq_f32(dz, qz)), invDet);
+    valid = vandq_u32(valid, vandq_u32(vcgeq_f32(v, zero), vcleq_f32(vaddq_f32(u, v), one)));
+
+    const float32x4_t t = vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(acx, qx), vmulq_f32(acy, qy)), vmulq_f32(acz, qz)), invDet);
+    valid = vandq_u32(valid, vcgtq_f32(t, zero));
+    vst1q_f32(distances, vreinterpretq_f32_u32(vandq_u32(valid, vreinterpretq_u32_f32(t))));
+#else
+    for (uint32_t lane = 0; lane != LANE_COUNT; ++lane) {
+        distances[lane] = 0.F;
+        const Vec3 ab{packet.abx[lane], packet.aby[lane], packet.abz[lane]};
+        const Vec3 ac{packet.acx[lane], packet.acy[lane], packet.acz[lane]};
+        Vec3 pvec{};
+        Vec3::cross(ray.d, ac, &pvec);
+        const float det = Vec3::dot(ab, pvec);
+        if (det < math::EPSILON && (!doubleSided || det > -math::EPSILON)) {
+            continue;
+        }
+        const float invDet = 1.F / det;
+        const Vec3 ao = ray.o - Vec3{packet.ax[lane], packet.ay[lane], packet.az[lane]};
+        const float u = Vec3::dot(ao, pvec) * invDet;
+        if (u < 0 || u > 1) {
+            continue;
+        }
+        Vec3 qvec{};
+        Vec3::cross(ao, ab, &qvec);
+        const float v = Vec3::dot(ray.d, qvec) * invDet;
+        if (v < 0 || u + v > 1) {
+            continue;
+        }
+        const float t = Vec3::dot(ac, qvec) * invDet;
+        distances[lane] = t > 0 ? t : 0.F;
+    }
+#endif
+}
+
+float TriangleBVH::raycast(const Ray &ray, ERaycastMode mode, float maxDistance, bool doubleSided, ccstd::vector<IRaySubMeshResult> &hits) const {
+    if (_nodes.empty()) {
+        return 0.F;
+    }
+    struct StackEntry {
+        uint32_t node;
+        float tNear;
+    };
+    StackEntry stack[MAX_STACK_SIZE];
+    uint32_t stackSize = 0;
+
+    const Vec3 invDir{safeInverse(ray.d.x), safeInverse(ray.d.y), safeInverse(ray.d.z)};
+    float tNear = 0.F;
+    if (!rayBox(ray.o, invDir, _nodes[0].min, _nodes[0].max, &tNear)) {
+        return 0.F;
+    }
+    stack[stackSize++] = {0, tNear};
+
+    float minDis = 0.F;
+    IRaySubMeshResult closest;
+    float distances[LANE_COUNT];
+    while (stackSize) {
+        const auto entry = stack[--stackSize];
+        // nodes behind the closest hit so far can not contain a closer one
+        const float limit = (mode == ERaycastMode::CLOSEST && minDis != 0.F) ? minDis : maxDistance;
+        if (entry.tNear > limit) {
+            continue;
+        }
+        const auto &node = _nodes[entry.node];
+        if (node.count) {
+            const auto &packet = _packets[node.index];
+            intersect(packet, ray, doubleSided, distances);
+            for (uint32_t lane = 0; lane != node.count; ++lane) {
+                const float dist = distances[lane];
+                if (dist == 0.F || dist > maxDistance) {
+                    continue;
+                }
+                const IRaySubMeshResult hit{dist, packet.vertexIndex0[lane], packet.vertexIndex1[lane], packet.vertexIndex2[lane]};
+                if (mode == ERaycastMode::ANY) {
+                    hits.emplace_back(hit);
+                    return dist;
+                }
+                if (minDis == 0.F || dist < minDis) {
+                    minDis = dist;
+                    closest = hit;
+                }
+                if (mode == ERaycastMode::ALL) {
+                    hits.emplace_back(hit);
+                }
+            }
+            continue;
+        }
+
+        // push the far child first so that the near one is visited first
+        float tLeft = 0.F;
+        float tRight = 0.F;
+        const bool isLeftHit = rayBox(ray.o, invDir, _nodes[node.index].min, _nodes[node.index].max, &tLeft);
+        const bool isRightHit = rayBox(ray.o, invDir, _nodes[node.index + 1].min, _nodes[node.index + 1].max, &tRight);
+        CC_ASSERT(stackSize + 2 <= MAX_STACK_SIZE);
+        if (isLeftHit && isRightHit) {
+            const bool isLeftNear = tLeft <= tRight;
+            stack[stackSize++] = isLeftNear ? StackEntry{node.index + 1, tRight} : StackEntry{node.index, tLeft};
+            stack[stackSize++] = isLeftNear ? StackEntry{node.index, tLeft} : StackEntry{node.index + 1, tRight};
+        } else if (isLeftHit) {
+            stack[stackSize++] = {node.index, tLeft};
+        } else if (isRightHit) {
+            stack[stackSize++] = {node.index + 1, tRight};
+        }
+    }
+    if (mode == ERaycastMode::CLOSEST && minDis != 0.F) {
+        hits.emplace_back(closest);
+    }
+    return minDis;
+}
+
+} // namespace geometry
+} // namespace cc
@@ -0,0 +1,126 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "base/std/container/vector.h"
+#include "core/geometry/Spec.h"
+#include "math/Vec3.h"
+
+namespace cc {
+namespace geometry {
+
+class Ray;
+
+/**
+ * @en
+ * Bounding volume hierarchy over the triangles of a mesh, in model space.
+ * Every leaf holds up to four triangles stored as structure of arrays, so that
+ * a ray is tested against a whole leaf at once with SSE/NEON when available.
+ * @zh
+ * 模型空间下的网格三角形层次包围盒。
+ * 每个叶子节点最多包含四个以 SoA 方式存储的三角形，在支持时使用 SSE/NEON 一次测试整个叶子。
+ */
+class TriangleBVH final {
+public:
+    /**
+     * @en Number of triangles stored in a leaf and tested per iteration.
+     * @zh 每个叶子节点存储、每次迭代测试的三角形数量。
+     */
+    static constexpr uint32_t LANE_COUNT = 4;
+
+    /**
+     * @en Build the hierarchy, any previous content is discarded.
+     * @zh 构建层次包围盒，之前的内容会被丢弃。
+     * @param positions @en Vertex positions, 3 floats per vertex. @zh 顶点位置，每个顶点 3 个浮点数。
+     * @param indices @en Vertex indices, 3 per triangle. @zh 顶点索引，每个三角形 3 个。
+     * @param triangleCount @en Number of triangles. @zh 三角形数量。
+     */
+    void build(const float *positions, const uint32_t *indices, uint32_t triangleCount);
+
+    void clear();
+
+    inline bool empty() const { return _nodes.empty(); }
+    inline uint32_t getTriangleCount() const { return _triangleCount; }
+    inline uint32_t getNodeCount() const { return static_cast<uint32_t>(_nodes.size()); }
+
+    /**
+     * @en
+     * Cast a ray against the triangles, each triangle is tested with the same
+     * arithmetic as rayTriangle. Hits farther than maxDistance are ignored.
+     * ANY appends the first hit found, CLOSEST appends the closest one and ALL
+     * appends every hit, in traversal order.
+     * @zh
+     * 射线与三角形的相交检测，每个三角形的计算方式与 rayTriangle 相同，忽略距离大于 maxDistance 的结果。
+     * ANY 追加找到的第一个结果，CLOSEST 追加最近的结果，ALL 按遍历顺序追加所有结果。
+     * @return @en The distance of the closest appended hit, 0 if nothing is hit. @zh 追加结果中的最近距离，未命中时为 0。
+     */
+    float raycast(const Ray &ray, ERaycastMode mode, float maxDistance, bool doubleSided, ccstd::vector<IRaySubMeshResult> &hits) const;
+
+private:
+    struct Node {
+        Vec3 min;
+        // first child for inner nodes, the right child follows it; packet for leaves
+        uint32_t index{0};
+        Vec3 max;
+        // number of triangles in the leaf, 0 for inner nodes
+        uint32_t count{0};
+    };
+
+    // vertex a and the two edges of LANE_COUNT triangles, unused lanes are degenerate
+    struct TrianglePacket {
+        float ax[LANE_COUNT];
+        float ay[LANE_COUNT];
+        float az[LANE_COUNT];
+        float abx[LANE_COUNT];
+        float aby[LANE_COUNT];
+        float abz[LANE_COUNT];
+        float acx[LANE_COUNT];
+        float acy[LANE_COUNT];
+        float acz[LANE_COUNT];
+        uint32_t vertexIndex0[LANE_COUNT];
+        uint32_t vertexIndex1[LANE_COUNT];
+        uint32_t vertexIndex2[LANE_COUNT];
+    };
+
+    struct BuildTriangle {
+        Vec3 min;
+        Vec3 max;
+        Vec3 centroid;
+        uint32_t index{0};
+    };
+
+    // distance to every triangle of the packet, 0 for missed or unused lanes
+    static void intersect(const TrianglePacket &packet, const Ray &ray, bool doubleSided, float *distances);
+
+    void buildNode(uint32_t nodeIndex, BuildTriangle *triangles, uint32_t count, const float *positions, const uint32_t *indices);
+
+    ccstd::vector<Node> _nodes;
+    ccstd::vector<TrianglePacket> _packets;
+    uint32_t _triangleCount{0};
+};
+
+} // namespace geometry
+} // namespace cc
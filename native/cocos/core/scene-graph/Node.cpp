@@ -40,6 +40,7 @@ uint32_t Node::clearFrame{0};
 uint32_t Node::clearRound{1000};
 const uint32_t Node::TRANSFORM_ON{1 << 0};
 uint32_t Node::globalFlagChangeVersion{0};
+uint32_t Node::globalHierarchyVersion{0};
 
 namespace {
 const ccstd::string EMPTY_NODE_NAME;
@@ -65,6 +66,7 @@ Node::Node(const ccstd::string &name) {
 }
 
 Node::~Node() {
+    ++globalHierarchyVersion;
     if (!_children.empty()) {
         // Reset children's _parent to nullptr to avoid dangerous pointer
         for (const auto &child : _children) {
@@ -640,6 +642,7 @@ void Node::setAngle(float val) {
 }
 
 void Node::onSetParent(Node *oldParent, bool keepWorldTransform) {
+    ++globalHierarchyVersion;
     if (_parent) {
         if ((oldParent == nullptr || oldParent->_scene != _parent->_scene) && _parent->_scene != nullptr) {
             walk(setScene);
@@ -127,6 +127,8 @@ public:
 
     static void resetChangedFlags();
     static void clearNodeArray();
+    // increase whenever a parent-child relationship changes
+    static inline uint32_t getHierarchyVersion() { return globalHierarchyVersion; }
 
     Node();
     explicit Node(const ccstd::string &name);
@@ -135,7 +137,10 @@ public:
     virtual void onPostActivated(bool active) {}
 
     void setParent(Node *parent, bool isKeepWorld = false);
-    inline void modifyParent(Node *parent) { _parent = parent; }
+    inline void modifyParent(Node *parent) {
+        _parent = parent;
+        ++globalHierarchyVersion;
+    }
 
     inline Scene *getScene() const { return _scene; };
 
@@ -606,6 +611,7 @@ private:
 
     // increase on every frame, used to identify the frame
     static uint32_t globalFlagChangeVersion;
+    static uint32_t globalHierarchyVersion;
 
     static uint32_t clearFrame;
     static uint32_t clearRound;
@@ -648,6 +654,7 @@ private:
 
     friend class NodeActivator;
     friend class Scene;
+    friend class TransformSystem;
 
     CC_DISALLOW_COPY_MOVE_ASSIGN(Node);
 };
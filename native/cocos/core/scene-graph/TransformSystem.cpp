@@ -0,0 +1,219 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#include "core/scene-graph/TransformSystem.h"
+#include "core/scene-graph/Node.h"
+#include "profiler/Profiler.h"
+
+namespace cc {
+
+namespace {
+TransformSystem *instance = nullptr;
+} // namespace
+
+TransformSystem *TransformSystem::getInstance() {
+    if (instance == nullptr) {
+        instance = ccnew TransformSystem();
+    }
+    return instance;
+}
+
+void TransformSystem::destroyInstance() {
+    CC_SAFE_DELETE(instance);
+}
+
+void TransformSystem::addRoot(Node *root) {
+    if (root == nullptr || std::find(_roots.begin(), _roots.end(), root) != _roots.end()) {
+        return;
+    }
+    _roots.emplace_back(root);
+    _hierarchyVersion = Node::getHierarchyVersion() - 1;
+}
+
+void TransformSystem::removeRoot(Node *root) {
+    auto iter = std::find(_roots.begin(), _roots.end(), root);
+    if (iter != _roots.end()) {
+        _roots.erase(iter);
+        _hierarchyVersion = Node::getHierarchyVersion() - 1;
+    }
+}
+
+void TransformSystem::clearRoots() {
+    _roots.clear();
+    _nodes.clear();
+    _parents.clear();
+    _levelOffsets.clear();
+}
+
+void TransformSystem::rebuild() {
+    CC_PROFILE(TransformSystemRebuild);
+    _nodes.clear();
+    _parents.clear();
+    _levelOffsets.clear();
+
+    for (const auto &root : _roots) {
+        _nodes.emplace_back(root.get());
+        _parents.emplace_back(-1);
+    }
+
+    // Breadth first, so that each level is a contiguous range.
+    size_t levelBegin = 0;
+    _levelOffsets.emplace_back(0);
+    while (levelBegin < _nodes.size()) {
+        const size_t levelEnd = _nodes.size();
+        _levelOffsets.emplace_back(static_cast<uint32_t>(levelEnd));
+        for (size_t i = levelBegin; i < levelEnd; ++i) {
+            for (const auto &child : _nodes[i]->getChildren()) {
+                _nodes.emplace_back(child.get());
+                _parents.emplace_back(static_cast<int32_t>(i));
+            }
+        }
+        levelBegin = levelEnd;
+    }
+
+    const size_t count = _nodes.size();
+    _localPositions.resize(count);
+    _localRotations.resize(count);
+    _localScales.resize(count);
+    _worldMatrices.resize(count);
+    _dirtyBits.assign(count, 0);
+
+    _hierarchyVersion = Node::getHierarchyVersion();
+}
+
+void TransformSystem::update() {
+    if (!_enabled || _roots.empty()) {
+        return;
+    }
+    CC_PROFILE(TransformSystemUpdate);
+
+    if (_hierarchyVersion != Node::getHierarchyVersion()) {
+        rebuild();
+    }
+
+    // Roots may be attached to a parent that isn't managed here.
+    for (const auto &root : _roots) {
+        if (root->getParent()) {
+            root->getParent()->updateWorldTransform();
+        }
+    }
+
+    _updatedNodeCount = 0;
+    for (size_t level = 0; level + 1 < _levelOffsets.size(); ++level) {
+        updateLevel(_levelOffsets[level], _levelOffsets[level + 1]);
+    }
+
+    CC_PROFILE_OBJECT_UPDATE(TransformSystemNodes, _nodes.size());
+    CC_PROFILE_OBJECT_UPDATE(TransformSystemUpdatedNodes, _updatedNodeCount);
+}
+
+void TransformSystem::updateLevel(uint32_t begin, uint32_t end) {
+    constexpr auto positionBit = static_cast<uint32_t>(TransformBit::POSITION);
+    constexpr auto rotationBit = static_cast<uint32_t>(TransformBit::ROTATION);
+    constexpr auto scaleBit = static_cast<uint32_t>(TransformBit::SCALE);
+    constexpr auto rsBits = static_cast<uint32_t>(TransformBit::RS);
+
+    // Gather the dirty nodes of this level and their local transforms.
+    _dirtyIndices.clear();
+    for (uint32_t i = begin; i < end; ++i) {
+        const Node *node = _nodes[i];
+        const int32_t parent = _parents[i];
+        uint32_t bits = node->_transformFlags;
+        if (parent >= 0) {
+            bits |= _dirtyBits[parent];
+        }
+        _dirtyBits[i] = bits;
+        if (!bits) {
+            continue;
+        }
+        _localPositions[i] = node->_localPosition;
+        _localRotations[i] = node->_localRotation;
+        _localScales[i] = node->_localScale;
+        if (!(bits & rsBits)) {
+            _worldMatrices[i] = node->_worldMatrix;
+        }
+        _dirtyIndices.emplace_back(i);
+    }
+    if (_dirtyIndices.empty()) {
+        return;
+    }
+
+    // Resolve world matrices. A clean parent has a valid cache in its node,
+    // a dirty one has already been resolved while processing the previous level.
+    for (const uint32_t i : _dirtyIndices) {
+        const uint32_t bits = _dirtyBits[i];
+        const int32_t parent = _parents[i];
+        const Node *parentNode = parent >= 0 ? _nodes[parent] : _nodes[i]->getParent();
+        Mat4 &world = _worldMatrices[i];
+        if (parentNode) {
+            const Mat4 &parentWorld = (parent >= 0 && _dirtyBits[parent]) ? _worldMatrices[parent] : parentNode->_worldMatrix;
+            if (bits & positionBit) {
+                Vec3 worldPosition;
+                worldPosition.transformMat4(_localPositions[i], parentWorld);
+                world.m[12] = worldPosition.x;
+                world.m[13] = worldPosition.y;
+                world.m[14] = worldPosition.z;
+            }
+            if (bits & rsBits) {
+                Mat4::fromRTS(_localRotations[i], _localPositions[i], _localScales[i], &world);
+                Mat4::multiply(parentWorld, world, &world);
+            }
+        } else {
+            if (bits & positionBit) {
+                world.m[12] = _localPositions[i].x;
+                world.m[13] = _localPositions[i].y;
+                world.m[14] = _localPositions[i].z;
+            }
+            if (bits & rsBits) {
+                Mat4::fromRTS(_localRotations[i], _localPositions[i], _localScales[i], &world);
+            }
+        }
+    }
+
+    // Write the results back to the nodes.
+    for (const uint32_t i : _dirtyIndices) {
+        const uint32_t bits = _dirtyBits[i];
+        Node *node = _nodes[i];
+        const Mat4 &world = _worldMatrices[i];
+        node->_worldMatrix = world;
+        node->_worldPosition.set(world.m[12], world.m[13], world.m[14]);
+        if (bits & rsBits) {
+            if (node->getParent()) {
+                Quaternion *rotation = (bits & rotationBit) ? &node->_worldRotation : nullptr;
+                Mat4::toRTS(world, rotation, nullptr, &node->_worldScale);
+            } else {
+                if (bits & rotationBit) {
+                    node->_worldRotation.set(_localRotations[i]);
+                }
+                if (bits & scaleBit) {
+                    node->_worldScale.set(_localScales[i]);
+                }
+            }
+        }
+        node->_transformFlags = 0;
+    }
+    _updatedNodeCount += static_cast<uint32_t>(_dirtyIndices.size());
+}
+
+} // namespace cc
@@ -0,0 +1,99 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include "base/Macros.h"
+#include "base/Ptr.h"
+#include "base/std/container/vector.h"
+#include "math/Mat4.h"
+#include "math/Quaternion.h"
+#include "math/Vec3.h"
+
+namespace cc {
+
+class Node;
+
+/**
+ * @en Optional data-oriented world transform propagation.
+ * Nodes under the registered roots are flattened into depth-sorted structure-of-arrays buffers,
+ * dirty transforms are then resolved level by level in a single pass per frame.
+ * Node keeps its API, its getters simply find the world transform already up to date.
+ * @zh 可选的面向数据的世界变换更新系统。
+ * 注册的根节点下的所有节点按深度排序存放在 SoA 缓冲中，每帧按层级一次性更新所有脏节点的世界变换。
+ * Node 的接口保持不变，访问世界变换时数据已经是最新的。
+ */
+class TransformSystem final {
+public:
+    static TransformSystem *getInstance();
+    static void destroyInstance();
+
+    TransformSystem() = default;
+    ~TransformSystem() = default;
+
+    void addRoot(Node *root);
+    void removeRoot(Node *root);
+    void clearRoots();
+
+    /**
+     * @en Resolve the dirty world transforms of all registered hierarchies.
+     * @zh 更新所有注册节点树中脏节点的世界变换。
+     */
+    void update();
+
+    inline void setEnabled(bool enabled) { _enabled = enabled; }
+    inline bool isEnabled() const { return _enabled; }
+    inline uint32_t getNodeCount() const { return static_cast<uint32_t>(_nodes.size()); }
+    inline uint32_t getLevelCount() const { return _levelOffsets.empty() ? 0 : static_cast<uint32_t>(_levelOffsets.size() - 1); }
+    inline uint32_t getUpdatedNodeCount() const { return _updatedNodeCount; }
+
+private:
+    void rebuild();
+    void updateLevel(uint32_t begin, uint32_t end);
+
+    ccstd::vector<IntrusivePtr<Node>> _roots;
+
+    // Depth sorted, every node is stored after its parent and nodes of the same depth are contiguous.
+    ccstd::vector<Node *> _nodes;
+    ccstd::vector<int32_t> _parents;
+    ccstd::vector<uint32_t> _levelOffsets;
+
+    // Transform data, indexed like _nodes.
+    ccstd::vector<Vec3> _localPositions;
+    ccstd::vector<Quaternion> _localRotations;
+    ccstd::vector<Vec3> _localScales;
+    ccstd::vector<Mat4> _worldMatrices;
+    ccstd::vector<uint32_t> _dirtyBits;
+
+    // Dirty nodes of the level being processed.
+    ccstd::vector<uint32_t> _dirtyIndices;
+
+    uint32_t _hierarchyVersion{0};
+    uint32_t _updatedNodeCount{0};
+    bool _enabled{false};
+
+    CC_DISALLOW_COPY_MOVE_ASSIGN(TransformSystem);
+};
+
+} // namespace cc
@@ -24,6 +24,9 @@
 ****************************************************************************/
 
 #include "LightProbe.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include "PolynomialSolver.h"
 #include "core/Root.h"
 #include "core/scene-graph/Node.h"
@@ -35,6 +38,15 @@
 namespace cc {
 namespace gi {
 
+namespace {
+// Upper bound of the cells per axis of the lookup grid, the grid aims at one inner tetrahedron per cell.
+constexpr uint32_t LOOKUP_GRID_MAX_SIZE = 64;
+
+inline bool isInside(const Vec4 &weights) {
+    return weights.x >= 0.0F && weights.y >= 0.0F && weights.z >= 0.0F && weights.w >= 0.0F;
+}
+} // namespace
+
 void LightProbesData::updateProbes(ccstd::vector<Vec3> &points) {
     _probes.clear();
 
@@ -43,11 +55,13 @@ void LightProbesData::updateProbes(ccstd::vector<Vec3> &points) {
     for (auto i = 0; i < pointCount; i++) {
         _probes.emplace_back(points[i]);
     }
+    invalidateLookupGrid();
 }
 
 void LightProbesData::updateTetrahedrons() {
     Delaunay delaunay(_probes);
     _tetrahedrons = delaunay.build();
+    invalidateLookupGrid();
 }
 
 bool LightProbesData::getInterpolationSHCoefficients(int32_t tetIndex, const Vec4 &weights, ccstd::vector<Vec3> &coefficients) const {
@@ -55,9 +69,25 @@ bool LightProbesData::getInterpolationSHCoefficients(int32_t tetIndex, const Vec
         return false;
     }
 
+    coefficients.resize(SH::getBasisCount());
+    interpolateSHCoefficients(tetIndex, weights, coefficients.data());
+    return true;
+}
+
+bool LightProbesData::getInterpolationSHCoefficients(const int32_t *tetIndices, const Vec4 *weights, uint32_t count, Vec3 *coefficients) const {
+    if (!hasCoefficients()) {
+        return false;
+    }
+
     const auto length = SH::getBasisCount();
-    coefficients.resize(length);
+    for (uint32_t i = 0; i < count; i++) {
+        interpolateSHCoefficients(tetIndices[i], weights[i], coefficients + i * length);
+    }
+    return true;
+}
 
+void LightProbesData::interpolateSHCoefficients(int32_t tetIndex, const Vec4 &weights, Vec3 *coefficients) const {
+    const auto length = SH::getBasisCount();
     const auto &tetrahedron = _tetrahedrons[tetIndex];
     const auto &c0 = _probes[tetrahedron.vertex0].coefficients;
     const auto &c1 = _probes[tetrahedron.vertex1].coefficients;
@@ -74,11 +104,32 @@ bool LightProbesData::getInterpolationSHCoefficients(int32_t tetIndex, const Vec
             coefficients[i] = c0[i] * weights.x + c1[i] * weights.y + c2[i] * weights.z;
         }
     }
-
-    return true;
 }
 
 int32_t LightProbesData::getInterpolationWeights(const Vec3 &position, int32_t tetIndex, Vec4 &weights) const {
+    return findTetrahedron(*getLookupGrid(), position, tetIndex, weights);
+}
+
+void LightProbesData::getInterpolationWeights(const Vec3 *positions, int32_t *tetIndices, Vec4 *weights, uint32_t count) const {
+    const auto grid = getLookupGrid();
+    for (uint32_t i = 0; i < count; i++) {
+        tetIndices[i] = findTetrahedron(*grid, positions[i], tetIndices[i], weights[i]);
+    }
+}
+
+int32_t LightProbesData::findTetrahedron(const LookupGrid &grid, const Vec3 &position, int32_t tetIndex, Vec4 &weights) const {
+    // models usually stay in the same tetrahedron between two updates
+    if (tetIndex >= 0 && tetIndex < static_cast<int32_t>(_tetrahedrons.size())) {
+        getBarycentricCoord(position, _tetrahedrons[tetIndex], weights);
+        if (isInside(weights)) {
+            return tetIndex;
+        }
+    }
+
+    return walkTetrahedrons(position, grid.getStartTetrahedron(position), weights);
+}
+
+int32_t LightProbesData::walkTetrahedrons(const Vec3 &position, int32_t tetIndex, Vec4 &weights) const {
     const auto tetrahedronCount = _tetrahedrons.size();
     if (tetIndex < 0 || tetIndex >= tetrahedronCount) {
         tetIndex = 0;
@@ -90,7 +141,7 @@ int32_t LightProbesData::getInterpolationWeights(const Vec3 &position, int32_t t
     for (auto i = 0; i < tetrahedronCount; i++) {
         const auto &tetrahedron = _tetrahedrons[tetIndex];
         getBarycentricCoord(position, tetrahedron, weights);
-        if (weights.x >= 0.0F && weights.y >= 0.0F && weights.z >= 0.0F && weights.w >= 0.0F) {
+        if (isInside(weights)) {
             break;
         }
 
@@ -105,7 +156,7 @@ int32_t LightProbesData::getInterpolationWeights(const Vec3 &position, int32_t t
         }
 
         // return directly due to numerical precision error
-        if (lastIndex == nextIndex) {
+        if (lastIndex == nextIndex || nextIndex < 0) {
             break;
         }
 
@@ -116,6 +167,114 @@ int32_t LightProbesData::getInterpolationWeights(const Vec3 &position, int32_t t
     return tetIndex;
 }
 
+int32_t LightProbesData::LookupGrid::getStartTetrahedron(const Vec3 &position) const {
+    if (cells.empty()) {
+        return 0;
+    }
+
+    // std::max(0, NaN) is 0, so the cast below stays in range
+    const auto x = static_cast<uint32_t>(std::min(std::max(0.0F, (position.x - min.x) * cellScale.x), static_cast<float>(size[0] - 1)));
+    const auto y = static_cast<uint32_t>(std::min(std::max(0.0F, (position.y - min.y) * cellScale.y), static_cast<float>(size[1] - 1)));
+    const auto z = static_cast<uint32_t>(std::min(std::max(0.0F, (position.z - min.z) * cellScale.z), static_cast<float>(size[2] - 1)));
+    return cells[x + size[0] * (y + size[1] * z)];
+}
+
+std::shared_ptr<const LightProbesData::LookupGrid> LightProbesData::getLookupGrid() const {
+    // a stale grid only gives worse starting tetrahedrons, the walk still ends in the right one
+    const auto isValid = [this](const std::shared_ptr<const LookupGrid> &grid) {
+        return grid && grid->tetrahedrons == _tetrahedrons.data() && grid->tetrahedronCount == _tetrahedrons.size();
+    };
+
+    auto grid = std::atomic_load(&_lookupGrid);
+    if (isValid(grid)) {
+        return grid;
+    }
+
+    std::lock_guard<std::mutex> lock(_lookupGridMutex);
+    grid = std::atomic_load(&_lookupGrid);
+    if (!isValid(grid)) {
+        grid = buildLookupGrid();
+        std::atomic_store(&_lookupGrid, grid);
+    }
+    return grid;
+}
+
+std::shared_ptr<const LightProbesData::LookupGrid> LightProbesData::buildLookupGrid() const {
+    auto grid = std::make_shared<LookupGrid>();
+    grid->tetrahedrons = _tetrahedrons.data();
+    grid->tetrahedronCount = _tetrahedrons.size();
+    if (empty()) {
+        return grid;
+    }
+
+    Vec3 min = _probes[0].position;
+    Vec3 max = _probes[0].position;
+    for (const auto &probe : _probes) {
+        Vec3::min(min, probe.position, &min);
+        Vec3::max(max, probe.position, &max);
+    }
+    const auto innerCount = std::count_if(_tetrahedrons.begin(), _tetrahedrons.end(), [](const Tetrahedron &tetrahedron) {
+        return tetrahedron.isInnerTetrahedron();
+    });
+
+    // cubic cells over the non degenerated axes, one inner tetrahedron per cell on average
+    const Vec3 extent = max - min;
+    const float extents[3] = {extent.x, extent.y, extent.z};
+    float volume = 1.0F;
+    int32_t dimension = 0;
+    for (const float e : extents) {
+        if (e > mathutils::EPSILON) {
+            volume *= e;
+            dimension++;
+        }
+    }
+    const float cellSize = dimension > 0 ? std::pow(volume / static_cast<float>(std::max<ptrdiff_t>(innerCount, 1)), 1.0F / static_cast<float>(dimension)) : 1.0F;
+
+    float cellScale[3] = {0.0F, 0.0F, 0.0F};
+    for (uint32_t axis = 0; axis < 3; axis++) {
+        if (extents[axis] > mathutils::EPSILON) {
+            const auto size = static_cast<uint32_t>(std::ceil(extents[axis] / cellSize));
+            grid->size[axis] = std::min(std::max(size, 1U), LOOKUP_GRID_MAX_SIZE);
+            cellScale[axis] = static_cast<float>(grid->size[axis]) / extents[axis];
+        }
+    }
+    grid->min = min;
+    grid->cellScale.set(cellScale[0], cellScale[1], cellScale[2]);
+    grid->cells.resize(grid->size[0] * grid->size[1] * grid->size[2]);
+
+    // neighbouring cells are close, start each walk from the previous cell
+    const uint32_t sizeX = grid->size[0];
+    const uint32_t sizeXY = grid->size[0] * grid->size[1];
+    Vec4 weights;
+    int32_t tetIndex = 0;
+    for (uint32_t z = 0; z < grid->size[2]; z++) {
+        for (uint32_t y = 0; y < grid->size[1]; y++) {
+            for (uint32_t x = 0; x < grid->size[0]; x++) {
+                const uint32_t index = x + sizeX * y + sizeXY * z;
+                if (x == 0 && y > 0) {
+                    tetIndex = grid->cells[index - sizeX];
+                } else if (x == 0 && z > 0) {
+                    tetIndex = grid->cells[index - sizeXY];
+                }
+
+                const Vec3 center{
+                    min.x + (static_cast<float>(x) + 0.5F) * extent.x / static_cast<float>(grid->size[0]),
+                    min.y + (static_cast<float>(y) + 0.5F) * extent.y / static_cast<float>(grid->size[1]),
+                    min.z + (static_cast<float>(z) + 0.5F) * extent.z / static_cast<float>(grid->size[2])};
+                tetIndex = walkTetrahedrons(center, tetIndex, weights);
+                grid->cells[index] = tetIndex;
+            }
+        }
+    }
+
+    return grid;
+}
+
+void LightProbesData::invalidateLookupGrid() {
+    std::lock_guard<std::mutex> lock(_lookupGridMutex);
+    std::atomic_store(&_lookupGrid, std::shared_ptr<const LookupGrid>());
+}
+
 Vec3 LightProbesData::getTriangleBarycentricCoord(const Vec3 &p0, const Vec3 &p1, const Vec3 &p2, const Vec3 &position) {
     Vec3 normal;
     Vec3::cross(p1 - p0, p2 - p0, &normal);
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include "Delaunay.h"
 #include "SH.h"
 #include "base/Macros.h"
@@ -47,14 +49,21 @@ public:
     LightProbesData() = default;
 
     inline ccstd::vector<Vertex> &getProbes() { return _probes; }
-    inline void setProbes(const ccstd::vector<Vertex> &probes) { _probes = probes; }
+    inline void setProbes(const ccstd::vector<Vertex> &probes) {
+        _probes = probes;
+        invalidateLookupGrid();
+    }
     inline ccstd::vector<Tetrahedron> &getTetrahedrons() { return _tetrahedrons; }
-    inline void setTetrahedrons(const ccstd::vector<Tetrahedron> &tetrahedrons) { _tetrahedrons = tetrahedrons; }
+    inline void setTetrahedrons(const ccstd::vector<Tetrahedron> &tetrahedrons) {
+        _tetrahedrons = tetrahedrons;
+        invalidateLookupGrid();
+    }
 
     inline bool empty() const { return _probes.empty() || _tetrahedrons.empty(); }
     inline void reset() {
         _probes.clear();
         _tetrahedrons.clear();
+        invalidateLookupGrid();
     }
     void updateProbes(ccstd::vector<Vec3> &points);
     void updateTetrahedrons();
@@ -63,11 +72,51 @@ public:
     bool getInterpolationSHCoefficients(int32_t tetIndex, const Vec4 &weights, ccstd::vector<Vec3> &coefficients) const;
     int32_t getInterpolationWeights(const Vec3 &position, int32_t tetIndex, Vec4 &weights) const;
 
+    /**
+     * @en Resolve the tetrahedrons and interpolation weights of several positions at once.
+     * tetIndices holds the last tetrahedron of each position on input, -1 if unknown, and the resolved one on output.
+     * @zh 批量计算多个位置所在的四面体和插值权重。
+     * tetIndices 输入每个位置上次所在的四面体，未知时为 -1，输出计算得到的四面体。
+     */
+    void getInterpolationWeights(const Vec3 *positions, int32_t *tetIndices, Vec4 *weights, uint32_t count) const;
+
+    /**
+     * @en Interpolate the SH coefficients of several positions at once,
+     * SH::getBasisCount() coefficients are written per position.
+     * @zh 批量插值多个位置的球谐系数，每个位置写入 SH::getBasisCount() 个系数。
+     */
+    bool getInterpolationSHCoefficients(const int32_t *tetIndices, const Vec4 *weights, uint32_t count, Vec3 *coefficients) const;
+
 private:
+    // Uniform grid over the probes, each cell stores the tetrahedron containing its center,
+    // so that a lookup walks from next to the position instead of from an arbitrary tetrahedron.
+    struct LookupGrid {
+        const Tetrahedron *tetrahedrons{nullptr};
+        size_t tetrahedronCount{0};
+        Vec3 min;
+        Vec3 cellScale;
+        uint32_t size[3]{1, 1, 1};
+        ccstd::vector<int32_t> cells;
+
+        int32_t getStartTetrahedron(const Vec3 &position) const;
+    };
+
     static Vec3 getTriangleBarycentricCoord(const Vec3 &p0, const Vec3 &p1, const Vec3 &p2, const Vec3 &position);
     void getBarycentricCoord(const Vec3 &position, const Tetrahedron &tetrahedron, Vec4 &weights) const;
     void getTetrahedronBarycentricCoord(const Vec3 &position, const Tetrahedron &tetrahedron, Vec4 &weights) const;
     void getOuterCellBarycentricCoord(const Vec3 &position, const Tetrahedron &tetrahedron, Vec4 &weights) const;
+    int32_t walkTetrahedrons(const Vec3 &position, int32_t tetIndex, Vec4 &weights) const;
+    int32_t findTetrahedron(const LookupGrid &grid, const Vec3 &position, int32_t tetIndex, Vec4 &weights) const;
+    void interpolateSHCoefficients(int32_t tetIndex, const Vec4 &weights, Vec3 *coefficients) const;
+
+    // _probes and _tetrahedrons are also deserialized directly, so the grid is built lazily
+    // and rebuilt when the tetrahedrons it was built from are replaced.
+    std::shared_ptr<const LookupGrid> getLookupGrid() const;
+    std::shared_ptr<const LookupGrid> buildLookupGrid() const;
+    void invalidateLookupGrid();
+
+    mutable std::shared_ptr<const LookupGrid> _lookupGrid;
+    mutable std::mutex _lookupGridMutex;
 
 public:
     ccstd::vector<Vertex> _probes;
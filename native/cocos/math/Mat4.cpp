@@ -410,11 +410,7 @@ void Mat4::add(float scalar) {
 
 void Mat4::add(float scalar, Mat4 *dst) {
     CC_ASSERT(dst);
-#ifdef __SSE__
-    MathUtil::addMatrix(col, scalar, dst->col);
-#else
     MathUtil::addMatrix(m, scalar, dst->m);
-#endif
 }
 
 void Mat4::add(const Mat4 &mat) {
@@ -423,11 +419,7 @@ void Mat4::add(const Mat4 &mat) {
 
 void Mat4::add(const Mat4 &m1, const Mat4 &m2, Mat4 *dst) {
     CC_ASSERT(dst);
-#ifdef __SSE__
-    MathUtil::addMatrix(m1.col, m2.col, dst->col);
-#else
     MathUtil::addMatrix(m1.m, m2.m, dst->m);
-#endif
 }
 
 void Mat4::fromRT(const Quaternion &rotation, const Vec3 &translation, Mat4 *dst) {
@@ -825,11 +817,7 @@ void Mat4::multiply(float scalar, Mat4 *dst) const {
 
 void Mat4::multiply(const Mat4 &m, float scalar, Mat4 *dst) {
     CC_ASSERT(dst);
-#ifdef __SSE__
-    MathUtil::multiplyMatrix(m.col, scalar, dst->col);
-#else
     MathUtil::multiplyMatrix(m.m, scalar, dst->m);
-#endif
 }
 
 void Mat4::multiply(const Mat4 &mat) {
@@ -838,19 +826,16 @@ void Mat4::multiply(const Mat4 &mat) {
 
 void Mat4::multiply(const Mat4 &m1, const Mat4 &m2, Mat4 *dst) {
     CC_ASSERT(dst);
-#ifdef __SSE__
-    MathUtil::multiplyMatrix(m1.col, m2.col, dst->col);
-#else
     MathUtil::multiplyMatrix(m1.m, m2.m, dst->m);
-#endif
+}
+
+void Mat4::multiply(const Mat4 *m1, const Mat4 *m2, Mat4 *dst, uint32_t count) {
+    CC_ASSERT(m1 && m2 && dst);
+    MathUtil::multiplyMatrices(m1->m, m2->m, dst->m, count);
 }
 
 void Mat4::negate() {
-#ifdef __SSE__
-    MathUtil::negateMatrix(col, col);
-#else
     MathUtil::negateMatrix(m, m);
-#endif
 }
 
 Mat4 Mat4::getNegated() const {
@@ -983,11 +968,7 @@ void Mat4::subtract(const Mat4 &mat) {
 
 void Mat4::subtract(const Mat4 &m1, const Mat4 &m2, Mat4 *dst) {
     CC_ASSERT(dst);
-#ifdef __SSE__
-    MathUtil::subtractMatrix(m1.col, m2.col, dst->col);
-#else
     MathUtil::subtractMatrix(m1.m, m2.m, dst->m);
-#endif
 }
 
 void Mat4::transformVector(Vec4 *vector) const {
@@ -997,11 +978,12 @@ void Mat4::transformVector(Vec4 *vector) const {
 
 void Mat4::transformVector(const Vec4 &vector, Vec4 *dst) const {
     CC_ASSERT(dst);
-#ifdef __SSE__
-    MathUtil::transformVec4(col, vector.v, dst->v);
-#else
     MathUtil::transformVec4(m, reinterpret_cast<const float *>(&vector), reinterpret_cast<float *>(dst));
-#endif
+}
+
+void Mat4::transformVectors(const Vec4 *vectors, Vec4 *dst, uint32_t count) const {
+    CC_ASSERT(vectors && dst);
+    MathUtil::transformVec4s(m, reinterpret_cast<const float *>(vectors), reinterpret_cast<float *>(dst), count);
 }
 
 void Mat4::translate(float x, float y, float z) {
@@ -1023,11 +1005,7 @@ void Mat4::translate(const Vec3 &t, Mat4 *dst) const {
 }
 
 void Mat4::transpose() {
-#ifdef __SSE__
-    MathUtil::transposeMatrix(col, col);
-#else
     MathUtil::transposeMatrix(m, m);
-#endif
 }
 
 Mat4 Mat4::getTransposed() const {
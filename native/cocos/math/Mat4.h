@@ -27,11 +27,6 @@
 #include "math/Vec3.h"
 #include "math/Vec4.h"
 
-#undef __SSE__
-#ifdef __SSE__
-    #include <xmmintrin.h>
-#endif
-
 /**
  * @addtogroup base
  * @{
@@ -93,15 +88,10 @@ public:
      * |m[1]  m[5]  m[9]  m[13]|
      * |m[2]  m[6]  m[10] m[14]|
      * |m[3]  m[7]  m[11] m[15]|
+     * Kept as plain floats (no 16 bytes alignment) since the layout is shared with scripts,
+     * the SIMD paths in MathUtil use unaligned loads instead.
      */
-#ifdef __SSE__
-    union {
-        __m128 col[4];
-        float m[16];
-    };
-#else
     float m[16];
-#endif
 
     /**
      * Default constructor.
@@ -569,6 +559,16 @@ public:
      */
     static void multiply(const Mat4 &m1, const Mat4 &m2, Mat4 *dst);
 
+    /**
+     * Multiplies m1[i] by m2[i] and stores the result in dst[i] for each i in [0, count).
+     *
+     * @param m1 The first matrices to multiply.
+     * @param m2 The second matrices to multiply.
+     * @param dst The matrices to store the results in, may alias m1 or m2.
+     * @param count The number of matrices.
+     */
+    static void multiply(const Mat4 *m1, const Mat4 *m2, Mat4 *dst, uint32_t count);
+
     /**
      * Negates this matrix.
      */
@@ -803,6 +803,15 @@ public:
      */
     void transformVector(const Vec4 &vector, Vec4 *dst) const;
 
+    /**
+     * Transforms count vectors by this matrix.
+     *
+     * @param vectors The vectors to transform.
+     * @param dst The vectors to store the transformed points in, may alias vectors.
+     * @param count The number of vectors.
+     */
+    void transformVectors(const Vec4 *vectors, Vec4 *dst, uint32_t count) const;
+
     /**
      * Post-multiplies this matrix by the matrix corresponding to the
      * specified translation.
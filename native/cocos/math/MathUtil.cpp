@@ -48,7 +48,7 @@ This file was modified to fit the cocos2d-x project
     #endif
 #endif
 
-#if defined(__SSE__)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
     #define USE_SSE
     #define INCLUDE_SSE
 #endif
@@ -124,6 +124,8 @@ void MathUtil::addMatrix(const float *m, float scalar, float *dst) {
     MathUtilNeon::addMatrix(m, scalar, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::addMatrix(m, scalar, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::addMatrix(m, scalar, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::addMatrix(m, scalar, dst);
@@ -140,6 +142,8 @@ void MathUtil::addMatrix(const float *m1, const float *m2, float *dst) {
     MathUtilNeon::addMatrix(m1, m2, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::addMatrix(m1, m2, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::addMatrix(m1, m2, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::addMatrix(m1, m2, dst);
@@ -156,6 +160,8 @@ void MathUtil::subtractMatrix(const float *m1, const float *m2, float *dst) {
     MathUtilNeon::subtractMatrix(m1, m2, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::subtractMatrix(m1, m2, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::subtractMatrix(m1, m2, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::subtractMatrix(m1, m2, dst);
@@ -172,6 +178,8 @@ void MathUtil::multiplyMatrix(const float *m, float scalar, float *dst) {
     MathUtilNeon::multiplyMatrix(m, scalar, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::multiplyMatrix(m, scalar, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::multiplyMatrix(m, scalar, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::multiplyMatrix(m, scalar, dst);
@@ -188,6 +196,8 @@ void MathUtil::multiplyMatrix(const float *m1, const float *m2, float *dst) {
     MathUtilNeon::multiplyMatrix(m1, m2, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::multiplyMatrix(m1, m2, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::multiplyMatrix(m1, m2, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::multiplyMatrix(m1, m2, dst);
@@ -204,6 +214,8 @@ void MathUtil::negateMatrix(const float *m, float *dst) {
     MathUtilNeon::negateMatrix(m, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::negateMatrix(m, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::negateMatrix(m, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::negateMatrix(m, dst);
@@ -220,6 +232,8 @@ void MathUtil::transposeMatrix(const float *m, float *dst) {
     MathUtilNeon::transposeMatrix(m, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::transposeMatrix(m, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::transposeMatrix(m, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::transposeMatrix(m, dst);
@@ -236,6 +250,8 @@ void MathUtil::transformVec4(const float *m, float x, float y, float z, float w,
     MathUtilNeon::transformVec4(m, x, y, z, w, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::transformVec4(m, x, y, z, w, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::transformVec4(m, x, y, z, w, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::transformVec4(m, x, y, z, w, dst);
@@ -252,6 +268,8 @@ void MathUtil::transformVec4(const float *m, const float *v, float *dst) {
     MathUtilNeon::transformVec4(m, v, dst);
 #elif defined(USE_NEON64)
     MathUtilNeon64::transformVec4(m, v, dst);
+#elif defined(USE_SSE)
+    MathUtilSSE::transformVec4(m, v, dst);
 #elif defined(INCLUDE_NEON32)
     if (isNeon32Enabled()) {
         MathUtilNeon::transformVec4(m, v, dst);
@@ -279,6 +297,60 @@ void MathUtil::crossVec3(const float *v1, const float *v2, float *dst) {
 #endif
 }
 
+namespace {
+
+template <typename Impl>
+void multiplyMatricesImpl(const float *m1, const float *m2, float *dst, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        Impl::multiplyMatrix(m1 + i * 16, m2 + i * 16, dst + i * 16);
+    }
+}
+
+template <typename Impl>
+void transformVec4sImpl(const float *m, const float *v, float *dst, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        Impl::transformVec4(m, v + i * 4, dst + i * 4);
+    }
+}
+
+} // namespace
+
+void MathUtil::multiplyMatrices(const float *m1, const float *m2, float *dst, uint32_t count) {
+#ifdef USE_NEON32
+    multiplyMatricesImpl<MathUtilNeon>(m1, m2, dst, count);
+#elif defined(USE_NEON64)
+    multiplyMatricesImpl<MathUtilNeon64>(m1, m2, dst, count);
+#elif defined(USE_SSE)
+    multiplyMatricesImpl<MathUtilSSE>(m1, m2, dst, count);
+#elif defined(INCLUDE_NEON32)
+    if (isNeon32Enabled()) {
+        multiplyMatricesImpl<MathUtilNeon>(m1, m2, dst, count);
+    } else {
+        multiplyMatricesImpl<MathUtilC>(m1, m2, dst, count);
+    }
+#else
+    multiplyMatricesImpl<MathUtilC>(m1, m2, dst, count);
+#endif
+}
+
+void MathUtil::transformVec4s(const float *m, const float *v, float *dst, uint32_t count) {
+#ifdef USE_NEON32
+    transformVec4sImpl<MathUtilNeon>(m, v, dst, count);
+#elif defined(USE_NEON64)
+    transformVec4sImpl<MathUtilNeon64>(m, v, dst, count);
+#elif defined(USE_SSE)
+    MathUtilSSE::transformVec4s(m, v, dst, count);
+#elif defined(INCLUDE_NEON32)
+    if (isNeon32Enabled()) {
+        transformVec4sImpl<MathUtilNeon>(m, v, dst, count);
+    } else {
+        transformVec4sImpl<MathUtilC>(m, v, dst, count);
+    }
+#else
+    transformVec4sImpl<MathUtilC>(m, v, dst, count);
+#endif
+}
+
 void MathUtil::combineHash(size_t &seed, const size_t &v) {
     seed ^= v + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
@@ -23,10 +23,7 @@
 #ifndef MATHUTIL_H_
 #define MATHUTIL_H_
 
-#ifdef __SSE__
-    #include <xmmintrin.h>
-#endif
-
+#include <cstdint>
 #include "math/MathBase.h"
 
 /**
@@ -101,23 +98,6 @@ private:
     static bool isNeon64Enabled();
 
 private:
-#ifdef __SSE__
-    static void addMatrix(const __m128 m[4], float scalar, __m128 dst[4]);
-
-    static void addMatrix(const __m128 m1[4], const __m128 m2[4], __m128 dst[4]);
-
-    static void subtractMatrix(const __m128 m1[4], const __m128 m2[4], __m128 dst[4]);
-
-    static void multiplyMatrix(const __m128 m[4], float scalar, __m128 dst[4]);
-
-    static void multiplyMatrix(const __m128 m1[4], const __m128 m2[4], __m128 dst[4]);
-
-    static void negateMatrix(const __m128 m[4], __m128 dst[4]);
-
-    static void transposeMatrix(const __m128 m[4], __m128 dst[4]);
-
-    static void transformVec4(const __m128 m[4], const __m128 &v, __m128 &dst);
-#endif
     static void addMatrix(const float *m, float scalar, float *dst);
 
     static void addMatrix(const float *m1, const float *m2, float *dst);
@@ -137,6 +117,11 @@ private:
     static void transformVec4(const float *m, const float *v, float *dst);
 
     static void crossVec3(const float *v1, const float *v2, float *dst);
+
+    // batched versions, one dispatch for count matrices or vectors laid out contiguously
+    static void multiplyMatrices(const float *m1, const float *m2, float *dst, uint32_t count);
+
+    static void transformVec4s(const float *m, const float *v, float *dst, uint32_t count);
 };
 
 NS_CC_MATH_END
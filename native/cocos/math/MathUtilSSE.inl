@@ -20,160 +20,140 @@
  This file was modified to fit the cocos2d-x project
  */
 
+#include <xmmintrin.h>
+
 NS_CC_MATH_BEGIN
 
-#ifdef __SSE__
+// Mat4 and Vec4 keep plain float storage so that their layout matches the
+// script side, hence unaligned loads and stores everywhere.
+class MathUtilSSE
+{
+public:
+    inline static void addMatrix(const float* m, float scalar, float* dst);
+
+    inline static void addMatrix(const float* m1, const float* m2, float* dst);
+
+    inline static void subtractMatrix(const float* m1, const float* m2, float* dst);
+
+    inline static void multiplyMatrix(const float* m, float scalar, float* dst);
+
+    inline static void multiplyMatrix(const float* m1, const float* m2, float* dst);
+
+    inline static void negateMatrix(const float* m, float* dst);
+
+    inline static void transposeMatrix(const float* m, float* dst);
+
+    inline static void transformVec4(const float* m, float x, float y, float z, float w, float* dst);
+
+    inline static void transformVec4(const float* m, const float* v, float* dst);
 
-void MathUtil::addMatrix(const __m128 m[4], float scalar, __m128 dst[4])
+    inline static void transformVec4s(const float* m, const float* v, float* dst, uint32_t count);
+
+private:
+    inline static __m128 linearCombine(const __m128 col[4], __m128 v);
+};
+
+inline __m128 MathUtilSSE::linearCombine(const __m128 col[4], __m128 v)
+{
+    __m128 e0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 e1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 e2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 e3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+
+    __m128 a0 = _mm_add_ps(_mm_mul_ps(col[0], e0), _mm_mul_ps(col[1], e1));
+    __m128 a1 = _mm_add_ps(_mm_mul_ps(col[2], e2), _mm_mul_ps(col[3], e3));
+    return _mm_add_ps(a0, a1);
+}
+
+inline void MathUtilSSE::addMatrix(const float* m, float scalar, float* dst)
 {
     __m128 s = _mm_set1_ps(scalar);
-    dst[0] = _mm_add_ps(m[0], s);
-    dst[1] = _mm_add_ps(m[1], s);
-    dst[2] = _mm_add_ps(m[2], s);
-    dst[3] = _mm_add_ps(m[3], s);
+    _mm_storeu_ps(dst + 0, _mm_add_ps(_mm_loadu_ps(m + 0), s));
+    _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_loadu_ps(m + 4), s));
+    _mm_storeu_ps(dst + 8, _mm_add_ps(_mm_loadu_ps(m + 8), s));
+    _mm_storeu_ps(dst + 12, _mm_add_ps(_mm_loadu_ps(m + 12), s));
 }
 
-void MathUtil::addMatrix(const __m128 m1[4], const __m128 m2[4], __m128 dst[4])
+inline void MathUtilSSE::addMatrix(const float* m1, const float* m2, float* dst)
 {
-    dst[0] = _mm_add_ps(m1[0], m2[0]);
-    dst[1] = _mm_add_ps(m1[1], m2[1]);
-    dst[2] = _mm_add_ps(m1[2], m2[2]);
-    dst[3] = _mm_add_ps(m1[3], m2[3]);
+    _mm_storeu_ps(dst + 0, _mm_add_ps(_mm_loadu_ps(m1 + 0), _mm_loadu_ps(m2 + 0)));
+    _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_loadu_ps(m1 + 4), _mm_loadu_ps(m2 + 4)));
+    _mm_storeu_ps(dst + 8, _mm_add_ps(_mm_loadu_ps(m1 + 8), _mm_loadu_ps(m2 + 8)));
+    _mm_storeu_ps(dst + 12, _mm_add_ps(_mm_loadu_ps(m1 + 12), _mm_loadu_ps(m2 + 12)));
 }
 
-void MathUtil::subtractMatrix(const __m128 m1[4], const __m128 m2[4], __m128 dst[4])
+inline void MathUtilSSE::subtractMatrix(const float* m1, const float* m2, float* dst)
 {
-    dst[0] = _mm_sub_ps(m1[0], m2[0]);
-    dst[1] = _mm_sub_ps(m1[1], m2[1]);
-    dst[2] = _mm_sub_ps(m1[2], m2[2]);
-    dst[3] = _mm_sub_ps(m1[3], m2[3]);
+    _mm_storeu_ps(dst + 0, _mm_sub_ps(_mm_loadu_ps(m1 + 0), _mm_loadu_ps(m2 + 0)));
+    _mm_storeu_ps(dst + 4, _mm_sub_ps(_mm_loadu_ps(m1 + 4), _mm_loadu_ps(m2 + 4)));
+    _mm_storeu_ps(dst + 8, _mm_sub_ps(_mm_loadu_ps(m1 + 8), _mm_loadu_ps(m2 + 8)));
+    _mm_storeu_ps(dst + 12, _mm_sub_ps(_mm_loadu_ps(m1 + 12), _mm_loadu_ps(m2 + 12)));
 }
 
-void MathUtil::multiplyMatrix(const __m128 m[4], float scalar, __m128 dst[4])
+inline void MathUtilSSE::multiplyMatrix(const float* m, float scalar, float* dst)
 {
     __m128 s = _mm_set1_ps(scalar);
-    dst[0] = _mm_mul_ps(m[0], s);
-    dst[1] = _mm_mul_ps(m[1], s);
-    dst[2] = _mm_mul_ps(m[2], s);
-    dst[3] = _mm_mul_ps(m[3], s);
+    _mm_storeu_ps(dst + 0, _mm_mul_ps(_mm_loadu_ps(m + 0), s));
+    _mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_loadu_ps(m + 4), s));
+    _mm_storeu_ps(dst + 8, _mm_mul_ps(_mm_loadu_ps(m + 8), s));
+    _mm_storeu_ps(dst + 12, _mm_mul_ps(_mm_loadu_ps(m + 12), s));
 }
 
-void MathUtil::multiplyMatrix(const __m128 m1[4], const __m128 m2[4], __m128 dst[4])
+inline void MathUtilSSE::multiplyMatrix(const float* m1, const float* m2, float* dst)
 {
-    __m128 dst0, dst1, dst2, dst3;
-	{
-		__m128 e0 = _mm_shuffle_ps(m2[0], m2[0], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(m2[0], m2[0], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(m2[0], m2[0], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(m2[0], m2[0], _MM_SHUFFLE(3, 3, 3, 3));
-        
-		__m128 v0 = _mm_mul_ps(m1[0], e0);
-		__m128 v1 = _mm_mul_ps(m1[1], e1);
-		__m128 v2 = _mm_mul_ps(m1[2], e2);
-		__m128 v3 = _mm_mul_ps(m1[3], e3);
-        
-		__m128 a0 = _mm_add_ps(v0, v1);
-		__m128 a1 = _mm_add_ps(v2, v3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-        
-		dst0 = a2;
-	}
-    
-	{
-		__m128 e0 = _mm_shuffle_ps(m2[1], m2[1], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(m2[1], m2[1], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(m2[1], m2[1], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(m2[1], m2[1], _MM_SHUFFLE(3, 3, 3, 3));
-        
-		__m128 v0 = _mm_mul_ps(m1[0], e0);
-		__m128 v1 = _mm_mul_ps(m1[1], e1);
-		__m128 v2 = _mm_mul_ps(m1[2], e2);
-		__m128 v3 = _mm_mul_ps(m1[3], e3);
-        
-		__m128 a0 = _mm_add_ps(v0, v1);
-		__m128 a1 = _mm_add_ps(v2, v3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-        
-		dst1 = a2;
-	}
-    
-	{
-		__m128 e0 = _mm_shuffle_ps(m2[2], m2[2], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(m2[2], m2[2], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(m2[2], m2[2], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(m2[2], m2[2], _MM_SHUFFLE(3, 3, 3, 3));
-        
-		__m128 v0 = _mm_mul_ps(m1[0], e0);
-		__m128 v1 = _mm_mul_ps(m1[1], e1);
-		__m128 v2 = _mm_mul_ps(m1[2], e2);
-		__m128 v3 = _mm_mul_ps(m1[3], e3);
-        
-		__m128 a0 = _mm_add_ps(v0, v1);
-		__m128 a1 = _mm_add_ps(v2, v3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-        
-		dst2 = a2;
-	}
-    
-	{
-		__m128 e0 = _mm_shuffle_ps(m2[3], m2[3], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(m2[3], m2[3], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(m2[3], m2[3], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(m2[3], m2[3], _MM_SHUFFLE(3, 3, 3, 3));
-        
-		__m128 v0 = _mm_mul_ps(m1[0], e0);
-		__m128 v1 = _mm_mul_ps(m1[1], e1);
-		__m128 v2 = _mm_mul_ps(m1[2], e2);
-		__m128 v3 = _mm_mul_ps(m1[3], e3);
-        
-		__m128 a0 = _mm_add_ps(v0, v1);
-		__m128 a1 = _mm_add_ps(v2, v3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-        
-		dst3 = a2;
-	}
-    dst[0] = dst0;
-    dst[1] = dst1;
-    dst[2] = dst2;
-    dst[3] = dst3;
+    // dst may alias m1 or m2, so every column is computed before storing
+    __m128 col[4] = {_mm_loadu_ps(m1 + 0), _mm_loadu_ps(m1 + 4), _mm_loadu_ps(m1 + 8), _mm_loadu_ps(m1 + 12)};
+    __m128 dst0 = linearCombine(col, _mm_loadu_ps(m2 + 0));
+    __m128 dst1 = linearCombine(col, _mm_loadu_ps(m2 + 4));
+    __m128 dst2 = linearCombine(col, _mm_loadu_ps(m2 + 8));
+    __m128 dst3 = linearCombine(col, _mm_loadu_ps(m2 + 12));
+    _mm_storeu_ps(dst + 0, dst0);
+    _mm_storeu_ps(dst + 4, dst1);
+    _mm_storeu_ps(dst + 8, dst2);
+    _mm_storeu_ps(dst + 12, dst3);
 }
 
-void MathUtil::negateMatrix(const __m128 m[4], __m128 dst[4])
+inline void MathUtilSSE::negateMatrix(const float* m, float* dst)
 {
     __m128 z = _mm_setzero_ps();
-    dst[0] = _mm_sub_ps(z, m[0]);
-    dst[1] = _mm_sub_ps(z, m[1]);
-    dst[2] = _mm_sub_ps(z, m[2]);
-    dst[3] = _mm_sub_ps(z, m[3]);
+    _mm_storeu_ps(dst + 0, _mm_sub_ps(z, _mm_loadu_ps(m + 0)));
+    _mm_storeu_ps(dst + 4, _mm_sub_ps(z, _mm_loadu_ps(m + 4)));
+    _mm_storeu_ps(dst + 8, _mm_sub_ps(z, _mm_loadu_ps(m + 8)));
+    _mm_storeu_ps(dst + 12, _mm_sub_ps(z, _mm_loadu_ps(m + 12)));
 }
 
-void MathUtil::transposeMatrix(const __m128 m[4], __m128 dst[4])
+inline void MathUtilSSE::transposeMatrix(const float* m, float* dst)
 {
-    __m128 tmp0 = _mm_shuffle_ps(m[0], m[1], 0x44);
-    __m128 tmp2 = _mm_shuffle_ps(m[0], m[1], 0xEE);
-    __m128 tmp1 = _mm_shuffle_ps(m[2], m[3], 0x44);
-    __m128 tmp3 = _mm_shuffle_ps(m[2], m[3], 0xEE);
-    
-    dst[0] = _mm_shuffle_ps(tmp0, tmp1, 0x88);
-    dst[1] = _mm_shuffle_ps(tmp0, tmp1, 0xDD);
-    dst[2] = _mm_shuffle_ps(tmp2, tmp3, 0x88);
-    dst[3] = _mm_shuffle_ps(tmp2, tmp3, 0xDD);
+    __m128 col0 = _mm_loadu_ps(m + 0);
+    __m128 col1 = _mm_loadu_ps(m + 4);
+    __m128 col2 = _mm_loadu_ps(m + 8);
+    __m128 col3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+    _mm_storeu_ps(dst + 0, col0);
+    _mm_storeu_ps(dst + 4, col1);
+    _mm_storeu_ps(dst + 8, col2);
+    _mm_storeu_ps(dst + 12, col3);
 }
 
-void MathUtil::transformVec4(const __m128 m[4], const __m128& v, __m128& dst)
+inline void MathUtilSSE::transformVec4(const float* m, float x, float y, float z, float w, float* dst)
 {
-    __m128 col1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
-    __m128 col2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
-    __m128 col3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
-    __m128 col4 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
-    
-    dst = _mm_add_ps(
-                     _mm_add_ps(_mm_mul_ps(m[0], col1), _mm_mul_ps(m[1], col2)),
-                     _mm_add_ps(_mm_mul_ps(m[2], col3), _mm_mul_ps(m[3], col4))
-                     );
+    __m128 col[4] = {_mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+    _mm_storeu_ps(dst, linearCombine(col, _mm_setr_ps(x, y, z, w)));
 }
 
-#endif
+inline void MathUtilSSE::transformVec4(const float* m, const float* v, float* dst)
+{
+    __m128 col[4] = {_mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+    _mm_storeu_ps(dst, linearCombine(col, _mm_loadu_ps(v)));
+}
 
+inline void MathUtilSSE::transformVec4s(const float* m, const float* v, float* dst, uint32_t count)
+{
+    // the columns stay in registers for the whole batch
+    __m128 col[4] = {_mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+    for (uint32_t i = 0; i < count; ++i) {
+        _mm_storeu_ps(dst + i * 4, linearCombine(col, _mm_loadu_ps(v + i * 4)));
+    }
+}
 
 NS_CC_MATH_END
@@ -22,11 +22,6 @@
 
 #pragma once
 
-#undef __SSE__
-#ifdef __SSE__
-    #include <xmmintrin.h>
-#endif
-
 #include "math/Math.h"
 #include "math/MathBase.h"
 
@@ -44,17 +39,6 @@ class Mat4;
  */
 class CC_DLL Vec4 {
 public:
-#ifdef __SSE__
-    union {
-        struct {
-            float x;
-            float y;
-            float z;
-            float w;
-        };
-        __m128 v;
-    };
-#else
     /**
      * The x-coordinate.
      */
@@ -74,7 +58,7 @@ public:
      * The w-coordinate.
      */
     float w;
-#endif
+
     /**
      * Constructs a new vector initialized to all zeros.
      */
@@ -39,6 +39,7 @@
 #include "platform/interfaces/modules/ISystemWindowManager.h"
 #include "renderer/GFXDeviceManager.h"
 #include "renderer/pipeline/PipelineSceneData.h"
+#include "renderer/pipeline/PipelineStateManager.h"
 #include "renderer/pipeline/custom/RenderInterfaceTypes.h"
 #include "scene/Shadow.h"
 
@@ -214,6 +215,13 @@ void Profiler::doFrameUpdate() {
     CC_PROFILE_RENDER_UPDATE(Instances, device->getNumInstances());
     CC_PROFILE_RENDER_UPDATE(Triangles, device->getNumTris());
 
+    const auto &psoStats = pipeline::PipelineStateManager::getStatistics();
+    CC_PROFILE_RENDER_UPDATE(PSOCacheHits, psoStats.hits);
+    CC_PROFILE_RENDER_UPDATE(PSOCacheMisses, psoStats.misses);
+    CC_PROFILE_RENDER_UPDATE(PSOPrewarmed, psoStats.prewarmed);
+    CC_PROFILE_RENDER_UPDATE(PSOCompileTimeUS, static_cast<uint32_t>(psoStats.compileTimeUS));
+    pipeline::PipelineStateManager::resetStatistics();
+
 #if USE_MEMORY_LEAK_DETECTOR
     CC_PROFILE_MEMORY_UPDATE(HeapMemory, GMemoryHook.getTotalSize());
 #endif
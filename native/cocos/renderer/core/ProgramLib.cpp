@@ -32,6 +32,7 @@
 #include "core/assets/EffectAsset.h"
 #include "renderer/gfx-base/GFXDevice.h"
 #include "renderer/pipeline/custom/RenderInterfaceTypes.h"
+#include "scene/Define.h"
 
 namespace cc {
 
@@ -407,47 +408,79 @@ ccstd::string ProgramLib::getKey(const ccstd::string &name, const MacroRecord &d
     return render::getVariantKey(tmpl, defines);
 }
 
+ProgramVariantKey ProgramLib::getVariantKey(const ccstd::string &name, const MacroRecord &defines,
+                                            const ccstd::vector<scene::IMacroPatch> &patches, render::PipelineRuntime *pipeline) {
+    auto itTpl = _templates.find(name);
+    CC_ASSERT(itTpl != _templates.end());
+    const auto *macros = pipeline ? &pipeline->getMacros() : nullptr;
+    return render::getProgramVariantKey(itTpl->second, [&](const ccstd::string &macro) -> const MacroValue * {
+        if (macros) {
+            auto itMacro = macros->find(macro);
+            if (itMacro != macros->end()) {
+                return &itMacro->second;
+            }
+        }
+        // the last patch of the same name wins
+        for (auto itPatch = patches.rbegin(); itPatch != patches.rend(); ++itPatch) {
+            if (itPatch->name == macro) {
+                return &itPatch->value;
+            }
+        }
+        auto itDef = defines.find(macro);
+        return itDef != defines.end() ? &itDef->second : nullptr;
+    });
+}
+
 void ProgramLib::destroyShaderByDefines(const MacroRecord &defines) {
     if (defines.empty()) return;
-    ccstd::vector<ccstd::string> defineValues;
-    for (const auto &i : defines) {
-        defineValues.emplace_back(i.first + macroRecordAsString(i.second));
-    }
-    ccstd::vector<ccstd::string> matchedKeys;
-    for (const auto &i : _cache) {
-        bool matched = true;
-        for (const auto &v : defineValues) {
-            if (i.first.find(v) == ccstd::string::npos) {
-                matched = false;
-                break;
+    ccstd::vector<ProgramVariantKey> matchedKeys;
+    for (const auto &item : _templates) {
+        const auto &tmpl = item.second;
+        auto matches = [&](const ProgramVariantKey &key) {
+            for (const auto &define : defines) {
+                auto itDef = std::find_if(tmpl.defines.begin(), tmpl.defines.end(), [&define](const auto &def) { return def.name == define.first; });
+                if (itDef == tmpl.defines.end() || !itDef->map) {
+                    return false;
+                }
+                // the field of a define ends where the next one starts, the bits above the last field are never set
+                const auto next = itDef + 1;
+                const auto count = next != tmpl.defines.end() ? static_cast<uint32_t>(next->offset - itDef->offset) : 32U;
+                if (key.getBits(itDef->offset, count) != static_cast<uint32_t>(itDef->map(define.second))) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        for (const auto &cache : _cache) {
+            if (cache.first.programHash == tmpl.hash && matches(cache.first)) {
+                matchedKeys.emplace_back(cache.first);
             }
-        }
-        if (matched) {
-            matchedKeys.emplace_back(i.first);
         }
     }
     for (const auto &key : matchedKeys) {
-        CC_LOG_DEBUG("destroyed shader %s", key.c_str());
-        _cache[key]->destroy();
-        _cache.erase(key);
+        auto itRes = _cache.find(key);
+        if (itRes == _cache.end()) {
+            continue; // templates sharing the same source
+        }
+        CC_LOG_DEBUG("destroyed shader %s", itRes->second->getName().c_str());
+        itRes->second->destroy();
+        _cache.erase(itRes);
     }
 }
 
 gfx::Shader *ProgramLib::getGFXShader(gfx::Device *device, const ccstd::string &name, MacroRecord &defines,
-                                      render::PipelineRuntime *pipeline, ccstd::string *keyOut) {
+                                      render::PipelineRuntime *pipeline) {
     for (const auto &it : pipeline->getMacros()) {
         defines[it.first] = it.second;
     }
+    return getGFXShader(device, name, defines, {}, pipeline);
+}
 
-    ccstd::string key;
-    if (!keyOut) {
-        key = getKey(name, defines);
-    } else {
-        key = *keyOut;
-    }
+gfx::Shader *ProgramLib::getGFXShader(gfx::Device *device, const ccstd::string &name, const MacroRecord &defines,
+                                      const ccstd::vector<scene::IMacroPatch> &patches, render::PipelineRuntime *pipeline) {
+    const auto key = getVariantKey(name, defines, patches, pipeline);
     auto itRes = _cache.find(key);
     if (itRes != _cache.end()) {
-        //        CC_LOG_DEBUG("Found ProgramLib::_cache[%s]=%p, defines: %d", key.c_str(), itRes->second, defines.size());
         return itRes->second;
     }
 
@@ -466,7 +499,16 @@ gfx::Shader *ProgramLib::getGFXShader(gfx::Device *device, const ccstd::string &
         tmplInfo.pipelineLayout = device->createPipelineLayout(gfx::PipelineLayoutInfo{tmplInfo.setLayouts.get()});
     }
 
-    ccstd::vector<IMacroInfo> macroArray = render::prepareDefines(defines, tmpl.defines);
+    // the merged record is only needed to create the variant, lookups read the sources in place
+    MacroRecord macros{defines};
+    for (const auto &patch : patches) {
+        macros[patch.name] = patch.value;
+    }
+    for (const auto &it : pipeline->getMacros()) {
+        macros[it.first] = it.second;
+    }
+
+    ccstd::vector<IMacroInfo> macroArray = render::prepareDefines(macros, tmpl.defines);
     std::stringstream ss;
     ss << std::endl;
     for (const auto &m : macroArray) {
@@ -485,13 +527,12 @@ gfx::Shader *ProgramLib::getGFXShader(gfx::Device *device, const ccstd::string &
     tmplInfo.shaderInfo.stages[1].source = prefix + src->frag;
 
     // strip out the active attributes only, instancing depend on this
-    tmplInfo.shaderInfo.attributes = render::getActiveAttributes(tmpl, tmplInfo.gfxAttributes, defines);
+    tmplInfo.shaderInfo.attributes = render::getActiveAttributes(tmpl, tmplInfo.gfxAttributes, macros);
 
     tmplInfo.shaderInfo.name = render::getShaderInstanceName(name, macroArray);
     tmplInfo.shaderInfo.hash = tmpl.hash;
     auto *shader = device->createShader(tmplInfo.shaderInfo);
     _cache[key] = shader;
-    //    CC_LOG_DEBUG("ProgramLib::_cache[%s]=%p, defines: %d", key.c_str(), shader, defines.size());
     return shader;
 }
 
@@ -33,6 +33,7 @@
 #include "base/std/optional.h"
 #include "core/Types.h"
 #include "core/assets/EffectAsset.h"
+#include "renderer/core/ProgramVariantKey.h"
 #include "renderer/gfx-base/GFXDef-common.h"
 #include "renderer/pipeline/Define.h"
 #include "renderer/pipeline/RenderPipeline.h"
@@ -44,6 +45,10 @@ namespace render {
 class PipelineRuntime;
 } // namespace render
 
+namespace scene {
+struct IMacroPatch;
+} // namespace scene
+
 struct IDefineRecord : public IDefineInfo {
     std::function<int32_t(const MacroValue &)> map{nullptr};
     int32_t offset{0};
@@ -137,6 +142,17 @@ public:
      */
     ccstd::string getKey(const ccstd::string &name, const MacroRecord &defines);
 
+    /**
+     * @en Gets the packed variant key, macros of the pipeline override the patches which override the defines.
+     * @zh 获取打包的变体键，管线宏优先于补丁宏，补丁宏优先于预处理宏。
+     * @param name Target shader name
+     * @param defines The combination of preprocess macros
+     * @param patches The macro patches applied on top of the defines
+     * @param pipeline The [[RenderPipeline]] which owns the render command, no pipeline macro is applied if null
+     */
+    ProgramVariantKey getVariantKey(const ccstd::string &name, const MacroRecord &defines,
+                                    const ccstd::vector<scene::IMacroPatch> &patches, render::PipelineRuntime *pipeline);
+
     /**
      * @en Destroy all shader instance match the preprocess macros
      * @zh 销毁所有完全满足指定预处理宏特征的 shader 实例。
@@ -151,17 +167,28 @@ public:
      * @param name Shader name
      * @param defines Preprocess macros
      * @param pipeline The [[RenderPipeline]] which owns the render command
-     * @param key The shader cache key, if already known
      */
     gfx::Shader *getGFXShader(gfx::Device *device, const ccstd::string &name, MacroRecord &defines,
-                              render::PipelineRuntime *pipeline, ccstd::string *key = nullptr);
+                              render::PipelineRuntime *pipeline);
+
+    /**
+     * @en Gets the shader resource instance with the macro patches applied, the defines are left untouched
+     * and a merged macro record is only built when the variant has to be created.
+     * @zh 获取应用宏补丁后的 shader 渲染资源实例，不修改预处理宏，仅在需要创建变体时合并宏列表。
+     * @param name Shader name
+     * @param defines Preprocess macros
+     * @param patches The macro patches applied on top of the defines
+     * @param pipeline The [[RenderPipeline]] which owns the render command
+     */
+    gfx::Shader *getGFXShader(gfx::Device *device, const ccstd::string &name, const MacroRecord &defines,
+                              const ccstd::vector<scene::IMacroPatch> &patches, render::PipelineRuntime *pipeline);
 
 private:
     CC_DISALLOW_COPY_MOVE_ASSIGN(ProgramLib);
 
     static ProgramLib *instance;
     ccstd::unordered_map<ccstd::string, IProgramInfo> _templates; // per shader
-    ccstd::unordered_map<ccstd::string, IntrusivePtr<gfx::Shader>> _cache;
+    ccstd::unordered_map<ProgramVariantKey, IntrusivePtr<gfx::Shader>, ccstd::hash<ProgramVariantKey>> _cache;
     ccstd::unordered_map<uint64_t, ITemplateInfo> _templateInfos;
 };
 
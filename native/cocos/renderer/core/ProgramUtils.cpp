@@ -163,6 +163,13 @@ ccstd::string getVariantKey(const IProgramInfo &tmpl, const MacroRecord &defines
     return ret;
 }
 
+ProgramVariantKey getProgramVariantKey(const IProgramInfo &tmpl, const MacroRecord &defines) {
+    return getProgramVariantKey(tmpl, [&defines](const ccstd::string &name) -> const MacroValue * {
+        auto iter = defines.find(name);
+        return iter != defines.end() ? &iter->second : nullptr;
+    });
+}
+
 namespace {
 
 ccstd::string mapDefine(const IDefineInfo &info, const ccstd::optional<MacroRecord::mapped_type> &def) {
@@ -34,6 +34,25 @@ void populateMacros(IProgramInfo& tmpl);
 ccstd::unordered_map<ccstd::string, uint32_t> genHandles(const IProgramInfo& tmpl);
 ccstd::unordered_map<ccstd::string, uint32_t> genHandles(const gfx::ShaderInfo& tmpl);
 ccstd::string getVariantKey(const IProgramInfo& tmpl, const MacroRecord& defines);
+
+// lookup(name) returns the value of the define or nullptr, so that no merged macro record has to be built
+template <class Lookup>
+ProgramVariantKey getProgramVariantKey(const IProgramInfo& tmpl, const Lookup& lookup) {
+    ProgramVariantKey key;
+    key.programHash = tmpl.hash;
+    for (const auto& tmplDef : tmpl.defines) {
+        if (!tmplDef.map) {
+            continue;
+        }
+        const MacroValue* value = lookup(tmplDef.name);
+        if (value) {
+            key.setBits(tmplDef.offset, static_cast<uint32_t>(tmplDef.map(*value)));
+        }
+    }
+    return key;
+}
+
+ProgramVariantKey getProgramVariantKey(const IProgramInfo& tmpl, const MacroRecord& defines);
 ccstd::vector<IMacroInfo> prepareDefines(
     const MacroRecord& records, const ccstd::vector<IDefineRecord>& defList);
 
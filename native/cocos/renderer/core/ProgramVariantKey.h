@@ -0,0 +1,113 @@
+/****************************************************************************
+ Copyright (c) 2021-2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "base/std/container/array.h"
+#include "base/std/container/vector.h"
+#include "base/std/hash/hash.h"
+
+namespace cc {
+
+/**
+ * @en The shader variant key, every define of the template owns the bit field laid out by populateMacros.
+ * Comparing and hashing it never allocates, unlike the string key, and only templates wider than INLINE_BITS allocate to build it.
+ * @zh Shader 变体键，模板的每个宏占用 populateMacros 计算出的位域，比较与哈希均不分配内存，仅超过 INLINE_BITS 位的模板在构建时分配。
+ */
+struct ProgramVariantKey {
+    // fields below INLINE_BITS are stored in words, the rest of wider templates in extraWords
+    static constexpr int32_t INLINE_BITS = 256;
+
+    void setBits(int32_t offset, uint32_t value) {
+        if (!value) {
+            return; // keeps extraWords free of trailing zero words, so equal keys compare equal
+        }
+        const auto word = static_cast<uint32_t>(offset) / 64;
+        const auto bit = static_cast<uint32_t>(offset) % 64;
+        getWord(word) |= static_cast<uint64_t>(value) << bit;
+        if (bit > 32 && (value >> (64 - bit)) != 0) {
+            getWord(word + 1) |= static_cast<uint64_t>(value) >> (64 - bit);
+        }
+    }
+
+    // count is the number of bits owned by the define
+    uint32_t getBits(int32_t offset, uint32_t count) const noexcept {
+        const auto word = static_cast<uint32_t>(offset) / 64;
+        const auto bit = static_cast<uint32_t>(offset) % 64;
+        uint64_t bits = readWord(word) >> bit;
+        if (bit > 32) {
+            bits |= readWord(word + 1) << (64 - bit);
+        }
+        return static_cast<uint32_t>(bits) & (count < 32 ? (1U << count) - 1 : ~0U);
+    }
+
+    ccstd::hash_t programHash{0};
+    ccstd::array<uint64_t, INLINE_BITS / 64> words{};
+    ccstd::vector<uint64_t> extraWords;
+
+private:
+    uint64_t &getWord(uint32_t index) {
+        if (index < words.size()) {
+            return words[index];
+        }
+        index -= static_cast<uint32_t>(words.size());
+        if (index >= extraWords.size()) {
+            extraWords.resize(index + 1);
+        }
+        return extraWords[index];
+    }
+
+    uint64_t readWord(uint32_t index) const noexcept {
+        if (index < words.size()) {
+            return words[index];
+        }
+        index -= static_cast<uint32_t>(words.size());
+        return index < extraWords.size() ? extraWords[index] : 0;
+    }
+};
+
+inline bool operator==(const ProgramVariantKey &lhs, const ProgramVariantKey &rhs) noexcept {
+    return lhs.programHash == rhs.programHash && lhs.words == rhs.words && lhs.extraWords == rhs.extraWords;
+}
+
+inline bool operator!=(const ProgramVariantKey &lhs, const ProgramVariantKey &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+} // namespace cc
+
+namespace ccstd {
+
+template <>
+struct hash<cc::ProgramVariantKey> {
+    hash_t operator()(const cc::ProgramVariantKey &val) const noexcept {
+        hash_t seed = val.programHash;
+        hash_range(seed, val.words.begin(), val.words.end());
+        hash_range(seed, val.extraWords.begin(), val.extraWords.end());
+        return seed;
+    }
+};
+
+} // namespace ccstd
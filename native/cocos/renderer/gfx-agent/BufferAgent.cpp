@@ -134,6 +134,27 @@ void BufferAgent::update(const void *buffer, uint32_t size) {
         });
 }
 
+void BufferAgent::update(const void *buffer, uint32_t offset, uint32_t size) {
+    uint8_t *actorBuffer{nullptr};
+    bool needFreeing{false};
+    auto *mq{DeviceAgent::getInstance()->getMessageQueue()};
+
+    getActorBuffer(this, mq, size, &actorBuffer, &needFreeing);
+    memcpy(actorBuffer, buffer, size);
+
+    ENQUEUE_MESSAGE_5(
+        mq, BufferUpdateRange,
+        actor, getActor(),
+        buffer, actorBuffer,
+        offset, offset,
+        size, size,
+        needFreeing, needFreeing,
+        {
+            actor->update(buffer, offset, size);
+            if (needFreeing) free(buffer);
+        });
+}
+
 void BufferAgent::flush(const uint8_t *buffer) {
     auto *mq = DeviceAgent::getInstance()->getMessageQueue();
     ENQUEUE_MESSAGE_3(
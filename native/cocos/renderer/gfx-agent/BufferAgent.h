@@ -40,6 +40,7 @@ public:
     ~BufferAgent() override;
 
     void update(const void *buffer, uint32_t size) override;
+    void update(const void *buffer, uint32_t offset, uint32_t size) override;
 
     static void getActorBuffer(const BufferAgent *buffer, MessageQueue *mq, uint32_t size, uint8_t **pActorBuffer, bool *pNeedFreeing);
 
@@ -51,6 +51,9 @@ public:
 
     virtual void update(const void *buffer, uint32_t size) = 0;
 
+    // `buffer` holds the `size` bytes written at `offset`, the rest of the buffer is left as is.
+    virtual void update(const void *buffer, uint32_t offset, uint32_t size) = 0;
+
     inline void update(const void *buffer) { update(buffer, _size); }
 
     void update();
@@ -42,5 +42,8 @@ void EmptyBuffer::doDestroy() {
 void EmptyBuffer::update(const void *buffer, uint32_t size) {
 }
 
+void EmptyBuffer::update(const void *buffer, uint32_t offset, uint32_t size) {
+}
+
 } // namespace gfx
 } // namespace cc
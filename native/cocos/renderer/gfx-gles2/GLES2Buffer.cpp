@@ -88,5 +88,10 @@ void GLES2Buffer::update(const void *buffer, uint32_t size) {
     cmdFuncGLES2UpdateBuffer(GLES2Device::getInstance(), _gpuBuffer, buffer, 0U, size);
 }
 
+void GLES2Buffer::update(const void *buffer, uint32_t offset, uint32_t size) {
+    CC_PROFILE(GLES2BufferUpdate);
+    cmdFuncGLES2UpdateBuffer(GLES2Device::getInstance(), _gpuBuffer, buffer, offset, size);
+}
+
 } // namespace gfx
 } // namespace cc
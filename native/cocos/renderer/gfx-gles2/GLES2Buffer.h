@@ -39,6 +39,7 @@ public:
     ~GLES2Buffer() override;
 
     void update(const void *buffer, uint32_t size) override;
+    void update(const void *buffer, uint32_t offset, uint32_t size) override;
 
     inline GLES2GPUBuffer *gpuBuffer() const { return _gpuBuffer; }
     inline GLES2GPUBufferView *gpuBufferView() const { return _gpuBufferView; }
@@ -95,5 +95,10 @@ void GLES3Buffer::update(const void *buffer, uint32_t size) {
     cmdFuncGLES3UpdateBuffer(GLES3Device::getInstance(), _gpuBuffer, buffer, 0U, size);
 }
 
+void GLES3Buffer::update(const void *buffer, uint32_t offset, uint32_t size) {
+    CC_PROFILE(GLES3BufferUpdate);
+    cmdFuncGLES3UpdateBuffer(GLES3Device::getInstance(), _gpuBuffer, buffer, offset, size, true);
+}
+
 } // namespace gfx
 } // namespace cc
@@ -38,6 +38,7 @@ public:
     ~GLES3Buffer() override;
 
     void update(const void *buffer, uint32_t size) override;
+    void update(const void *buffer, uint32_t offset, uint32_t size) override;
 
     inline GLES3GPUBuffer *gpuBuffer() const { return _gpuBuffer; }
 
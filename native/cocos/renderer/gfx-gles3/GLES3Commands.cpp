@@ -2583,10 +2583,16 @@ void cmdFuncGLES3MemoryBarrier(GLES3Device * /*device*/, GLbitfield barriers, GL
     if (barriersByRegion) GL_CHECK(glMemoryBarrierByRegion(barriersByRegion));
 }
 
-static void uploadBufferData(GLenum target, GLintptr offset, GLsizeiptr length, const void *buffer) {
+static void uploadBufferData(GLES3Device *device, GLenum target, GLintptr offset, GLsizeiptr length, const void *buffer, uint32_t bufferSize, bool keepContents) {
 #if 0
     GL_CHECK(glBufferSubData(target, offset, length, buffer));
 #else
+    // orphaning drops the bytes outside the written range, range updates that keep them are staged instead,
+    // mapping a range still in use would stall
+    if (keepContents && (offset != 0 || static_cast<uint32_t>(length) < bufferSize)) {
+        device->stagingBufferRing()->copy(target, offset, length, buffer);
+        return;
+    }
     void *dst{nullptr};
     GL_CHECK(dst = glMapBufferRange(target, offset, length, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
     if (!dst) {
@@ -2598,7 +2604,7 @@ static void uploadBufferData(GLenum target, GLintptr offset, GLsizeiptr length,
 #endif
 }
 
-void cmdFuncGLES3UpdateBuffer(GLES3Device *device, GLES3GPUBuffer *gpuBuffer, const void *buffer, uint32_t offset, uint32_t size) {
+void cmdFuncGLES3UpdateBuffer(GLES3Device *device, GLES3GPUBuffer *gpuBuffer, const void *buffer, uint32_t offset, uint32_t size, bool keepContents) {
     GLES3ObjectCache &gfxStateCache = device->stateCache()->gfxStateCache;
     if (hasFlag(gpuBuffer->usage, BufferUsageBit::TRANSFER_SRC) && gpuBuffer->buffer != nullptr) {
         memcpy(gpuBuffer->buffer + offset, buffer, size);
@@ -2614,7 +2620,7 @@ void cmdFuncGLES3UpdateBuffer(GLES3Device *device, GLES3GPUBuffer *gpuBuffer, co
                     GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, gpuBuffer->glBuffer));
                     device->stateCache()->glArrayBuffer = gpuBuffer->glBuffer;
                 }
-                uploadBufferData(GL_ARRAY_BUFFER, offset, size, buffer);
+                uploadBufferData(device, GL_ARRAY_BUFFER, offset, size, buffer, gpuBuffer->size, keepContents);
                 break;
             }
             case GL_ELEMENT_ARRAY_BUFFER: {
@@ -2627,7 +2633,7 @@ void cmdFuncGLES3UpdateBuffer(GLES3Device *device, GLES3GPUBuffer *gpuBuffer, co
                     GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gpuBuffer->glBuffer));
                     device->stateCache()->glElementArrayBuffer = gpuBuffer->glBuffer;
                 }
-                uploadBufferData(GL_ELEMENT_ARRAY_BUFFER, offset, size, buffer);
+                uploadBufferData(device, GL_ELEMENT_ARRAY_BUFFER, offset, size, buffer, gpuBuffer->size, keepContents);
                 break;
             }
             case GL_UNIFORM_BUFFER: {
@@ -2635,7 +2641,7 @@ void cmdFuncGLES3UpdateBuffer(GLES3Device *device, GLES3GPUBuffer *gpuBuffer, co
                     GL_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, gpuBuffer->glBuffer));
                     device->stateCache()->glUniformBuffer = gpuBuffer->glBuffer;
                 }
-                uploadBufferData(GL_UNIFORM_BUFFER, offset, size, buffer);
+                uploadBufferData(device, GL_UNIFORM_BUFFER, offset, size, buffer, gpuBuffer->size, keepContents);
                 break;
             }
             case GL_SHADER_STORAGE_BUFFER: {
@@ -2643,7 +2649,7 @@ void cmdFuncGLES3UpdateBuffer(GLES3Device *device, GLES3GPUBuffer *gpuBuffer, co
                     GL_CHECK(glBindBuffer(GL_SHADER_STORAGE_BUFFER, gpuBuffer->glBuffer));
                     device->stateCache()->glShaderStorageBuffer = gpuBuffer->glBuffer;
                 }
-                uploadBufferData(GL_SHADER_STORAGE_BUFFER, offset, size, buffer);
+                uploadBufferData(device, GL_SHADER_STORAGE_BUFFER, offset, size, buffer, gpuBuffer->size, keepContents);
                 break;
             }
             case GL_DRAW_INDIRECT_BUFFER: {
@@ -2651,7 +2657,7 @@ void cmdFuncGLES3UpdateBuffer(GLES3Device *device, GLES3GPUBuffer *gpuBuffer, co
                     GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, gpuBuffer->glBuffer));
                     device->stateCache()->glDrawIndirectBuffer = gpuBuffer->glBuffer;
                 }
-                uploadBufferData(GL_DRAW_INDIRECT_BUFFER, offset, size, buffer);
+                uploadBufferData(device, GL_DRAW_INDIRECT_BUFFER, offset, size, buffer, gpuBuffer->size, keepContents);
                 break;
             }
             default:
@@ -3243,6 +3249,62 @@ void GLES3GPUFramebufferHub::update(GLES3GPUTexture *texture) {
     }
 }
 
+GLES3GPUStagingBufferRing::~GLES3GPUStagingBufferRing() {
+    for (auto &slot : _slots) {
+        if (slot.glFence) {
+            GL_CHECK(glDeleteSync(slot.glFence));
+        }
+        if (slot.glBuffer) {
+            GL_CHECK(glDeleteBuffers(1, &slot.glBuffer));
+        }
+    }
+}
+
+void GLES3GPUStagingBufferRing::copy(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    auto &slot = _slots[_index];
+    if (slot.glFence) {
+        // wait for the copies recorded the last time this slot was written, usually long done
+        GLenum status{GL_TIMEOUT_EXPIRED};
+        while (status == GL_TIMEOUT_EXPIRED) {
+            GL_CHECK(status = glClientWaitSync(slot.glFence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000));
+        }
+        GL_CHECK(glDeleteSync(slot.glFence));
+        slot.glFence = nullptr;
+    }
+    if (!slot.glBuffer) {
+        GL_CHECK(glGenBuffers(1, &slot.glBuffer));
+    }
+    GL_CHECK(glBindBuffer(GL_COPY_READ_BUFFER, slot.glBuffer));
+
+    GLintptr stagingOffset = (slot.used + 3) & ~static_cast<GLsizeiptr>(3);
+    if (stagingOffset + size > slot.capacity) {
+        // a new store, the copies already recorded this frame keep reading the old one
+        slot.capacity = std::max(slot.capacity * 2, size);
+        GL_CHECK(glBufferData(GL_COPY_READ_BUFFER, slot.capacity, nullptr, GL_STREAM_DRAW));
+        stagingOffset = 0;
+    }
+    void *dst{nullptr};
+    GL_CHECK(dst = glMapBufferRange(GL_COPY_READ_BUFFER, stagingOffset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+    if (dst) {
+        memcpy(dst, data, size);
+        GL_CHECK(glUnmapBuffer(GL_COPY_READ_BUFFER));
+    } else {
+        GL_CHECK(glBufferSubData(GL_COPY_READ_BUFFER, stagingOffset, size, data));
+    }
+    GL_CHECK(glCopyBufferSubData(GL_COPY_READ_BUFFER, target, stagingOffset, offset, size));
+    GL_CHECK(glBindBuffer(GL_COPY_READ_BUFFER, 0));
+    slot.used = stagingOffset + size;
+}
+
+void GLES3GPUStagingBufferRing::nextFrame() {
+    auto &slot = _slots[_index];
+    if (slot.used) {
+        GL_CHECK(slot.glFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        slot.used = 0;
+    }
+    _index = (_index + 1) % SLOT_COUNT;
+}
+
 GLint cmdFuncGLES3GetMaxSampleCount(const GLES3Device *device, Format format, TextureUsage usage, TextureFlags flags) {
     std::ignore = flags;
 
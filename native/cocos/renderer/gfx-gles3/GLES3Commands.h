@@ -288,11 +288,13 @@ void cmdFuncGLES3DrawIndirect(GLES3Device *device,
                               uint32_t stride,
                               bool indexed);
 
+// keepContents preserves the bytes outside [offset, offset + size), otherwise the store may be orphaned
 void cmdFuncGLES3UpdateBuffer(GLES3Device *device,
                               GLES3GPUBuffer *gpuBuffer,
                               const void *buffer,
                               uint32_t offset,
-                              uint32_t size);
+                              uint32_t size,
+                              bool keepContents = false);
 
 void cmdFuncGLES3CopyBuffersToTexture(GLES3Device *device,
                                       const uint8_t *const *buffers,
@@ -81,6 +81,7 @@ bool GLES3Device::doInit(const DeviceInfo & /*info*/) {
     _gpuFramebufferHub = ccnew GLES3GPUFramebufferHub;
     _gpuConstantRegistry = ccnew GLES3GPUConstantRegistry;
     _gpuFramebufferCacheMap = ccnew GLES3GPUFramebufferCacheMap(_gpuStateCache);
+    _gpuStagingBufferRing = ccnew GLES3GPUStagingBufferRing;
 
     if (!_gpuContext->initialize(_gpuStateCache, _gpuConstantRegistry)) {
         destroy();
@@ -255,6 +256,7 @@ bool GLES3Device::doInit(const DeviceInfo & /*info*/) {
 }
 
 void GLES3Device::doDestroy() {
+    CC_SAFE_DELETE(_gpuStagingBufferRing)
     CC_SAFE_DELETE(_gpuFramebufferCacheMap)
     CC_SAFE_DELETE(_gpuConstantRegistry)
     CC_SAFE_DELETE(_gpuFramebufferHub)
@@ -312,6 +314,7 @@ void GLES3Device::present() {
         if (isGFXDeviceNeedsPresent) _gpuContext->present(swapchain);
     }
     if (_xr) _xr->postGFXDevicePresent(_api);
+    _gpuStagingBufferRing->nextFrame();
 
     // Clear queue stats
     queue->_numDrawCalls = 0;
@@ -39,6 +39,7 @@ class GLES3GPUStateCache;
 class GLES3GPUFramebufferHub;
 struct GLES3GPUConstantRegistry;
 class GLES3GPUFramebufferCacheMap;
+class GLES3GPUStagingBufferRing;
 class GLES3PipelineCache;
 
 class CC_GLES3_API GLES3Device final : public Device {
@@ -77,6 +78,7 @@ public:
     inline GLES3GPUFramebufferHub *framebufferHub() const { return _gpuFramebufferHub; }
     inline GLES3GPUConstantRegistry *constantRegistry() const { return _gpuConstantRegistry; }
     inline GLES3GPUFramebufferCacheMap *framebufferCacheMap() const { return _gpuFramebufferCacheMap; }
+    inline GLES3GPUStagingBufferRing *stagingBufferRing() const { return _gpuStagingBufferRing; }
     inline GLES3PipelineCache *pipelineCache() const { return _pipelineCache.get(); }
 
     inline bool checkExtension(const ccstd::string &extension) const {
@@ -137,6 +139,7 @@ protected:
     GLES3GPUFramebufferHub *_gpuFramebufferHub{nullptr};
     GLES3GPUConstantRegistry *_gpuConstantRegistry{nullptr};
     GLES3GPUFramebufferCacheMap *_gpuFramebufferCacheMap{nullptr};
+    GLES3GPUStagingBufferRing *_gpuStagingBufferRing{nullptr};
     std::unique_ptr<GLES3PipelineCache> _pipelineCache;
 
     ccstd::vector<GLES3GPUSwapchain *> _swapchains;
@@ -26,6 +26,7 @@
 #include <unordered_map>
 
 #include "base/Macros.h"
+#include "base/std/container/array.h"
 #include "base/std/container/unordered_map.h"
 #include "gfx-base/GFXDef-common.h"
 #include "gfx-base/GFXDef.h"
@@ -669,6 +670,30 @@ private:
     ccstd::unordered_map<GLES3GPUTexture *, ccstd::vector<GLES3GPUFramebuffer *>> _framebuffers;
 };
 
+// Partial buffer writes go through a ring of staging buffers and reach the destination with glCopyBufferSubData,
+// so the CPU never maps a range the GPU may still be reading. Each frame writes the next slot, fenced before reuse.
+class GLES3GPUStagingBufferRing final {
+public:
+    ~GLES3GPUStagingBufferRing();
+
+    // the destination buffer has to be bound to `target`
+    void copy(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+    void nextFrame();
+
+private:
+    static constexpr uint32_t SLOT_COUNT = 3;
+
+    struct Slot {
+        GLuint glBuffer{0};
+        GLsizeiptr capacity{0};
+        GLsizeiptr used{0};
+        GLsync glFence{nullptr};
+    };
+
+    ccstd::array<Slot, SLOT_COUNT> _slots;
+    uint32_t _index{0};
+};
+
 struct GLES3GPUProgramBinary : public GFXDeviceObject<DefaultDeleter> {
     ccstd::string name;
     ccstd::hash_t hash = 0;
@@ -45,7 +45,8 @@ public:
     CCMTLBuffer &operator=(const CCMTLBuffer &) = delete;
     CCMTLBuffer &operator=(CCMTLBuffer &&) = delete;
 
-    void update(const void *buffer, uint32_t offset) override;
+    void update(const void *buffer, uint32_t size) override;
+    void update(const void *buffer, uint32_t offset, uint32_t size) override;
 
     void encodeBuffer(CCMTLCommandEncoder &encoder, uint32_t offset, uint32_t binding, ShaderStageFlags stages);
 
@@ -177,6 +177,45 @@ void CCMTLBuffer::update(const void *buffer, uint32_t size) {
     updateMTLBuffer(buffer, 0, size);
 }
 
+void CCMTLBuffer::update(const void *buffer, uint32_t offset, uint32_t size) {
+    CC_PROFILE(CCMTLBufferUpdate);
+    if (_isBufferView) {
+        CC_LOG_WARNING("Cannot update a buffer view.");
+        return;
+    }
+
+    id<MTLBuffer> mtlBuffer = _gpuBuffer->mtlBuffer;
+    auto *ccDevice = CCMTLDevice::getInstance();
+    if (mtlBuffer.storageMode == MTLStorageModePrivate) {
+        static_cast<CCMTLCommandBuffer *>(ccDevice->getCommandBuffer())->updateBuffer(this, buffer, offset, size);
+        return;
+    }
+
+    auto &lastUpdateCycle = _gpuBuffer->lastUpdateCycle;
+    bool backBuffer = hasFlag(_memUsage, MemoryUsageBit::HOST);
+    uint8_t *contents = static_cast<uint8_t *>(mtlBuffer.contents);
+    uint32_t instanceOffset = 0;
+    uint32_t modifiedOffset = offset;
+    uint32_t modifiedSize = size;
+    if (backBuffer) {
+        auto currentCycle = static_cast<uint8_t>(ccDevice->currentFrameIndex());
+        instanceOffset = currentCycle * _gpuBuffer->instanceSize;
+        if (lastUpdateCycle != currentCycle) {
+            // a new frame instance starts from the latest content, then takes the changed range
+            memcpy(contents + instanceOffset, contents + lastUpdateCycle * _gpuBuffer->instanceSize, _size);
+            lastUpdateCycle = currentCycle;
+            modifiedOffset = 0;
+            modifiedSize = _size;
+        }
+    }
+    memcpy(contents + instanceOffset + offset, buffer, size);
+#if (CC_PLATFORM == CC_PLATFORM_MACOS)
+    if (mtlBuffer.storageMode == MTLStorageModeManaged) {
+        [mtlBuffer didModifyRange:NSMakeRange(instanceOffset + modifiedOffset, modifiedSize)]; // Synchronize the managed buffer.
+    }
+#endif
+}
+
 void CCMTLBuffer::updateMTLBuffer(const void *buffer, uint32_t /*offset*/, uint32_t size) {
     id<MTLBuffer> mtlBuffer = _gpuBuffer->mtlBuffer;
     auto* ccDevice = CCMTLDevice::getInstance();
@@ -72,6 +72,7 @@ public:
     void drawIndirect(Buffer *buffer, uint32_t offset, uint32_t count, uint32_t stride) override;
     void drawIndexedIndirect(Buffer *buffer, uint32_t offset, uint32_t count, uint32_t stride) override;
     void updateBuffer(Buffer *buff, const void *data, uint32_t size) override;
+    void updateBuffer(Buffer *buff, const void *data, uint32_t offset, uint32_t size);
     void copyBuffersToTexture(const uint8_t *const *buffers, Texture *texture, const BufferTextureCopy *regions, uint32_t count) override;
     void blitTexture(Texture *srcTexture, Texture *dstTexture, const TextureBlit *regions, uint32_t count, Filter filter) override;
     void copyTexture(Texture *srcTexture, Texture *dstTexture, const TextureCopy *regions, uint32_t count) override;
@@ -662,6 +662,10 @@ void CCMTLCommandBuffer::draw(const DrawInfo &info) {
 }
 
 void CCMTLCommandBuffer::updateBuffer(Buffer *buff, const void *data, uint32_t size) {
+    updateBuffer(buff, data, 0U, size);
+}
+
+void CCMTLCommandBuffer::updateBuffer(Buffer *buff, const void *data, uint32_t offset, uint32_t size) {
     CC_PROFILE(CCMTLCmdBufUpdateBuffer);
     if (!buff) {
         CC_LOG_ERROR("CCMTLCommandBuffer::updateBuffer: buffer is nullptr.");
@@ -677,7 +681,7 @@ void CCMTLCommandBuffer::updateBuffer(Buffer *buff, const void *data, uint32_t s
     [encoder copyFromBuffer:stagingBuffer.mtlBuffer
                sourceOffset:stagingBuffer.startOffset
                    toBuffer:ccBuffer->mtlBuffer()
-          destinationOffset:ccBuffer->currentOffset()
+          destinationOffset:ccBuffer->currentOffset() + offset
                        size:size];
     [encoder endEncoding];
 }
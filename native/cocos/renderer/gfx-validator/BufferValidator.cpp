@@ -145,7 +145,7 @@ void BufferValidator::update(const void *buffer, uint32_t size) {
     CC_ASSERT(size && size <= _size);
     CC_ASSERT(buffer);
 
-    sanityCheck(buffer, size);
+    sanityCheck(buffer, 0U, size);
     ++_totalUpdateTimes; // only count direct updates
 
     /////////// execute ///////////
@@ -153,7 +153,23 @@ void BufferValidator::update(const void *buffer, uint32_t size) {
     _actor->update(buffer, size);
 }
 
-void BufferValidator::sanityCheck(const void *buffer, uint32_t size) {
+void BufferValidator::update(const void *buffer, uint32_t offset, uint32_t size) {
+    CC_ASSERT(isInited());
+
+    // Cannot update through buffer views.
+    CC_ASSERT(!_isBufferView);
+    CC_ASSERT(size && offset + size <= _size);
+    CC_ASSERT(buffer);
+
+    sanityCheck(buffer, offset, size);
+    ++_totalUpdateTimes; // only count direct updates
+
+    /////////// execute ///////////
+
+    _actor->update(buffer, offset, size);
+}
+
+void BufferValidator::sanityCheck(const void *buffer, uint32_t offset, uint32_t size) {
     uint64_t cur = DeviceValidator::getInstance()->currentFrame();
 
     if (cur == _lastUpdateFrame) {
@@ -165,7 +181,7 @@ void BufferValidator::sanityCheck(const void *buffer, uint32_t size) {
 
     if (DeviceValidator::getInstance()->isRecording()) {
         _buffer.resize(_size);
-        memcpy(_buffer.data(), buffer, size);
+        memcpy(_buffer.data() + offset, buffer, size);
     }
 
     _lastUpdateFrame = cur;
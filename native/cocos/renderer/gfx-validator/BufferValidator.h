@@ -36,8 +36,9 @@ public:
     ~BufferValidator() override;
 
     void update(const void *buffer, uint32_t size) override;
+    void update(const void *buffer, uint32_t offset, uint32_t size) override;
 
-    void sanityCheck(const void *buffer, uint32_t size);
+    void sanityCheck(const void *buffer, uint32_t offset, uint32_t size);
 
     inline bool isInited() const { return _inited; }
 
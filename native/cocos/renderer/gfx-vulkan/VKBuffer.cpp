@@ -88,7 +88,12 @@ void CCVKBuffer::doResize(uint32_t size, uint32_t count) {
 
 void CCVKBuffer::update(const void *buffer, uint32_t size) {
     CC_PROFILE(CCVKBufferUpdate);
-    cmdFuncCCVKUpdateBuffer(CCVKDevice::getInstance(), _gpuBuffer, buffer, size, nullptr);
+    cmdFuncCCVKUpdateBuffer(CCVKDevice::getInstance(), _gpuBuffer, buffer, 0U, size, nullptr);
+}
+
+void CCVKBuffer::update(const void *buffer, uint32_t offset, uint32_t size) {
+    CC_PROFILE(CCVKBufferUpdate);
+    cmdFuncCCVKUpdateBuffer(CCVKDevice::getInstance(), _gpuBuffer, buffer, offset, size, nullptr);
 }
 
 void CCVKGPUBuffer::shutdown() {
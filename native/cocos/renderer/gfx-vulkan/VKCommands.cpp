@@ -1220,7 +1220,7 @@ void bufferUpload(const CCVKGPUBufferView &stagingBuffer, CCVKGPUBuffer &gpuBuff
 };
 } // namespace
 
-void cmdFuncCCVKUpdateBuffer(CCVKDevice *device, CCVKGPUBuffer *gpuBuffer, const void *buffer, uint32_t size, const CCVKGPUCommandBuffer *cmdBuffer) {
+void cmdFuncCCVKUpdateBuffer(CCVKDevice *device, CCVKGPUBuffer *gpuBuffer, const void *buffer, uint32_t offset, uint32_t size, const CCVKGPUCommandBuffer *cmdBuffer) {
     if (!gpuBuffer) return;
 
     const void *dataToUpload = buffer;
@@ -1229,9 +1229,9 @@ void cmdFuncCCVKUpdateBuffer(CCVKDevice *device, CCVKGPUBuffer *gpuBuffer, const
     // back buffer instances update command
     uint32_t backBufferIndex = device->gpuDevice()->curBackBufferIndex;
     if (gpuBuffer->instanceSize) {
-        device->gpuBufferHub()->record(gpuBuffer, backBufferIndex, sizeToUpload, !cmdBuffer);
+        device->gpuBufferHub()->record(gpuBuffer, backBufferIndex, offset + sizeToUpload, !cmdBuffer);
         if (!cmdBuffer) {
-            uint8_t *dst = gpuBuffer->mappedData + backBufferIndex * gpuBuffer->instanceSize;
+            uint8_t *dst = gpuBuffer->mappedData + backBufferIndex * gpuBuffer->instanceSize + offset;
             memcpy(dst, dataToUpload, sizeToUpload);
             return;
         }
@@ -1250,7 +1250,7 @@ void cmdFuncCCVKUpdateBuffer(CCVKDevice *device, CCVKGPUBuffer *gpuBuffer, const
 
         VkBufferCopy region{
             stagingBuffer->offset,
-            gpuBuffer->getStartOffset(backBufferIndex) + chunkOffset,
+            gpuBuffer->getStartOffset(backBufferIndex) + offset + chunkOffset,
             chunkSizeToUpload,
         };
 
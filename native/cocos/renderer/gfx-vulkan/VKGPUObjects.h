@@ -1339,7 +1339,9 @@ public:
             if (i == backBufferIndex) {
                 _buffersToBeUpdated[i].erase(gpuBuffer);
             } else {
-                _buffersToBeUpdated[i][gpuBuffer] = {backBufferIndex, size, canMemcpy};
+                // the source instance holds every pending change, keep the widest range for partial updates
+                auto &update = _buffersToBeUpdated[i][gpuBuffer];
+                update = {backBufferIndex, std::max(update.size, size), canMemcpy};
             }
         }
     }
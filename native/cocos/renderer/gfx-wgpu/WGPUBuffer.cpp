@@ -178,6 +178,12 @@ void CCWGPUBuffer::update(const void *buffer, uint32_t size) {
     }
 }
 
+void CCWGPUBuffer::update(const void *buffer, uint32_t offset, uint32_t size) {
+    size_t bufferOffset = _isBufferView ? _offset : 0;
+    uint32_t alignedSize = ceil(size / 4.0) * 4;
+    wgpuQueueWriteBuffer(CCWGPUDevice::getInstance()->gpuDeviceObject()->wgpuQueue, _gpuBufferObject->wgpuBuffer, bufferOffset + offset, buffer, alignedSize);
+}
+
 void CCWGPUBuffer::update(const DrawInfoList &drawInfos) {
     size_t drawInfoCount = drawInfos.size();
     if (drawInfoCount > 0) {
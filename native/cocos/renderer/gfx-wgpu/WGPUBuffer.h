@@ -53,6 +53,7 @@ public:
     static CCWGPUBuffer *defaultStorageBuffer();
 
     void update(const void *buffer, uint32_t size) override;
+    void update(const void *buffer, uint32_t offset, uint32_t size) override;
 
     EXPORT_EMS(
         void update(const emscripten::val &v, uint32_t size);)
@@ -207,10 +207,10 @@ inline uint32_t convertPhase(const ccstd::vector<ccstd::string> &stages) {
     return phase;
 }
 
-using RenderQueueSortFunc = std::function<int(const RenderPass &, const RenderPass &)>;
+using RenderQueueSortFunc = std::function<bool(const RenderPass &, const RenderPass &)>;
 
 inline RenderQueueSortFunc convertQueueSortFunc(const RenderQueueSortMode &mode) {
-    std::function<int(const RenderPass &, const RenderPass &)> sortFunc = opaqueCompareFn;
+    RenderQueueSortFunc sortFunc = opaqueCompareFn;
     switch (mode) {
         case RenderQueueSortMode::BACK_TO_FRONT:
             sortFunc = transparentCompareFn;
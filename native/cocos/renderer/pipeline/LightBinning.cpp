@@ -0,0 +1,139 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#include "LightBinning.h"
+#include <algorithm>
+#include "base/job-system/JobChunks.h"
+#include "core/scene-graph/Node.h"
+#include "scene/Light.h"
+#include "scene/Model.h"
+#include "scene/PointLight.h"
+#include "scene/SphereLight.h"
+#include "scene/SpotLight.h"
+
+namespace cc {
+namespace pipeline {
+
+namespace {
+constexpr uint32_t PARALLEL_ASSIGN_MIN_MODELS_PER_CHUNK = 64;
+} // namespace
+
+bool LightBinning::getLightBounds(const scene::Light &light, geometry::AABB &bounds) {
+    switch (light.getType()) {
+        case scene::LightType::SPHERE:
+            bounds = static_cast<const scene::SphereLight &>(light).getAABB();
+            return true;
+        case scene::LightType::SPOT:
+            bounds = static_cast<const scene::SpotLight &>(light).getAABB();
+            return true;
+        case scene::LightType::POINT:
+            bounds = static_cast<const scene::PointLight &>(light).getAABB();
+            return true;
+        case scene::LightType::RANGED_DIRECTIONAL: {
+            geometry::AABB unitBox(0.0F, 0.0F, 0.0F, 0.5F, 0.5F, 0.5F);
+            light.getNode()->updateWorldTransform();
+            unitBox.transform(light.getNode()->getWorldMatrix(), &bounds);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool LightBinning::isModelLit(const scene::Light &light, const geometry::AABB &lightBounds, const scene::Model &model) {
+    const auto *worldBounds = model.getWorldBounds();
+    if (!worldBounds) {
+        return true;
+    }
+    if (!worldBounds->aabbAabb(lightBounds)) {
+        return false;
+    }
+    if (light.getType() == scene::LightType::SPOT) {
+        return worldBounds->aabbFrustum(static_cast<const scene::SpotLight &>(light).getFrustum());
+    }
+    return true;
+}
+
+void LightBinning::setLights(const ccstd::vector<const scene::Light *> &lights) {
+    _lights = lights;
+    _lightBounds.resize(lights.size());
+    _unboundedLights.clear();
+    _lightTree.clear();
+
+    for (uint32_t i = 0; i < lights.size(); ++i) {
+        if (getLightBounds(*lights[i], _lightBounds[i])) {
+            _lightTree.createProxy(_lightBounds[i], reinterpret_cast<void *>(static_cast<uintptr_t>(i)));
+        } else {
+            _unboundedLights.emplace_back(i);
+        }
+    }
+}
+
+void LightBinning::assign(const scene::Model *const *models, uint32_t count) {
+    if (_modelLights.size() < count) {
+        _modelLights.resize(count);
+    }
+
+    parallelForRange(count, PARALLEL_ASSIGN_MIN_MODELS_PER_CHUNK, [this, models](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            assignModel(*models[i], _modelLights[i]);
+        }
+    });
+}
+
+void LightBinning::assignModel(const scene::Model &model, ccstd::vector<uint32_t> &lightIndices) const {
+    lightIndices.clear();
+
+    const auto *worldBounds = model.getWorldBounds();
+    if (!worldBounds) {
+        for (uint32_t i = 0; i < _lights.size(); ++i) {
+            lightIndices.emplace_back(i);
+        }
+        return;
+    }
+
+    lightIndices.insert(lightIndices.end(), _unboundedLights.begin(), _unboundedLights.end());
+
+    Vec3 min;
+    Vec3 max;
+    worldBounds->getBoundary(&min, &max);
+    _lightTree.queryBox(min, max, [&](void *userData) {
+        const auto i = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(userData));
+        if (isModelLit(*_lights[i], _lightBounds[i], model)) {
+            lightIndices.emplace_back(i);
+        }
+    });
+    // keep the order of the light buffer, as the per light queues are indexed by it
+    std::sort(lightIndices.begin(), lightIndices.end());
+}
+
+void LightBinning::clear() {
+    _lights.clear();
+    _lightBounds.clear();
+    _unboundedLights.clear();
+    _lightTree.clear();
+}
+
+} // namespace pipeline
+} // namespace cc
@@ -0,0 +1,86 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "base/std/container/vector.h"
+#include "core/geometry/AABB.h"
+#include "core/geometry/DynamicAABBTree.h"
+
+namespace cc {
+namespace scene {
+class Light;
+class Model;
+} // namespace scene
+namespace pipeline {
+
+/**
+ * @en
+ * Assigns punctual lights to models. The light volumes are kept in a bounding volume hierarchy,
+ * so that each model only tests the few lights around it, models are assigned in parallel.
+ * @zh
+ * 为模型分配局部光源。光源体积存放在包围盒层次结构中，每个模型只需测试其附近的光源，模型的分配并行执行。
+ */
+class LightBinning final {
+public:
+    /**
+     * @en Get the world space bounds of a punctual light.
+     * @zh 获取局部光源的世界空间包围盒。
+     * @return @en false if the light has no bounded volume. @zh 光源没有有限体积时返回 false。
+     */
+    static bool getLightBounds(const scene::Light &light, geometry::AABB &bounds);
+    /**
+     * @en Whether the model is lit by the light, models without world bounds are lit by every light.
+     * @zh 模型是否被光源照亮，没有世界包围盒的模型被所有光源照亮。
+     */
+    static bool isModelLit(const scene::Light &light, const geometry::AABB &lightBounds, const scene::Model &model);
+
+    void setLights(const ccstd::vector<const scene::Light *> &lights);
+    /**
+     * @en Assign the lights to the models, the lights of models[i] are then available from getLightIndices(i).
+     * @zh 为模型分配光源，之后可通过 getLightIndices(i) 获取 models[i] 的光源。
+     */
+    void assign(const scene::Model *const *models, uint32_t count);
+    /**
+     * @en Indices of the lights passed to setLights, in ascending order.
+     * @zh 传入 setLights 的光源索引，升序排列。
+     */
+    inline const ccstd::vector<uint32_t> &getLightIndices(uint32_t model) const { return _modelLights[model]; }
+    void clear();
+
+private:
+    void assignModel(const scene::Model &model, ccstd::vector<uint32_t> &lightIndices) const;
+
+    // weak reference
+    ccstd::vector<const scene::Light *> _lights;
+    ccstd::vector<geometry::AABB> _lightBounds;
+    // lights without bounded volume, they lit every model
+    ccstd::vector<uint32_t> _unboundedLights;
+    geometry::DynamicAABBTree _lightTree;
+    ccstd::vector<ccstd::vector<uint32_t>> _modelLights;
+};
+
+} // namespace pipeline
+} // namespace cc
@@ -22,14 +22,276 @@
  THE SOFTWARE.
 ****************************************************************************/
 
+
 #include "PipelineStateManager.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include "base/BinaryArchive.h"
+#include "base/Log.h"
 #include "gfx-base/GFXDef-common.h"
 #include "gfx-base/GFXDevice.h"
+#include "gfx-base/GFXUtil.h"
+#include "profiler/Profiler.h"
 #include "scene/Pass.h"
 
 namespace cc {
 namespace pipeline {
 
+namespace {
+
+const char *fileName = "/pipeline_state_records.bin";
+const uint32_t MAGIC = 0x43435053; // "CCPS"
+const uint32_t VERSION = 1;
+
+// A pipeline state created in a previous run, only keeps data that stays the same across runs.
+struct PipelineStateRecord {
+    ccstd::hash_t passHash{0};
+    ccstd::string shaderName;
+    gfx::AttributeList attributes;
+    ccstd::hash_t renderPassHash{0};
+    uint32_t subpass{0};
+    bool compiled{false};
+};
+
+// Shader variant and pass states recorded pipeline states are created from.
+struct PipelineStateTemplate {
+    IntrusivePtr<gfx::Shader> shader;
+    IntrusivePtr<gfx::PipelineLayout> pipelineLayout;
+    gfx::PipelineStateInfo info;
+};
+
+ccstd::hash_t getPipelineStateHash(ccstd::hash_t passHash, ccstd::hash_t renderPassHash, ccstd::hash_t attributesHash,
+                                   uint32_t shaderID, uint32_t subpass) {
+    ccstd::hash_t seed = 5;
+    ccstd::hash_combine(seed, passHash);
+    ccstd::hash_combine(seed, renderPassHash);
+    ccstd::hash_combine(seed, attributesHash);
+    ccstd::hash_combine(seed, shaderID);
+    ccstd::hash_combine(seed, subpass);
+    return seed;
+}
+
+// Unlike RenderPass::getHash, barriers are ignored so that the hash stays the same across runs.
+ccstd::hash_t getRenderPassCompatibleHash(const gfx::RenderPass *renderPass) {
+    const auto &colorAttachments = renderPass->getColorAttachments();
+    ccstd::hash_t seed = static_cast<uint32_t>(colorAttachments.size()) * 2 + 3;
+    for (const auto &ca : colorAttachments) {
+        ccstd::hash_combine(seed, ca.format);
+        ccstd::hash_combine(seed, ca.sampleCount);
+        ccstd::hash_combine(seed, ca.loadOp);
+        ccstd::hash_combine(seed, ca.storeOp);
+    }
+    const auto &ds = renderPass->getDepthStencilAttachment();
+    ccstd::hash_combine(seed, ds.format);
+    ccstd::hash_combine(seed, ds.sampleCount);
+    ccstd::hash_combine(seed, ds.depthLoadOp);
+    ccstd::hash_combine(seed, ds.depthStoreOp);
+    ccstd::hash_combine(seed, ds.stencilLoadOp);
+    ccstd::hash_combine(seed, ds.stencilStoreOp);
+    ccstd::hash_combine(seed, renderPass->getSubpasses());
+    return seed;
+}
+
+ccstd::hash_t getProgramHash(ccstd::hash_t passHash, const ccstd::string &shaderName) {
+    ccstd::hash_t seed = passHash;
+    ccstd::hash_range(seed, shaderName.begin(), shaderName.end());
+    return seed;
+}
+
+ccstd::hash_t getRecordHash(const PipelineStateRecord &record) {
+    ccstd::hash_t seed = getProgramHash(record.passHash, record.shaderName);
+    ccstd::hash_combine(seed, gfx::computeAttributesHash(record.attributes));
+    ccstd::hash_combine(seed, record.renderPassHash);
+    ccstd::hash_combine(seed, record.subpass);
+    return seed;
+}
+
+ccstd::unordered_map<ccstd::hash_t, PipelineStateRecord> records;
+ccstd::unordered_map<ccstd::hash_t, ccstd::vector<ccstd::hash_t>> recordsByProgram;
+ccstd::unordered_map<ccstd::hash_t, ccstd::vector<ccstd::hash_t>> recordsByRenderPass;
+ccstd::unordered_map<ccstd::hash_t, PipelineStateTemplate> templates;
+ccstd::unordered_map<ccstd::hash_t, IntrusivePtr<gfx::RenderPass>> renderPasses;
+PipelineStateStatistics statistics;
+bool recordsLoaded{false};
+bool recordsDirty{false};
+
+void addRecord(ccstd::hash_t key, PipelineStateRecord &&record) {
+    recordsByProgram[getProgramHash(record.passHash, record.shaderName)].emplace_back(key);
+    recordsByRenderPass[record.renderPassHash].emplace_back(key);
+    records.emplace(key, std::move(record));
+}
+
+void saveString(BinaryOutputArchive &archive, const ccstd::string &str) {
+    archive.save(static_cast<uint32_t>(str.size()));
+    archive.save(str.data(), static_cast<uint32_t>(str.size()));
+}
+
+bool loadString(BinaryInputArchive &archive, ccstd::string &str) {
+    uint32_t length = 0;
+    if (!archive.load(length)) {
+        return false;
+    }
+    str.resize(length, 0);
+    return archive.load(str.data(), length);
+}
+
+void saveRecord(BinaryOutputArchive &archive, const PipelineStateRecord &record) {
+    archive.save(record.passHash);
+    archive.save(record.renderPassHash);
+    archive.save(record.subpass);
+    saveString(archive, record.shaderName);
+    archive.save(static_cast<uint32_t>(record.attributes.size()));
+    for (const auto &attribute : record.attributes) {
+        saveString(archive, attribute.name);
+        archive.save(static_cast<uint32_t>(attribute.format));
+        archive.save(static_cast<uint8_t>(attribute.isNormalized));
+        archive.save(attribute.stream);
+        archive.save(static_cast<uint8_t>(attribute.isInstanced));
+        archive.save(attribute.location);
+    }
+}
+
+bool loadRecord(BinaryInputArchive &archive, PipelineStateRecord &record) {
+    bool result = archive.load(record.renderPassHash);
+    result &= archive.load(record.subpass);
+    result &= loadString(archive, record.shaderName);
+    uint32_t attributeCount = 0;
+    result &= archive.load(attributeCount);
+    for (uint32_t i = 0; result && i < attributeCount; ++i) {
+        auto &attribute = record.attributes.emplace_back();
+        uint32_t format = 0;
+        uint8_t isNormalized = 0;
+        uint8_t isInstanced = 0;
+        result &= loadString(archive, attribute.name);
+        result &= archive.load(format);
+        result &= archive.load(isNormalized);
+        result &= archive.load(attribute.stream);
+        result &= archive.load(isInstanced);
+        result &= archive.load(attribute.location);
+        attribute.format = static_cast<gfx::Format>(format);
+        attribute.isNormalized = isNormalized != 0;
+        attribute.isInstanced = isInstanced != 0;
+    }
+    return result;
+}
+
+void loadRecords() {
+    recordsLoaded = true;
+    std::ifstream stream(gfx::getPipelineCacheFolder() + fileName, std::ios::binary);
+    if (!stream.is_open()) {
+        return;
+    }
+    BinaryInputArchive archive(stream);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    auto loadResult = archive.load(magic);
+    loadResult &= archive.load(version);
+    if (!loadResult || magic != MAGIC || version != VERSION) {
+        return;
+    }
+
+    PipelineStateRecord record;
+    while (archive.load(record.passHash)) {
+        if (!loadRecord(archive, record)) {
+            CC_LOG_WARNING("Load pipeline state records failed, file is truncated.");
+            break;
+        }
+        const auto key = getRecordHash(record);
+        if (records.count(key) == 0) {
+            addRecord(key, std::move(record));
+        }
+        record = {};
+    }
+    CC_LOG_INFO("Load pipeline state records success, count %u.", static_cast<uint32_t>(records.size()));
+}
+
+void saveRecords() {
+    if (!recordsDirty) {
+        return;
+    }
+    std::ofstream stream(gfx::getPipelineCacheFolder() + fileName, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+        CC_LOG_WARNING("Save pipeline state records failed.");
+        return;
+    }
+    BinaryOutputArchive archive(stream);
+    archive.save(MAGIC);
+    archive.save(VERSION);
+    for (const auto &pair : records) {
+        saveRecord(archive, pair.second);
+    }
+    recordsDirty = false;
+}
+
+void recordPipelineState(const scene::Pass *pass, const gfx::Shader *shader, const gfx::AttributeList &attributes,
+                         const gfx::RenderPass *renderPass, uint32_t subpass) {
+    PipelineStateRecord record;
+    record.passHash = pass->getHash();
+    record.shaderName = shader->getName();
+    record.attributes = attributes;
+    record.renderPassHash = getRenderPassCompatibleHash(renderPass);
+    record.subpass = subpass;
+    record.compiled = true;
+
+    const auto key = getRecordHash(record);
+    auto iter = records.find(key);
+    if (iter != records.end()) {
+        iter->second.compiled = true;
+        return;
+    }
+    addRecord(key, std::move(record));
+    recordsDirty = true;
+}
+
+bool hasUncompiledRecords(const ccstd::vector<ccstd::hash_t> &keys) {
+    return std::any_of(keys.begin(), keys.end(), [](ccstd::hash_t key) { return !records[key].compiled; });
+}
+
+// Templates and render passes only wait for the other half of their recorded states,
+// drop them once nothing is left to prewarm or when nobody else holds them anymore.
+void releaseUnusedReferences() {
+    for (auto iter = templates.begin(); iter != templates.end();) {
+        const auto &tmpl = iter->second;
+        const bool unused = tmpl.shader->getRefCount() == 1 || (tmpl.pipelineLayout && tmpl.pipelineLayout->getRefCount() == 1);
+        if (unused || !hasUncompiledRecords(recordsByProgram[iter->first])) {
+            iter = templates.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    for (auto iter = renderPasses.begin(); iter != renderPasses.end();) {
+        const auto &renderPass = iter->second;
+        const bool unused = !renderPass || renderPass->getRefCount() == 1 || !renderPass->getHash();
+        if (unused || !hasUncompiledRecords(recordsByRenderPass[iter->first])) {
+            iter = renderPasses.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+ccstd::hash_t getPrewarmInfo(const PipelineStateRecord &record, const PipelineStateTemplate &tmpl,
+                             gfx::RenderPass *renderPass, gfx::PipelineStateInfo *info) {
+    *info = tmpl.info;
+    info->renderPass = renderPass;
+    info->inputState.attributes = record.attributes;
+    info->subpass = record.subpass;
+    return getPipelineStateHash(record.passHash, renderPass->getHash(), gfx::computeAttributesHash(record.attributes),
+                                tmpl.shader->getTypedID(), record.subpass);
+}
+
+gfx::PipelineState *createPipelineState(const gfx::PipelineStateInfo &info, uint64_t *compileTimeUS) {
+    CC_PROFILE(PipelineStateCompile);
+    const auto start = std::chrono::steady_clock::now();
+    auto *pso = gfx::Device::getInstance()->createPipelineState(info);
+    const auto end = std::chrono::steady_clock::now();
+    *compileTimeUS += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    return pso;
+}
+
+} // namespace
+
 ccstd::unordered_map<ccstd::hash_t, IntrusivePtr<gfx::PipelineState>> PipelineStateManager::psoHashMap;
 
 gfx::PipelineState *PipelineStateManager::getOrCreatePipelineState(const scene::Pass *pass,
@@ -37,38 +299,141 @@ gfx::PipelineState *PipelineStateManager::getOrCreatePipelineState(const scene::
                                                                    gfx::InputAssembler *inputAssembler,
                                                                    gfx::RenderPass *renderPass,
                                                                    uint32_t subpass) {
-    const auto passHash = pass->getHash();
-    const auto renderPassHash = renderPass->getHash();
-    const auto iaHash = inputAssembler->getAttributesHash();
-    const auto shaderID = shader->getTypedID();
-    auto hash = passHash ^ renderPassHash ^ iaHash ^ shaderID;
-    if (subpass != 0) {
-        hash = hash << subpass;
-    }
-
-    auto *pso = psoHashMap[static_cast<ccstd::hash_t>(hash)].get();
-    if (!pso) {
-        auto *pipelineLayout = pass->getPipelineLayout();
-
-        pso = gfx::Device::getInstance()->createPipelineState({shader,
-                                                               pipelineLayout,
-                                                               renderPass,
-                                                               {inputAssembler->getAttributes()},
-                                                               *(pass->getRasterizerState()),
-                                                               *(pass->getDepthStencilState()),
-                                                               *(pass->getBlendState()),
-                                                               pass->getPrimitive(),
-                                                               pass->getDynamicStates(),
-                                                               gfx::PipelineBindPoint::GRAPHICS,
-                                                               subpass});
-
-        psoHashMap[static_cast<ccstd::hash_t>(hash)] = pso;
+    const auto hash = getPipelineStateHash(pass->getHash(), renderPass->getHash(), inputAssembler->getAttributesHash(),
+                                           shader->getTypedID(), subpass);
+    auto iter = psoHashMap.find(hash);
+    if (iter != psoHashMap.end()) {
+        ++statistics.hits;
+        return iter->second.get();
+    }
+
+    ++statistics.misses;
+    auto *pipelineLayout = pass->getPipelineLayout();
+    auto *pso = createPipelineState({shader,
+                                     pipelineLayout,
+                                     renderPass,
+                                     {inputAssembler->getAttributes()},
+                                     *(pass->getRasterizerState()),
+                                     *(pass->getDepthStencilState()),
+                                     *(pass->getBlendState()),
+                                     pass->getPrimitive(),
+                                     pass->getDynamicStates(),
+                                     gfx::PipelineBindPoint::GRAPHICS,
+                                     subpass},
+                                    &statistics.compileTimeUS);
+    psoHashMap.emplace(hash, pso);
+
+    if (!recordsLoaded) {
+        loadRecords();
     }
+    recordPipelineState(pass, shader, inputAssembler->getAttributes(), renderPass, subpass);
+    registerRenderPass(renderPass);
 
     return pso;
 }
 
+void PipelineStateManager::prewarm(const scene::Pass *pass, gfx::Shader *shader) {
+    if (!pass || !shader) {
+        return;
+    }
+    if (!recordsLoaded) {
+        loadRecords();
+    }
+    const auto programHash = getProgramHash(pass->getHash(), shader->getName());
+    auto recordIter = recordsByProgram.find(programHash);
+    if (recordIter == recordsByProgram.end() || !hasUncompiledRecords(recordIter->second)) {
+        return;
+    }
+
+    auto &tmpl = templates[programHash];
+    tmpl.shader = shader;
+    tmpl.pipelineLayout = pass->getPipelineLayout();
+    tmpl.info = {shader,
+                 pass->getPipelineLayout(),
+                 nullptr,
+                 {},
+                 *(pass->getRasterizerState()),
+                 *(pass->getDepthStencilState()),
+                 *(pass->getBlendState()),
+                 pass->getPrimitive(),
+                 pass->getDynamicStates(),
+                 gfx::PipelineBindPoint::GRAPHICS,
+                 0};
+
+    for (const auto key : recordIter->second) {
+        auto &record = records[key];
+        if (record.compiled) {
+            continue;
+        }
+        auto renderPassIter = renderPasses.find(record.renderPassHash);
+        // render pass destroyed since it was registered
+        if (renderPassIter == renderPasses.end() || !renderPassIter->second->getHash()) {
+            continue;
+        }
+        gfx::PipelineStateInfo info;
+        const auto hash = getPrewarmInfo(record, tmpl, renderPassIter->second, &info);
+        compilePrewarmed(hash, info);
+        record.compiled = true;
+    }
+    if (!hasUncompiledRecords(recordIter->second)) {
+        templates.erase(programHash);
+    }
+}
+
+void PipelineStateManager::registerRenderPass(gfx::RenderPass *renderPass) {
+    const auto renderPassHash = getRenderPassCompatibleHash(renderPass);
+    auto recordIter = recordsByRenderPass.find(renderPassHash);
+    // only kept while recorded states are waiting for it
+    if (recordIter == recordsByRenderPass.end() || !hasUncompiledRecords(recordIter->second)) {
+        return;
+    }
+    auto &registered = renderPasses[renderPassHash];
+    if (registered == renderPass || (registered && registered->getHash())) {
+        return;
+    }
+    registered = renderPass;
+
+    for (const auto key : recordIter->second) {
+        auto &record = records[key];
+        if (record.compiled) {
+            continue;
+        }
+        auto tmplIter = templates.find(getProgramHash(record.passHash, record.shaderName));
+        if (tmplIter == templates.end()) {
+            continue;
+        }
+        gfx::PipelineStateInfo info;
+        const auto hash = getPrewarmInfo(record, tmplIter->second, renderPass, &info);
+        compilePrewarmed(hash, info);
+        record.compiled = true;
+    }
+    releaseUnusedReferences();
+}
+
+void PipelineStateManager::compilePrewarmed(ccstd::hash_t hash, const gfx::PipelineStateInfo &info) {
+    if (psoHashMap.count(hash)) {
+        return;
+    }
+    ++statistics.prewarmed;
+    psoHashMap.emplace(hash, createPipelineState(info, &statistics.compileTimeUS));
+}
+
+const PipelineStateStatistics &PipelineStateManager::getStatistics() {
+    return statistics;
+}
+
+void PipelineStateManager::resetStatistics() {
+    statistics = {};
+}
+
 void PipelineStateManager::destroyAll() {
+    saveRecords();
+    for (auto &pair : records) {
+        pair.second.compiled = false;
+    }
+    templates.clear();
+    renderPasses.clear();
+
     for (auto &pair : psoHashMap) {
         CC_SAFE_DESTROY_NULL(pair.second);
     }
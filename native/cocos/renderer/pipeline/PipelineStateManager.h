@@ -33,6 +33,17 @@ class Pass;
 }
 namespace pipeline {
 
+/**
+ * @en Pipeline state cache statistics, accumulated since the last call to resetStatistics.
+ * @zh 管线状态缓存统计，从上次调用 resetStatistics 开始累计。
+ */
+struct PipelineStateStatistics {
+    uint32_t hits{0};
+    uint32_t misses{0};
+    uint32_t prewarmed{0};
+    uint64_t compileTimeUS{0};
+};
+
 class CC_DLL PipelineStateManager {
 public:
     static gfx::PipelineState *getOrCreatePipelineState(const scene::Pass *pass,
@@ -42,7 +53,20 @@ public:
                                                         uint32_t subpass = 0);
     static void destroyAll();
 
+    /**
+     * @en Compile the pipeline states recorded in previous runs for this pass and shader variant.
+     * Recorded states are compiled as soon as a compatible render pass is in use.
+     * @zh 为此 pass 和 shader 变体编译之前运行时记录的管线状态，一旦有兼容的 render pass 就会编译。
+     */
+    static void prewarm(const scene::Pass *pass, gfx::Shader *shader);
+
+    static const PipelineStateStatistics &getStatistics();
+    static void resetStatistics();
+
 private:
+    static void registerRenderPass(gfx::RenderPass *renderPass);
+    static void compilePrewarmed(ccstd::hash_t hash, const gfx::PipelineStateInfo &info);
+
     static ccstd::unordered_map<ccstd::hash_t, IntrusivePtr<gfx::PipelineState>> psoHashMap;
 };
 
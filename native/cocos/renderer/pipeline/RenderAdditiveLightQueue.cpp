@@ -115,16 +115,23 @@ void RenderAdditiveLightQueue::gatherLightPasses(const scene::Camera *camera, gf
     updateUBOs(camera, cmdBuffer);
     updateLightDescriptorSet(camera, cmdBuffer);
 
+    // lights are assigned to every model with a light pass at once
+    _litModels.clear();
     const auto &renderObjects = _pipeline->getPipelineSceneData()->getRenderObjects();
     for (const auto &renderObject : renderObjects) {
-        const auto *const model = renderObject.model;
-        if (!getLightPassIndex(model, &lightPassIndices)) continue;
-
-        _lightIndices.clear();
+        if (getLightPassIndex(renderObject.model, &lightPassIndices)) {
+            _litModels.emplace_back(renderObject.model);
+        }
+    }
+    _lightBinning.setLights(_validPunctualLights);
+    _lightBinning.assign(_litModels.data(), utils::toUint(_litModels.size()));
 
-        lightCulling(model);
+    for (uint32_t m = 0; m < _litModels.size(); ++m) {
+        const auto *const model = _litModels[m];
+        const auto &lightIndices = _lightBinning.getLightIndices(m);
+        if (lightIndices.empty()) continue;
 
-        if (_lightIndices.empty()) continue;
+        getLightPassIndex(model, &lightPassIndices);
         int i = 0;
         for (const auto &subModel : model->getSubModels()) {
             const auto lightPassIdx = lightPassIndices[i];
@@ -140,7 +147,7 @@ void RenderAdditiveLightQueue::gatherLightPasses(const scene::Camera *camera, gf
             descriptorSet->bindBuffer(UBOForwardLight::BINDING, _firstLightBufferView);
             descriptorSet->update();
 
-            addRenderQueue(subModel, model, pass, lightPassIdx);
+            addRenderQueue(subModel, model, pass, lightPassIdx, lightIndices);
 
             ++i;
         }
@@ -171,29 +178,13 @@ void RenderAdditiveLightQueue::clear() {
 
     _instancedLightPass.dynamicOffsets.clear();
     _instancedLightPass.lights.clear();
-}
-
-bool RenderAdditiveLightQueue::cullSphereLight(const scene::SphereLight *light, const scene::Model *model) {
-    return model->getWorldBounds() && !model->getWorldBounds()->aabbAabb(light->getAABB());
-}
 
-bool RenderAdditiveLightQueue::cullSpotLight(const scene::SpotLight *light, const scene::Model *model) {
-    return model->getWorldBounds() && (!model->getWorldBounds()->aabbAabb(light->getAABB()) || !model->getWorldBounds()->aabbFrustum(light->getFrustum()));
+    _litModels.clear();
+    _lightBinning.clear();
 }
 
-bool RenderAdditiveLightQueue::cullPointLight(const scene::PointLight *light, const scene::Model *model) {
-    return model->getWorldBounds() && !model->getWorldBounds()->aabbAabb(light->getAABB());
-}
-
-bool RenderAdditiveLightQueue::cullRangedDirLight(const scene::RangedDirectionalLight *light, const scene::Model *model) {
-    geometry::AABB rangedDirLightBoundingBox(0.0F, 0.0F, 0.0F, 0.5F, 0.5F, 0.5F);
-    light->getNode()->updateWorldTransform();
-    rangedDirLightBoundingBox.transform(light->getNode()->getWorldMatrix(), &rangedDirLightBoundingBox);
-    return model->getWorldBounds() && (!model->getWorldBounds()->aabbAabb(rangedDirLightBoundingBox));
-}
-
-void RenderAdditiveLightQueue::addRenderQueue(scene::SubModel *subModel, const scene::Model *model, scene::Pass *pass, uint32_t lightPassIdx) {
-    const auto lightCount = _lightIndices.size();
+void RenderAdditiveLightQueue::addRenderQueue(scene::SubModel *subModel, const scene::Model *model, scene::Pass *pass, uint32_t lightPassIdx, const ccstd::vector<uint32_t> &lightIndices) {
+    const auto lightCount = lightIndices.size();
     const auto batchingScheme = pass->getBatchingScheme();
 
     AdditiveLightPass lightPass;
@@ -205,7 +196,7 @@ void RenderAdditiveLightQueue::addRenderQueue(scene::SubModel *subModel, const s
     }
 
     for (uint32_t i = 0; i < lightCount; ++i) {
-        const auto lightIdx = _lightIndices[i];
+        const auto lightIdx = lightIndices[i];
         const auto *light = _validPunctualLights[lightIdx];
         const auto visibility = light->getVisibility();
         if ((visibility & model->getNode()->getLayer()) == model->getNode()->getLayer()) {
@@ -499,32 +490,5 @@ bool RenderAdditiveLightQueue::getLightPassIndex(const scene::Model *model, ccst
     return hasValidLightPass;
 }
 
-void RenderAdditiveLightQueue::lightCulling(const scene::Model *model) {
-    bool isCulled = false;
-    for (size_t i = 0; i < _validPunctualLights.size(); i++) {
-        const auto *const light = _validPunctualLights[i];
-        switch (light->getType()) {
-            case scene::LightType::SPHERE:
-                isCulled = cullSphereLight(static_cast<const scene::SphereLight *>(light), model);
-                break;
-            case scene::LightType::SPOT:
-                isCulled = cullSpotLight(static_cast<const scene::SpotLight *>(light), model);
-                break;
-            case scene::LightType::POINT:
-                isCulled = cullSphereLight(static_cast<const scene::SphereLight *>(light), model);
-                break;
-            case scene::LightType::RANGED_DIRECTIONAL:
-                isCulled = cullRangedDirLight(static_cast<const scene::RangedDirectionalLight *>(light), model);
-                break;
-            default:
-                isCulled = false;
-                break;
-        }
-        if (!isCulled) {
-            _lightIndices.emplace_back(utils::toUint(i));
-        }
-    }
-}
-
 } // namespace pipeline
 } // namespace cc
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "Define.h"
+#include "LightBinning.h"
 #include "base/Ptr.h"
 #include "base/std/container/array.h"
 
@@ -33,10 +34,6 @@ namespace scene {
 class Camera;
 class Pass;
 class Light;
-class SpotLight;
-class SphereLight;
-class PointLight;
-class RangedDirectionalLight;
 } // namespace scene
 namespace pipeline {
 struct RenderObject;
@@ -61,17 +58,11 @@ public:
     void gatherLightPasses(const scene::Camera *camera, gfx::CommandBuffer *cmdBuffer);
 
 private:
-    static bool cullSphereLight(const scene::SphereLight *light, const scene::Model *model);
-    static bool cullSpotLight(const scene::SpotLight *light, const scene::Model *model);
-    static bool cullPointLight(const scene::PointLight *light, const scene::Model *model);
-    static bool cullRangedDirLight(const scene::RangedDirectionalLight *light, const scene::Model *model);
-
     void clear();
-    void addRenderQueue(scene::SubModel *subModel, const scene::Model *model, scene::Pass *pass, uint32_t lightPassIdx);
+    void addRenderQueue(scene::SubModel *subModel, const scene::Model *model, scene::Pass *pass, uint32_t lightPassIdx, const ccstd::vector<uint32_t> &lightIndices);
     void updateUBOs(const scene::Camera *camera, gfx::CommandBuffer *cmdBuffer);
     void updateLightDescriptorSet(const scene::Camera *camera, gfx::CommandBuffer *cmdBuffer);
     bool getLightPassIndex(const scene::Model *model, ccstd::vector<uint32_t> *lightPassIndices) const;
-    void lightCulling(const scene::Model *model);
 
     uint32_t _lightBufferStride{0};
     uint32_t _lightBufferElementCount{0};
@@ -89,7 +80,10 @@ private:
     AdditiveLightPass _instancedLightPass;
 
     ccstd::vector<uint32_t> _dynamicOffsets;
-    ccstd::vector<uint32_t> _lightIndices;
+
+    LightBinning _lightBinning;
+    // weak reference, models with a light pass
+    ccstd::vector<const scene::Model *> _litModels;
 
     ccstd::vector<float> _lightBufferData;
     ccstd::array<float, UBOShadow::COUNT> _shadowUBO{};
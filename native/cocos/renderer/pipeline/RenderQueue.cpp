@@ -40,10 +40,21 @@ namespace pipeline {
 
 RenderQueue::RenderQueue(RenderPipeline *pipeline, RenderQueueCreateInfo desc, bool useOcclusionQuery)
 : _pipeline(pipeline), _passDesc(std::move(desc)), _useOcclusionQuery(useOcclusionQuery) {
+    using CompareFn = bool (*)(const RenderPass &, const RenderPass &);
+    const auto *compareFn = _passDesc.sortFunc.target<CompareFn>();
+    if (compareFn && *compareFn == opaqueCompareFn) {
+        _sortMode = RenderQueueSortMode::FRONT_TO_BACK;
+        _useSortKeys = true;
+    } else if (compareFn && *compareFn == transparentCompareFn) {
+        _sortMode = RenderQueueSortMode::BACK_TO_FRONT;
+        _useSortKeys = true;
+    }
 }
 
 void RenderQueue::clear() {
     _queue.clear();
+    _sortKeys.clear();
+    _sortKeysValid = true;
 }
 
 bool RenderQueue::insertRenderPass(const RenderObject &renderObj, uint32_t subModelIdx, uint32_t passIdx) {
@@ -57,16 +68,42 @@ bool RenderQueue::insertRenderPass(const RenderObject &renderObj, uint32_t subMo
 
     auto passPriority = static_cast<uint32_t>(pass->getPriority());
     auto modelPriority = static_cast<uint32_t>(subModel->getPriority());
-    auto shaderId = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(subModel->getShader(passIdx)));
+    const auto *shader = subModel->getShader(passIdx);
+    auto shaderId = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(shader));
     const auto hash = (0 << 30) | (passPriority << 16) | (modelPriority << 8) | passIdx;
     const auto priority = renderObj.model->getPriority();
     RenderPass renderPass = {priority, hash, renderObj.depth, shaderId, passIdx, subModel};
+
+    if (_useSortKeys && _sortKeysValid) {
+        RenderQueueSortKey sortKey;
+        sortKey.index = static_cast<uint32_t>(_queue.size());
+        if (_sortMode == RenderQueueSortMode::FRONT_TO_BACK) {
+            sortKey.key = makeOpaqueSortKey(hash, renderObj.depth);
+        } else {
+            _sortKeysValid = makeTransparentSortKey(priority, hash, renderObj.depth, &sortKey.key);
+        }
+        _sortKeys.emplace_back(sortKey);
+    }
     _queue.emplace_back(renderPass);
 
     return true;
 }
 
 void RenderQueue::sort() {
+    if (_useSortKeys && _sortKeysValid) {
+        const auto count = static_cast<uint32_t>(_queue.size());
+        _sortScratch.resize(count);
+        sortRenderQueueKeys(_sortKeys.data(), _sortScratch.data(), count);
+        sortRenderQueueKeyTies(_sortKeys.data(), count, [this](uint32_t index) { return _queue[index].shaderID; });
+        _sortedQueue.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            _sortedQueue[i] = _queue[_sortKeys[i].index];
+            _sortKeys[i].index = i;
+        }
+        _queue.swap(_sortedQueue);
+        return;
+    }
+
 #if CC_PLATFORM != CC_PLATFORM_LINUX && CC_PLATFORM != CC_PLATFORM_QNX
     std::sort(_queue.begin(), _queue.end(), _passDesc.sortFunc);
 #else
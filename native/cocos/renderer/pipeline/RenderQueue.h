@@ -25,6 +25,7 @@
 #pragma once
 
 #include "Define.h"
+#include "RenderQueueSort.h"
 
 namespace cc {
 namespace scene {
@@ -50,6 +51,13 @@ private:
     RenderPassList _queue;
     RenderQueueCreateInfo _passDesc;
     bool _useOcclusionQuery{false};
+    // packed keys are used when sorting with one of the builtin compare functions
+    RenderQueueSortMode _sortMode{RenderQueueSortMode::FRONT_TO_BACK};
+    bool _useSortKeys{false};
+    bool _sortKeysValid{true};
+    ccstd::vector<RenderQueueSortKey> _sortKeys;
+    ccstd::vector<RenderQueueSortKey> _sortScratch;
+    RenderPassList _sortedQueue;
 };
 
 } // namespace pipeline
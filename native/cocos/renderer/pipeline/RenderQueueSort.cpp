@@ -0,0 +1,82 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#include "RenderQueueSort.h"
+#include <algorithm>
+#include <utility>
+
+namespace cc {
+namespace pipeline {
+
+namespace {
+// comparison sort is faster for short queues
+constexpr uint32_t RADIX_SORT_MIN_COUNT = 64;
+constexpr uint32_t RADIX_DIGIT_COUNT = 8;
+constexpr uint32_t RADIX_BUCKET_COUNT = 256;
+} // namespace
+
+void sortRenderQueueKeys(RenderQueueSortKey *keys, RenderQueueSortKey *scratch, uint32_t count) {
+    if (count < RADIX_SORT_MIN_COUNT) {
+        std::sort(keys, keys + count, [](const RenderQueueSortKey &lhs, const RenderQueueSortKey &rhs) {
+            return lhs.key != rhs.key ? lhs.key < rhs.key : lhs.index < rhs.index;
+        });
+        return;
+    }
+
+    // histograms of all the digits in a single pass
+    uint32_t histograms[RADIX_DIGIT_COUNT][RADIX_BUCKET_COUNT] = {};
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint64_t key = keys[i].key;
+        for (uint32_t digit = 0; digit < RADIX_DIGIT_COUNT; ++digit) {
+            ++histograms[digit][(key >> (digit * 8)) & 0xFFU];
+        }
+    }
+
+    RenderQueueSortKey *src = keys;
+    RenderQueueSortKey *dst = scratch;
+    for (uint32_t digit = 0; digit < RADIX_DIGIT_COUNT; ++digit) {
+        uint32_t *histogram = histograms[digit];
+        // every key has the same value for this digit
+        if (histogram[(src[0].key >> (digit * 8)) & 0xFFU] == count) {
+            continue;
+        }
+        uint32_t offset = 0;
+        for (uint32_t bucket = 0; bucket < RADIX_BUCKET_COUNT; ++bucket) {
+            const uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            dst[histogram[(src[i].key >> (digit * 8)) & 0xFFU]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != keys) {
+        std::copy(src, src + count, keys);
+    }
+}
+
+} // namespace pipeline
+} // namespace cc
@@ -0,0 +1,105 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "base/Macros.h"
+
+namespace cc {
+namespace pipeline {
+
+/**
+ * @en Packed sort key of a render queue entry, `index` refers to the entry in the queue.
+ * @zh 渲染队列条目的紧凑排序键，`index` 为条目在队列中的索引。
+ */
+struct RenderQueueSortKey {
+    uint64_t key{0};
+    uint32_t index{0};
+};
+
+// Maps a float to an unsigned integer with the same ordering.
+inline uint32_t getSortableDepth(float depth) {
+    uint32_t bits = 0;
+    memcpy(&bits, &depth, sizeof(bits));
+    return (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+}
+
+/**
+ * @en Key sorting by hash then front to back depth, ties are left to sortRenderQueueKeyTies.
+ * @zh 依次按 hash、由近到远的深度排序的键，相同的键由 sortRenderQueueKeyTies 处理。
+ */
+inline uint64_t makeOpaqueSortKey(uint32_t hash, float depth) {
+    return (static_cast<uint64_t>(hash) << 32) | getSortableDepth(depth);
+}
+
+/**
+ * @en Key sorting by priority, hash then back to front depth, ties are left to sortRenderQueueKeyTies.
+ * Returns false if the priority or the hash does not fit in the key.
+ * @zh 依次按优先级、hash、由远到近的深度排序的键，相同的键由 sortRenderQueueKeyTies 处理。
+ * 优先级或 hash 超出键的范围时返回 false。
+ */
+inline bool makeTransparentSortKey(uint32_t priority, uint32_t hash, float depth, uint64_t *key) {
+    if (priority > 0xFFU || hash > 0xFFFFFFU) {
+        return false;
+    }
+    *key = (static_cast<uint64_t>(priority) << 56) | (static_cast<uint64_t>(hash) << 32) | ~getSortableDepth(depth);
+    return true;
+}
+
+/**
+ * @en Stable sort of the keys in ascending order, least significant digit radix sort for large queues.
+ * `scratch` must hold at least `count` elements.
+ * @zh 按升序稳定排序，较大的队列使用低位优先的基数排序。`scratch` 至少需要 `count` 个元素。
+ */
+CC_DLL void sortRenderQueueKeys(RenderQueueSortKey *keys, RenderQueueSortKey *scratch, uint32_t count);
+
+/**
+ * @en Orders the runs of equal keys in sorted `keys` by shader, the last tie-break of opaqueCompareFn
+ * and transparentCompareFn that the keys have no room for. `getShaderID` maps an entry index to its shader id.
+ * @zh 将已排序的 `keys` 中键相同的条目按 shader 排序，即比较函数最后一级、键中放不下的排序条件。
+ * `getShaderID` 由条目索引返回其 shader id。
+ */
+template <class GetShaderID>
+void sortRenderQueueKeyTies(RenderQueueSortKey *keys, uint32_t count, const GetShaderID &getShaderID) {
+    uint32_t first = 0;
+    while (first < count) {
+        uint32_t last = first + 1;
+        while (last < count && keys[last].key == keys[first].key) {
+            ++last;
+        }
+        // runs are short, equal depths are rare
+        if (last - first > 1) {
+            std::stable_sort(keys + first, keys + last, [&](const RenderQueueSortKey &lhs, const RenderQueueSortKey &rhs) {
+                return getShaderID(lhs.index) < getShaderID(rhs.index);
+            });
+        }
+        first = last;
+    }
+}
+
+} // namespace pipeline
+} // namespace cc
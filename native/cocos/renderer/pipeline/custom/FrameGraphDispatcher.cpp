@@ -28,11 +28,12 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/breadth_first_search.hpp>
 #include <boost/graph/filtered_graph.hpp>
-#include <boost/graph/transitive_closure.hpp>
 #include <boost/range/algorithm.hpp>
 #include <iterator>
 #include <limits>
 #include <numeric>
+#include <stack>
+#include <tuple>
 #include <vector>
 #include "FGDispatcherGraphs.h"
 #include "FGDispatcherTypes.h"
@@ -383,14 +384,6 @@ LayoutAccess FrameGraphDispatcher::getResourceAccess(ResourceGraph::vertex_descr
 
 //---------------------------------------------------------------predefine------------------------------------------------------------------
 using PmrString = ccstd::pmr::string;
-using EdgeList = std::pair<RelationGraph::edge_descriptor, RelationGraph::edge_descriptor>;
-using CloseCircuit = std::pair<EdgeList, EdgeList>;
-using CloseCircuits = ccstd::vector<CloseCircuit>;
-using RelationVert = RelationGraph::vertex_descriptor;
-using RelationVerts = ccstd::vector<RelationVert>;
-using RelationEdge = RelationGraph::edge_descriptor;
-using RelationEdges = ccstd::vector<RelationEdge>;
-using ScoreMap = std::map<RelationVert, std::pair<int64_t /*backward*/, int64_t /*forward*/>>;
 using RasterViewsMap = PmrTransparentMap<ccstd::pmr::string, RasterView>;
 using ComputeViewsMap = PmrTransparentMap<ccstd::pmr::string, ccstd::pmr::vector<ComputeView>>;
 using ResourceLifeRecordMap = PmrFlatMap<PmrString, ResourceLifeRecord>;
@@ -481,12 +474,6 @@ bool accessDependent(const gfx::AccessFlagBit lhs, const gfx::AccessFlagBit &rhs
 template <typename Graph>
 bool tryAddEdge(uint32_t srcVertex, uint32_t dstVertex, Graph &graph);
 
-// for transive_closure.hpp line 231
-inline RelationGraph::vertex_descriptor add_vertex(RelationGraph &g) { // NOLINT
-    thread_local uint32_t count = 0;                                   // unused
-    return add_vertex(g, count++);
-}
-
 bool isResourceView(const ResourceGraph::vertex_descriptor v, const ResourceGraph &resg) {
     return resg.isTextureView(v); // || isBufferView
 }
@@ -1868,6 +1855,24 @@ void buildBarriers(FrameGraphDispatcher &fgDispatcher) {
         return gfxBarrier;
     };
 
+    // execution position of passes, passes reordered or culled are not in vertex order.
+    const auto numVerts = num_vertices(rag);
+    ccstd::pmr::vector<uint32_t> executionOrder(numVerts, INVALID_ID, scratch);
+    for (uint32_t order = 0; order != rag.topologicalOrder.size(); ++order) {
+        executionOrder[rag.topologicalOrder[order]] = order;
+    }
+    for (uint32_t vertID = 0, order = 0; vertID != numVerts; ++vertID) {
+        if (executionOrder[vertID] == INVALID_ID) {
+            executionOrder[vertID] = order;
+        }
+        order = executionOrder[vertID];
+    }
+    auto getOrder = [&](uint32_t ragVertID) {
+        return ragVertID < numVerts ? executionOrder[ragVertID] : ragVertID;
+    };
+    using AccessRecord = PmrFlatMap<uint32_t, AccessStatus>;
+    ccstd::pmr::vector<const AccessRecord::value_type *> orderedAccesses(scratch);
+
     // found pass id in this map ? barriers you should commit when run into this pass
     // : or no extra barrier needed.
     for (auto &accessPair : rag.resourceAccess) {
@@ -1879,12 +1884,20 @@ void buildBarriers(FrameGraphDispatcher &fgDispatcher) {
         bool isBuffer = desc.dimension == ResourceDimension::BUFFER;
 
         const auto &accessRecord = accessPair.second;
-        auto iter = accessRecord.begin();
+        orderedAccesses.clear();
+        for (const auto &access : accessRecord) {
+            orderedAccesses.emplace_back(&access);
+        }
+        std::stable_sort(orderedAccesses.begin(), orderedAccesses.end(), [&](const auto *lhs, const auto *rhs) {
+            return getOrder(lhs->first) < getOrder(rhs->first);
+        });
+
+        auto iter = orderedAccesses.begin();
         auto nextIter = iter;
         std::advance(nextIter, 1);
-        for (; nextIter != accessRecord.end(); ++iter, ++nextIter) {
-            auto srcRagVertID = iter->first;
-            auto dstRagVertID = nextIter->first;
+        for (; nextIter != orderedAccesses.end(); ++iter, ++nextIter) {
+            auto srcRagVertID = (*iter)->first;
+            auto dstRagVertID = (*nextIter)->first;
             auto srcPassID = get(ResourceAccessGraph::PassIDTag{}, rag, srcRagVertID);
             auto dstPassID = get(ResourceAccessGraph::PassIDTag{}, rag, dstRagVertID);
 
@@ -1910,23 +1923,23 @@ void buildBarriers(FrameGraphDispatcher &fgDispatcher) {
                 auto colorIter = std::find(fgRenderPassInfo.orderedViews.begin(), fgRenderPassInfo.orderedViews.end(), resName);
                 auto colorIndex = std::distance(fgRenderPassInfo.orderedViews.begin(), colorIter);
                 if (colorIndex < fgRenderPassInfo.colorAccesses.size()) {
-                    fgRenderPassInfo.colorAccesses[colorIndex].nextAccess = nextIter->second.accessFlag;
+                    fgRenderPassInfo.colorAccesses[colorIndex].nextAccess = (*nextIter)->second.accessFlag;
                 } else if (colorIndex == fgRenderPassInfo.colorAccesses.size()) {
-                    fgRenderPassInfo.dsAccess.nextAccess = nextIter->second.accessFlag;
+                    fgRenderPassInfo.dsAccess.nextAccess = (*nextIter)->second.accessFlag;
                 } else if (colorIndex == fgRenderPassInfo.colorAccesses.size() + 1) {
-                    fgRenderPassInfo.dsResolveAccess.nextAccess = nextIter->second.accessFlag;
+                    fgRenderPassInfo.dsResolveAccess.nextAccess = (*nextIter)->second.accessFlag;
                 }
 
                 if (holds<RasterSubpassTag>(srcPassID, renderGraph) &&
-                    accessDependent(iter->second.accessFlag, nextIter->second.accessFlag, isBuffer)) {
+                    accessDependent((*iter)->second.accessFlag, (*nextIter)->second.accessFlag, isBuffer)) {
                     const auto *subpass = get_if<RasterSubpass>(srcPassID, &renderGraph);
                     CC_ASSERT(subpass);
                     auto subpassID = subpass->subpassID;
                     auto &dependency = fgRenderPassInfo.rpInfo.dependencies.emplace_back();
                     dependency.srcSubpass = subpass->subpassID;
                     dependency.dstSubpass = INVALID_ID;
-                    dependency.prevAccesses = iter->second.accessFlag;
-                    dependency.nextAccesses = nextIter->second.accessFlag;
+                    dependency.prevAccesses = (*iter)->second.accessFlag;
+                    dependency.nextAccesses = (*nextIter)->second.accessFlag;
                 }
                 continue;
             }
@@ -1943,18 +1956,18 @@ void buildBarriers(FrameGraphDispatcher &fgDispatcher) {
                 firstMeetBarrier.type = gfx::BarrierType::FULL;
                 firstMeetBarrier.beginVert = dstPassID;
                 firstMeetBarrier.endVert = dstPassID;
-                firstMeetBarrier.beginStatus = iter->second;
-                firstMeetBarrier.endStatus = nextIter->second;
+                firstMeetBarrier.beginStatus = (*iter)->second;
+                firstMeetBarrier.endStatus = (*nextIter)->second;
                 firstMeetBarrier.barrier = getGFXBarrier(firstMeetBarrier);
-            } else if (accessDependent(iter->second.accessFlag, nextIter->second.accessFlag, isBuffer)) {
+            } else if (accessDependent((*iter)->second.accessFlag, (*nextIter)->second.accessFlag, isBuffer)) {
                 auto &srcBarrierNode = get(ResourceAccessGraph::BarrierTag{}, rag, srcRagVertID);
                 auto &beginBarrier = srcBarrierNode.rearBarriers.emplace_back();
                 beginBarrier.resourceID = realResourceID;
                 beginBarrier.beginVert = srcPassID;
                 beginBarrier.endVert = dstPassID;
-                beginBarrier.beginStatus = iter->second;
-                beginBarrier.endStatus = nextIter->second;
-                if (isPassExecAdjecent(iter->first, nextIter->first)) {
+                beginBarrier.beginStatus = (*iter)->second;
+                beginBarrier.endStatus = (*nextIter)->second;
+                if (isPassExecAdjecent(getOrder((*iter)->first), getOrder((*nextIter)->first))) {
                     beginBarrier.type = gfx::BarrierType::FULL;
                 } else {
                     beginBarrier.type = gfx::BarrierType::SPLIT_BEGIN;
@@ -1965,8 +1978,8 @@ void buildBarriers(FrameGraphDispatcher &fgDispatcher) {
                     endBarrier.type = gfx::BarrierType::SPLIT_END;
                     endBarrier.beginVert = srcPassID;
                     endBarrier.endVert = dstPassID;
-                    endBarrier.beginStatus = iter->second;
-                    endBarrier.endStatus = nextIter->second;
+                    endBarrier.beginStatus = (*iter)->second;
+                    endBarrier.endStatus = (*nextIter)->second;
                     endBarrier.barrier = getGFXBarrier(endBarrier);
                 }
                 beginBarrier.barrier = getGFXBarrier(beginBarrier);
@@ -1975,17 +1988,17 @@ void buildBarriers(FrameGraphDispatcher &fgDispatcher) {
         const auto &traits = get(ResourceGraph::TraitsTag{}, resourceGraph, realResourceID);
         auto &states = get(ResourceGraph::StatesTag{}, resourceGraph, realResourceID);
         if (traits.hasSideEffects()) {
-            states.states = iter->second.accessFlag;
+            states.states = (*iter)->second.accessFlag;
             if (traits.residency == ResourceResidency::BACKBUFFER) {
-                auto lastAccessPassID = get(ResourceAccessGraph::PassIDTag{}, rag, iter->first);
-                auto &barrierNode = get(ResourceAccessGraph::BarrierTag{}, rag, iter->first);
+                auto lastAccessPassID = get(ResourceAccessGraph::PassIDTag{}, rag, (*iter)->first);
+                auto &barrierNode = get(ResourceAccessGraph::BarrierTag{}, rag, (*iter)->first);
                 auto &presentBarrier = barrierNode.rearBarriers.emplace_back();
                 presentBarrier.resourceID = realResourceID;
                 presentBarrier.type = gfx::BarrierType::FULL;
                 presentBarrier.beginVert = lastAccessPassID;
                 presentBarrier.endVert = lastAccessPassID;
-                presentBarrier.beginStatus = iter->second;
-                presentBarrier.endStatus = {gfx::AccessFlagBit::PRESENT, iter->second.range};
+                presentBarrier.beginStatus = (*iter)->second;
+                presentBarrier.endStatus = {gfx::AccessFlagBit::PRESENT, (*iter)->second.range};
                 presentBarrier.barrier = getGFXBarrier(presentBarrier);
 
                 states.states = gfx::AccessFlagBit::NONE;
@@ -2024,408 +2037,455 @@ void buildBarriers(FrameGraphDispatcher &fgDispatcher) {
 #pragma endregion BUILD_BARRIERS
 
 #pragma region PASS_REORDER
+namespace {
 
-struct PassVisitor : boost::dfs_visitor<> {
-    using RLGVertex = RelationGraph::vertex_descriptor;
-    using RLGEdge = RelationGraph::edge_descriptor;
-    using InEdgeRange = std::pair<RelationGraph::in_edge_iterator, RelationGraph::in_edge_iterator>;
-    using OutEdgeRange = std::pair<RelationGraph::out_edge_iterator, RelationGraph::out_edge_iterator>;
+// a render pass and its subpasses are scheduled as a whole
+struct ScheduleNode {
+    explicit ScheduleNode(boost::container::pmr::memory_resource *scratch)
+    : members(scratch), successors(scratch), resources(scratch) {}
+
+    // render pass first, then its subpasses
+    ccstd::pmr::vector<ResourceAccessGraph::vertex_descriptor> members;
+    ccstd::pmr::vector<uint32_t> successors;
+    // transient resources accessed by the node
+    ccstd::pmr::vector<uint32_t> resources;
+    uint32_t numPredecessors{0};
+    // one past the position of the latest scheduled predecessor
+    uint32_t readyPosition{0};
+};
 
-    PassVisitor(RelationGraph &tcIn, CloseCircuits &circuitsIn) : _relationGraph(tcIn), _circuits(circuitsIn) {}
+struct TransientUsage {
+    int64_t size{0};
+    uint32_t numNodes{0};
+    bool allocated{false};
+};
 
-    void start_vertex(RLGVertex u, const RelationGraph &g) {}
+int64_t getResourceSize(const ResourceDesc &desc) {
+    if (desc.dimension == ResourceDimension::BUFFER) {
+        return desc.width;
+    }
+    return gfx::formatSize(desc.format, desc.width, desc.height, desc.depthOrArraySize);
+}
 
-    void discover_vertex(RLGVertex u, const RelationGraph &g) {}
+void addScheduleEdge(ccstd::pmr::vector<ScheduleNode> &nodes, uint32_t from, uint32_t to) {
+    if (from == INVALID_ID || to == INVALID_ID || from == to) {
+        return;
+    }
+    auto &successors = nodes[from].successors;
+    if (std::find(successors.begin(), successors.end(), to) == successors.end()) {
+        successors.emplace_back(to);
+        ++nodes[to].numPredecessors;
+    }
+}
 
-    void examine_edge(RLGEdge e, const RelationGraph &g) {
+// bytes released minus bytes allocated if the node is executed next
+int64_t getMemoryGain(const ScheduleNode &node, const ccstd::pmr::vector<TransientUsage> &usages) {
+    int64_t gain = 0;
+    for (const auto resourceID : node.resources) {
+        const auto &usage = usages[resourceID];
+        if (!usage.allocated) {
+            gain -= usage.size;
+        }
+        if (usage.numNodes == 1) {
+            gain += usage.size;
+        }
     }
+    return gain;
+}
 
-    void tree_edge(RLGEdge e, const RelationGraph &g) {}
+} // namespace
+
+// List scheduling of the passes, dependencies are always kept.
+// Among the passes ready to run, the next one is chosen by:
+// - distance to its latest producer, passes far from their inputs let
+//   split barriers and the gpu overlap independent work (paralellExecWeight);
+// - transient memory released minus allocated (1 - paralellExecWeight).
+// Ties keep the order of the render graph.
+void passReorder(FrameGraphDispatcher &fgDispatcher) {
+    auto *scratch = fgDispatcher.scratch;
+    const auto &renderGraph = fgDispatcher.renderGraph;
+    const auto &layoutGraph = fgDispatcher.layoutGraph;
+    auto &resourceGraph = fgDispatcher.resourceGraph;
+    auto &relationGraph = fgDispatcher.relationGraph;
+    auto &rag = fgDispatcher.resourceAccessGraph;
 
-    void back_edge(RLGEdge e, const RelationGraph &g) {}
+    if (!fgDispatcher._accessGraphBuilt) {
+        Graphs graphs{renderGraph, layoutGraph, resourceGraph, rag, relationGraph};
+        buildAccessGraph(graphs);
+        fgDispatcher._accessGraphBuilt = true;
+    }
 
-    void forward_or_cross_edge(RLGEdge e, const RelationGraph &g) {
-        // the vertex which:
-        // 1. is ancestor of targetID;
-        // 2. sourceID is reachable at this specific vert;
-        // is where the closed-path started.
-        // note that `reachable` may results to multiple paths, choose the shortest one.
-        auto sourceID = source(e, g);
-        auto targetID = target(e, g);
+    // moved resources share memory under different names, keep the recorded order
+    if (!rag.movedTarget.empty() || !rag.movedSourceStatus.empty()) {
+        return;
+    }
 
-        using RhsRangePair = std::pair<RelationGraph::in_edge_iterator, InEdgeRange>;
+    // schedule nodes, culled passes are not in the topological order
+    const auto numVerts = num_vertices(rag);
+    ccstd::pmr::vector<uint32_t> nodeIndex(numVerts, INVALID_ID, scratch);
+    ccstd::pmr::vector<ScheduleNode> nodes(scratch);
+    for (const auto ragVertID : rag.topologicalOrder) {
+        if (ragVertID == EXPECT_START_ID) {
+            continue;
+        }
+        const auto passID = get(ResourceAccessGraph::PassIDTag{}, rag, ragVertID);
+        if (passID != RenderGraph::null_vertex() &&
+            (holds<RasterSubpassTag>(passID, renderGraph) || holds<ComputeSubpassTag>(passID, renderGraph))) {
+            auto iter = rag.passIndex.find(parent(passID, renderGraph));
+            if (iter != rag.passIndex.end() && nodeIndex[iter->second] != INVALID_ID) {
+                nodeIndex[ragVertID] = nodeIndex[iter->second];
+                nodes[nodeIndex[ragVertID]].members.emplace_back(ragVertID);
+                continue;
+            }
+        }
+        nodeIndex[ragVertID] = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back(scratch).members.emplace_back(ragVertID);
+    }
+    if (nodes.size() < 3) {
+        return;
+    }
 
-        bool foundIntersect = false;
-        std::queue<RhsRangePair> vertQ;
-        auto iterPair = in_edges(targetID, g);
-        vertQ.emplace(RhsRangePair{iterPair.first, iterPair});
+    // recorded dependencies, including the edges to the present pass
+    for (const auto ragVertID : makeRange(vertices(rag))) {
+        for (const auto e : makeRange(out_edges(ragVertID, rag))) {
+            addScheduleEdge(nodes, nodeIndex[ragVertID], nodeIndex[target(e, rag)]);
+        }
+    }
 
-        // from source vertex on this edge back to branch point
-        EdgeList rhsPath;
-        bool rootEdge = true;
-        while (!foundIntersect && !vertQ.empty()) {
-            auto rangePair = vertQ.front();
-            vertQ.pop();
-            auto range = rangePair.second;
-            for (auto iter = range.first; iter != range.second; ++iter) {
-                auto srcID = source((*iter), g);
-                if (sourceID == srcID) {
-                    continue;
-                }
-                auto e = edge(srcID, sourceID, _relationGraph);
-                auto recordIter = rootEdge ? iter : rangePair.first;
-                if (!e.second) {
-                    vertQ.emplace(RhsRangePair{recordIter, in_edges(srcID, g)});
-                } else {
-                    rhsPath = {(*iter), *recordIter};
-                    foundIntersect = true;
+    // the access graph only links each access to the last dependent one,
+    // a write must also wait for all the reads since the previous write.
+    ccstd::pmr::vector<TransientUsage> usages(scratch);
+    for (const auto &[resName, accessRecord] : rag.resourceAccess) {
+        const auto resID = findVertex(resName, resourceGraph);
+        if (resID == ResourceGraph::null_vertex()) {
+            continue;
+        }
+        const auto &desc = get(ResourceGraph::DescTag{}, resourceGraph, resID);
+        const bool isBuffer = desc.dimension == ResourceDimension::BUFFER;
+        for (auto iter = accessRecord.begin(); iter != accessRecord.end(); ++iter) {
+            if (iter->first == EXPECT_START_ID || iter->first >= numVerts) {
+                continue;
+            }
+            for (auto prevIter = iter; prevIter != accessRecord.begin();) {
+                --prevIter;
+                if (prevIter->first == EXPECT_START_ID) {
                     break;
                 }
-            }
-            rootEdge = false;
-        }
-        assert(foundIntersect);
-
-        using LhsRangePair = std::pair<RelationGraph::out_edge_iterator, OutEdgeRange>;
-        auto branchVert = source(rhsPath.first, g);
-        bool found = false;
-        std::queue<LhsRangePair> forwardVertQ;
-        auto forwardIterPair = out_edges(branchVert, g);
-        forwardVertQ.emplace(LhsRangePair{forwardIterPair.first, forwardIterPair});
-        EdgeList lhsPath;
-        rootEdge = true;
-        while (!found && !forwardVertQ.empty()) {
-            auto rangePair = forwardVertQ.front();
-            forwardVertQ.pop();
-            auto range = rangePair.second;
-            for (auto iter = range.first; iter != range.second; ++iter) {
-                if ((*iter) == rhsPath.first) {
+                if (prevIter->first >= numVerts) {
                     continue;
                 }
-                auto dstID = target((*iter), g);
-                auto e = edge(dstID, sourceID, _relationGraph);
-                auto recordIter = rootEdge ? iter : rangePair.first;
-                if (!e.second) {
-                    forwardVertQ.emplace(LhsRangePair{recordIter, out_edges(dstID, g)});
-                } else {
-                    found = true;
-                    lhsPath = {*recordIter, (*iter)};
+                if (accessDependent(prevIter->second.accessFlag, iter->second.accessFlag, isBuffer)) {
+                    addScheduleEdge(nodes, nodeIndex[prevIter->first], nodeIndex[iter->first]);
+                }
+                if (!isReadOnlyAccess(prevIter->second.accessFlag)) {
                     break;
                 }
             }
-            rootEdge = true;
         }
-        assert(found);
-        lhsPath.second = e;
 
-        _circuits.emplace_back(CloseCircuit{lhsPath, rhsPath});
-    };
-
-private:
-    RelationGraph &_relationGraph;
-    CloseCircuits &_circuits;
-};
-
-// forward (vertex ascending):
-// -- true: how much resource this pass writes to, which has an effect of later passes;
-// -- false: how much resource this pass reads from, which is dependent from former passes.
-auto evaluateHeaviness(const ResourceAccessGraph &rag, const ResourceGraph &rescGraph, ResourceAccessGraph::vertex_descriptor vert, bool forward) {
-    const ResourceAccessNode &accessNode = get(ResourceAccessGraph::PassNodeTag{}, rag, vert);
-    int64_t score = 0;
-    bool forceAdjacent = false;
-    for (const auto &pair : accessNode.resourceStatus) {
-        int64_t eval = 0;
-        auto rescID = rag.resourceIndex.at(pair.first);
-        const ResourceDesc &desc = get(ResourceGraph::DescTag{}, rescGraph, rescID);
-        const ResourceTraits &traits = get(ResourceGraph::TraitsTag{}, rescGraph, rescID);
-
-        const auto &resc = pair.second;
-        if (!(isReadOnlyAccess(resc.accessFlag) ^ forward)) {
-            // forward calculate write(s), backward calculate read(s).
+        // transient memory
+        const auto &traits = get(ResourceGraph::TraitsTag{}, resourceGraph, resID);
+        if (traits.residency != ResourceResidency::MANAGED || isResourceView(resID, resourceGraph)) {
             continue;
         }
-
-        switch (desc.dimension) {
-            case ResourceDimension::BUFFER:
-                eval = desc.width;
-                break;
-            case ResourceDimension::TEXTURE1D:
-            case ResourceDimension::TEXTURE2D:
-            case ResourceDimension::TEXTURE3D:
-                eval = gfx::formatSize(desc.format, desc.width, desc.height, desc.depthOrArraySize);
-                break;
+        const auto usageID = static_cast<uint32_t>(usages.size());
+        auto &usage = usages.emplace_back();
+        usage.size = getResourceSize(desc);
+        for (const auto &[ragVertID, status] : accessRecord) {
+            if (ragVertID >= numVerts || nodeIndex[ragVertID] == INVALID_ID) {
+                continue;
+            }
+            auto &resources = nodes[nodeIndex[ragVertID]].resources;
+            if (std::find(resources.begin(), resources.end(), usageID) == resources.end()) {
+                resources.emplace_back(usageID);
+                ++usage.numNodes;
+            }
         }
+    }
 
-        if (traits.residency == ResourceResidency::MEMORYLESS) {
-            forceAdjacent = true;
-            score = forward ? std::numeric_limits<int64_t>::lowest() : std::numeric_limits<int64_t>::max();
-            break;
+    // list scheduling
+    const float paralellWeight = fgDispatcher._paralellExecWeight;
+    ccstd::pmr::vector<uint32_t> ready(scratch);
+    ccstd::pmr::vector<int64_t> gains(scratch);
+    for (uint32_t nodeID = 0; nodeID != nodes.size(); ++nodeID) {
+        if (nodes[nodeID].numPredecessors == 0) {
+            ready.emplace_back(nodeID);
         }
     }
-    return std::make_tuple(forceAdjacent, score);
-};
-
-void evaluateAndTryMerge(const ResourceAccessGraph &rag, const ResourceGraph &rescGraph, RelationGraph &relationGraph, const RelationGraph &relationGraphTc, const RelationVerts &lhsVerts, const RelationVerts &rhsVerts) {
-    assert(lhsVerts.size() >= 2);
-    assert(rhsVerts.size() >= 2);
-
-    auto evaluate = [&rag, &rescGraph, &relationGraph](RelationVert vert, bool forward) {
-        auto ragVert = get(RelationGraph::DescIDTag{}, relationGraph, vert);
-        return evaluateHeaviness(rag, rescGraph, ragVert, forward);
-    };
 
-    if (lhsVerts.size() == 2 || rhsVerts.size() == 2) {
-        /*
-               1 ----------- 2
-                \       __--/
-                 3 --``
-            no extra choice, only 1 - 3 - 2
-        */
-        const RelationVerts *shorterPath = lhsVerts.size() == 2 ? &lhsVerts : &rhsVerts;
-        remove_edge((*shorterPath)[0], (*shorterPath)[1], relationGraph);
-    } else {
-        // fist and last joint pass in this circuit don't get involved in reorder.
-        auto firstLhsNode = lhsVerts[1];
-        auto lastLhsNode = lhsVerts[lhsVerts.size() - 2];
-
-        const auto &lhsBackwardStatus = evaluate(firstLhsNode, false);
-        bool lhsAdjacentToStart = std::get<0>(lhsBackwardStatus);
-        const auto &lhsForwardStatus = evaluate(lastLhsNode, true);
-        bool lhsAdjacentToEnd = std::get<0>(lhsForwardStatus);
-
-        auto firstRhsNode = rhsVerts[1];
-        auto lastRhsNode = rhsVerts[rhsVerts.size() - 2];
-
-        const auto &rhsBackwardStatus = evaluate(firstRhsNode, true);
-        bool rhsAdjacentToStart = std::get<0>(rhsBackwardStatus);
-        const auto &rhsForwardStatus = evaluate(lastRhsNode, false);
-        bool rhsAdjacentToEnd = std::get<0>(rhsForwardStatus);
-
-        if (lhsAdjacentToStart || rhsAdjacentToEnd || lhsAdjacentToEnd || rhsAdjacentToStart) {
-            const RelationVerts *formerPath = &lhsVerts;
-            const RelationVerts *latterPath = &rhsVerts;
-            if (rhsAdjacentToStart || lhsAdjacentToEnd) {
-                swap(formerPath, latterPath);
-            }
+    ccstd::pmr::vector<ResourceAccessGraph::vertex_descriptor> order(scratch);
+    order.reserve(rag.topologicalOrder.size());
+    order.emplace_back(EXPECT_START_ID);
+    for (uint32_t position = 0; position != nodes.size(); ++position) {
+        if (ready.empty()) {
+            // cyclic dependencies, should not happen, keep the recorded order
+            CC_ASSERT(false);
+            return;
+        }
+        uint32_t maxDistance = 0;
+        int64_t minGain = std::numeric_limits<int64_t>::max();
+        int64_t maxGain = std::numeric_limits<int64_t>::lowest();
+        gains.clear();
+        for (const auto nodeID : ready) {
+            maxDistance = std::max(maxDistance, position - nodes[nodeID].readyPosition);
+            const auto gain = getMemoryGain(nodes[nodeID], usages);
+            minGain = std::min(minGain, gain);
+            maxGain = std::max(maxGain, gain);
+            gains.emplace_back(gain);
+        }
 
-            remove_edge((*latterPath)[0], (*latterPath)[1], relationGraph);
-            remove_edge((*formerPath)[formerPath->size() - 2], (*formerPath)[formerPath->size() - 1], relationGraph);
-
-            tryAddEdge((*formerPath)[formerPath->size() - 2], (*latterPath)[1], relationGraph);
-        }
-
-        assert(lhsVerts.size() >= 3 && rhsVerts.size() >= 3);
-        constexpr int64_t score = std::numeric_limits<int64_t>::lowest();
-        ccstd::vector<std::queue<RelationEdge>> candidateSections;
-        std::queue<RelationEdge> lhsSection;
-        for (size_t i = 1; i < lhsVerts.size(); ++i) {
-            auto tryE = edge(lhsVerts[i], lhsVerts[i - 1], relationGraphTc);
-            auto tryRE = edge(lhsVerts[i - 1], lhsVerts[i], relationGraphTc);
-            // check if original reachable
-            if (!tryE.second && !tryRE.second) {
-                remove_edge(lhsVerts[i - 1], lhsVerts[i], relationGraph);
-                candidateSections.emplace_back(lhsSection);
-                std::queue<RelationEdge> clearQ;
-                lhsSection.swap(clearQ);
-            }
-            auto e = edge(lhsVerts[i], lhsVerts[i - 1], relationGraph);
-            // verts comes in order, so either real edge exist or logic edge is added.
-            CC_ASSERT(e.second);
-
-            lhsSection.emplace(e.first);
-        }
-        if (candidateSections.empty()) {
-            // if this one is a tight edge(no logic edge, dependent from one to its next),
-            // keep this whole chain as a candidate.
-            remove_edge(lhsVerts[0], lhsVerts[1], relationGraph);
-            remove_edge(lhsVerts[lhsVerts.size() - 2], lhsVerts[lhsVerts.size() - 1], relationGraph);
-            candidateSections.emplace_back(std::move(lhsSection));
-        }
-
-        std::queue<RelationEdge> rhsSection;
-        for (size_t i = 1; i < rhsVerts.size(); ++i) {
-            auto tryE = edge(rhsVerts[i], rhsVerts[i - 1], relationGraphTc);
-            auto tryRE = edge(rhsVerts[i - 1], rhsVerts[i], relationGraphTc);
-            if (!tryE.second && !tryRE.second) {
-                remove_edge(rhsVerts[i - 1], rhsVerts[i], relationGraph);
-                candidateSections.emplace_back(rhsSection);
-                std::queue<RelationEdge> clearQ;
-                rhsSection.swap(clearQ);
+        uint32_t best = 0;
+        float bestScore = -1.0F;
+        for (uint32_t i = 0; i != ready.size(); ++i) {
+            const auto &node = nodes[ready[i]];
+            const float distance = maxDistance ? static_cast<float>(position - node.readyPosition) / static_cast<float>(maxDistance) : 0.0F;
+            const float gain = maxGain > minGain ? static_cast<float>(gains[i] - minGain) / static_cast<float>(maxGain - minGain) : 0.0F;
+            const float score = paralellWeight * distance + (1.0F - paralellWeight) * gain;
+            if (score > bestScore || (score == bestScore && ready[i] < ready[best])) {
+                bestScore = score;
+                best = i;
             }
-            auto e = edge(rhsVerts[i], rhsVerts[i - 1], relationGraph);
-            // verts comes in order, so either real edge exist or logic edge is added.
-            CC_ASSERT(e.second);
-            rhsSection.emplace(e.first);
-        }
-
-        // lhs verts already put in.
-        if (candidateSections.size() == 1) {
-            remove_edge(rhsVerts[0], rhsVerts[1], relationGraph);
-            remove_edge(rhsVerts[rhsVerts.size() - 2], rhsVerts[rhsVerts.size() - 1], relationGraph);
-            candidateSections.emplace_back(std::move(rhsSection));
-        }
-
-        assert(candidateSections.size() >= 2);
-
-        ScoreMap scMap;
-        auto tailVert = lhsVerts[0];
-        while (!candidateSections.empty()) {
-            int64_t lightest = std::numeric_limits<int64_t>::max();
-            uint32_t index = 0;
-            for (size_t i = 0; i < candidateSections.size(); ++i) {
-                auto e = candidateSections[i].front();
-                auto srcVert = source(e, relationGraph);
-                auto dstVert = target(e, relationGraph);
-                int64_t srcBackwardScore = 0;
-                int64_t dstForwardScore = 0;
-                if (scMap.find(srcVert) == scMap.end()) {
-                    auto res = evaluate(srcVert, false);
-                    srcBackwardScore = std::get<1>(res);
-                    res = evaluate(srcVert, true);
-                    auto srcForwardScore = std::get<1>(res);
-                    scMap.emplace(srcVert, std::pair<int64_t, int64_t>(srcBackwardScore, srcForwardScore));
-                } else {
-                    srcBackwardScore = std::get<0>(scMap.at(srcVert));
-                }
-                if (scMap.find(dstVert) == scMap.end()) {
-                    auto res = evaluate(dstVert, false);
-                    dstForwardScore = std::get<1>(res);
-                    res = evaluate(dstVert, true);
-                    auto dstBackwardScore = std::get<1>(res);
-                    scMap.emplace(dstVert, std::pair<int64_t, int64_t>(dstBackwardScore, dstForwardScore));
-                } else {
-                    dstForwardScore = std::get<1>(scMap.at(dstVert));
-                }
+        }
 
-                // we are in a simple path, so all the "input(this path)" resource of this path come from the first vertex,
-                // all the "output(this path)" come to the last vertex, other resources are "internally(this path)" produced and destroyed.
-                // so only input of first vertex and output of last vertex are taken into account.
-                // [simple path]: path without diverged edges.
-                auto score = dstForwardScore - srcBackwardScore;
-                if (lightest > score) {
-                    lightest = score;
-                    index = i;
-                }
-            }
-            auto e = candidateSections[index].front();
-            candidateSections[index].pop();
-            if (candidateSections[index].empty()) {
-                auto iter = candidateSections.begin();
-                std::advance(iter, index);
-                candidateSections.erase(iter);
+        const auto nodeID = ready[best];
+        ready.erase(ready.begin() + best);
+        auto &node = nodes[nodeID];
+        order.insert(order.end(), node.members.begin(), node.members.end());
+        for (const auto resourceID : node.resources) {
+            auto &usage = usages[resourceID];
+            usage.allocated = true;
+            --usage.numNodes;
+        }
+        for (const auto successorID : node.successors) {
+            auto &successor = nodes[successorID];
+            successor.readyPosition = std::max(successor.readyPosition, position + 1);
+            if (--successor.numPredecessors == 0) {
+                ready.emplace_back(successorID);
             }
-            auto srcVert = source(e, relationGraph);
-            auto dstVert = target(e, relationGraph);
-            tryAddEdge(tailVert, srcVert, relationGraph);
-            tailVert = dstVert;
         }
-
-        tryAddEdge(tailVert, lhsVerts.back(), relationGraph);
     }
+    rag.topologicalOrder = std::move(order);
 }
 
-// return : can be further reduced?
-bool reduce(const ResourceAccessGraph &rag, const ResourceGraph &rescGraph, RelationGraph &relationGraph, RelationGraph &relationGraphTc, const CloseCircuit &circuit) {
-    auto checkPath = [&relationGraph](std::stack<RelationGraph::vertex_descriptor> &vertices, RelationGraph::vertex_descriptor endVert, RelationVerts &stackTrace) {
-        bool simpleGraph = true;
-        while (!vertices.empty()) {
-            auto vert = vertices.top();
-            vertices.pop();
-            stackTrace.emplace_back(vert);
+#pragma endregion PASS_REORDER
 
-            if (endVert == vert) {
-                break;
-            }
+#pragma region MEMORY_ALIASING
+namespace {
 
-            if (out_degree(vert, relationGraph) > 1) {
-                simpleGraph = false;
-                break;
-            }
-            auto r = out_edges(vert, relationGraph);
-            for (auto rIter = r.first; rIter != r.second; ++rIter) {
-                auto dstID = target(*rIter, relationGraph);
-                vertices.push(dstID);
-            }
-            if (r.first == r.second) {
-                stackTrace.pop_back();
-            }
-        }
-        return simpleGraph;
-    };
+struct AliasingCandidate {
+    ResourceGraph::vertex_descriptor resID{ResourceGraph::null_vertex()};
+    // first and last position in execution order
+    uint32_t start{INVALID_ID};
+    uint32_t end{0};
+};
 
-    // check if there is a sub branch on lhs
-    auto lhsEdges = circuit.first;
-    auto startVert = target(lhsEdges.first, relationGraph);
-    auto endVert = source(lhsEdges.second, relationGraph);
+struct AliasingSlot {
+    AliasingSlot(ResourceGraph::vertex_descriptor headIDIn, boost::container::pmr::memory_resource *scratch)
+    : headID(headIDIn), members(scratch) {}
 
-    std::stack<RelationGraph::vertex_descriptor> vertices;
-    vertices.emplace(startVert);
+    // the shared resource is created from the desc of head
+    ResourceGraph::vertex_descriptor headID{ResourceGraph::null_vertex()};
+    uint32_t end{0};
+    // candidates ordered by lifetime
+    ccstd::pmr::vector<uint32_t> members;
+};
 
-    RelationVerts lhsVisited;
-    auto branchStartVert = source(lhsEdges.first, relationGraph);
-    auto branchEndVert = target(lhsEdges.second, relationGraph);
-    lhsVisited.push_back(branchStartVert);
-    // check if there is a branch on lhs path
-    if (!checkPath(vertices, endVert, lhsVisited)) {
+bool isAliasingCompatible(const ResourceDesc &lhs, const ResourceDesc &rhs) {
+    if (lhs.dimension != rhs.dimension || lhs.flags != rhs.flags) {
         return false;
     }
-    lhsVisited.push_back(branchEndVert);
-    // if it's a simple graph, lhs path must can be dfs to the end at the first time.
-    assert(vertices.empty());
-
-    auto rhsEdges = circuit.second;
-    startVert = target(rhsEdges.first, relationGraph);
-    endVert = source(rhsEdges.second, relationGraph);
-    vertices.emplace(startVert);
+    if (lhs.dimension == ResourceDimension::BUFFER) {
+        // buffer slots grow to the largest member
+        return true;
+    }
+    return lhs.width == rhs.width &&
+           lhs.height == rhs.height &&
+           lhs.depthOrArraySize == rhs.depthOrArraySize &&
+           lhs.mipLevels == rhs.mipLevels &&
+           lhs.format == rhs.format &&
+           lhs.sampleCount == rhs.sampleCount &&
+           lhs.textureFlags == rhs.textureFlags;
+}
 
-    RelationVerts rhsVisited;
-    rhsVisited.push_back(branchStartVert);
-    if (!checkPath(vertices, endVert, rhsVisited)) {
+bool isAliasingCandidate(const ResourceAccessGraph &rag, const ResourceGraph &resg,
+                         const ccstd::pmr::string &name, ResourceGraph::vertex_descriptor resID) {
+    if (resID == ResourceGraph::null_vertex()) {
+        return false;
+    }
+    if (!holds<ManagedTextureTag>(resID, resg) && !holds<ManagedBufferTag>(resID, resg)) {
+        return false;
+    }
+    const auto &traits = get(ResourceGraph::TraitsTag{}, resg, resID);
+    if (traits.residency != ResourceResidency::MANAGED) {
+        return false;
+    }
+    // views keep the texture they are created from
+    if (numChildren(resID, resg) != 0) {
+        return false;
+    }
+    // moved resources are redirected to their targets
+    auto iter = rag.resourceIndex.find(name);
+    if (iter != rag.resourceIndex.end() && iter->second != resID) {
         return false;
     }
-    rhsVisited.push_back(branchEndVert);
+    if (rag.movedSourceStatus.find(name) != rag.movedSourceStatus.end() ||
+        rag.movedTargetStatus.find(name) != rag.movedTargetStatus.end() ||
+        rag.movedTarget.find(name) != rag.movedTarget.end()) {
+        return false;
+    }
+    return true;
+}
 
-    // merge this circuit
-    // from
-    /*          2 - 3 - 4
-              /           \
-            1               8
-              \           /
-                5 - 6 - 7
+// layout access of the resource if it is an attachment of the pass, nullptr otherwise
+LayoutAccess *getAttachmentAccess(ResourceAccessGraph &rag, const RenderGraph &renderGraph,
+                                  ResourceAccessGraph::vertex_descriptor ragVertID,
+                                  std::string_view resName, gfx::LoadOp &loadOp) {
+    const auto passID = get(ResourceAccessGraph::PassIDTag{}, rag, ragVertID);
+    if (holds<RasterSubpassTag>(passID, renderGraph)) {
+        ragVertID = rag.passIndex.at(parent(passID, renderGraph));
+    } else if (!holds<RasterPassTag>(passID, renderGraph)) {
+        return nullptr;
+    }
+    auto &fgRenderPassInfo = get(ResourceAccessGraph::RenderPassInfoTag{}, rag, ragVertID);
+    const auto &views = fgRenderPassInfo.orderedViews;
+    const auto index = static_cast<size_t>(std::distance(views.begin(), std::find(views.begin(), views.end(), resName)));
+    const auto colorCount = fgRenderPassInfo.colorAccesses.size();
+    if (index < colorCount) {
+        loadOp = fgRenderPassInfo.rpInfo.colorAttachments[index].loadOp;
+        return &fgRenderPassInfo.colorAccesses[index];
+    }
+    if (index == colorCount) {
+        loadOp = fgRenderPassInfo.rpInfo.depthStencilAttachment.depthLoadOp;
+        return &fgRenderPassInfo.dsAccess;
+    }
+    if (index == colorCount + 1) {
+        loadOp = fgRenderPassInfo.rpInfo.depthStencilResolveAttachment.depthLoadOp;
+        return &fgRenderPassInfo.dsResolveAccess;
+    }
+    return nullptr;
+}
 
-        to
-            1 - A - B - 8 or 1 - B - A -8 depends on algorithm
+bool isClaimed(const ccstd::pmr::vector<const gfx::GFXObject *> &claimed, const gfx::GFXObject *object) {
+    return std::find(claimed.begin(), claimed.end(), object) != claimed.end();
+}
 
-            ${A} : 2 - 3 - 4
-            ${B} : 5 - 6 - 7
-        */
+void aliasTextures(ResourceGraph &resg, gfx::Device *device, const AliasingSlot &slot,
+                   const ccstd::pmr::vector<AliasingCandidate> &candidates,
+                   ccstd::pmr::vector<const gfx::GFXObject *> &claimed) {
+    const auto &desc = get(ResourceGraph::DescTag{}, resg, slot.headID);
 
-    evaluateAndTryMerge(rag, rescGraph, relationGraph, relationGraphTc, lhsVisited, rhsVisited);
+    // reuse the texture of a member, so that the assignment is stable between frames
+    IntrusivePtr<gfx::Texture> shared;
+    for (const auto memberID : slot.members) {
+        const auto &texture = get(ManagedTextureTag{}, candidates[memberID].resID, resg);
+        if (texture.checkResource(desc) && !isClaimed(claimed, texture.texture.get())) {
+            shared = texture.texture;
+            break;
+        }
+    }
+    if (!shared) {
+        auto &head = get(ManagedTextureTag{}, slot.headID, resg);
+        resg.invalidatePersistentRenderPassAndFramebuffer(head.texture.get());
+        head.texture.reset();
+        resg.mount(device, slot.headID);
+        shared = head.texture;
+    }
+    claimed.emplace_back(shared.get());
 
-    return true;
+    for (const auto memberID : slot.members) {
+        auto &texture = get(ManagedTextureTag{}, candidates[memberID].resID, resg);
+        if (texture.texture != shared) {
+            resg.invalidatePersistentRenderPassAndFramebuffer(texture.texture.get());
+            texture.texture = shared;
+        }
+    }
 }
 
-template <typename RelationGraph, typename TargetGraph>
-void applyRelation(RelationGraph &relationGraph, const TargetGraph &targetGraph) {
-    CC_EXPECTS(relationGraph.vertices.size() == targetGraph.vertices.size());
+void aliasBuffers(ResourceGraph &resg, gfx::Device *device, const AliasingSlot &slot,
+                  const ccstd::pmr::vector<AliasingCandidate> &candidates,
+                  ccstd::pmr::vector<const gfx::GFXObject *> &claimed) {
+    const auto &desc = get(ResourceGraph::DescTag{}, resg, slot.headID);
 
-    // remove all edges
-    for (auto vert : targetGraph.vertices) {
-        clear_in_edges(vert, targetGraph);
-        clear_out_edges(vert, targetGraph);
+    IntrusivePtr<gfx::Buffer> shared;
+    for (const auto memberID : slot.members) {
+        const auto &buffer = get(ManagedBufferTag{}, candidates[memberID].resID, resg);
+        if (buffer.buffer && buffer.buffer->getSize() >= desc.width && !isClaimed(claimed, buffer.buffer.get())) {
+            shared = buffer.buffer;
+            break;
+        }
     }
+    if (!shared) {
+        auto &head = get(ManagedBufferTag{}, slot.headID, resg);
+        head.buffer.reset();
+        resg.mount(device, slot.headID);
+        shared = head.buffer;
+    }
+    claimed.emplace_back(shared.get());
+
+    for (const auto memberID : slot.members) {
+        get(ManagedBufferTag{}, candidates[memberID].resID, resg).buffer = shared;
+    }
+}
 
-    for (auto vert : relationGraph.vertices) {
-        auto inEdges = in_edges(vert, relationGraph);
-        for (auto e : makeRange(inEdges)) {
-            auto srcVert = source(e, relationGraph);
-            // auto checkEdge = edge(srcVert, vert, targetGraph);
-            add_edge(srcVert, vert, targetGraph);
+const gfx::GFXObject *getManagedObject(const ResourceGraph &resg, ResourceGraph::vertex_descriptor resID) {
+    if (holds<ManagedTextureTag>(resID, resg)) {
+        return get(ManagedTextureTag{}, resID, resg).texture.get();
+    }
+    if (holds<ManagedBufferTag>(resID, resg)) {
+        return get(ManagedBufferTag{}, resID, resg).buffer.get();
+    }
+    return nullptr;
+}
+
+// views are created from the texture of their parent, recreated on the next mount
+void resetSubresourceViews(ResourceGraph &resg, ResourceGraph::vertex_descriptor resID) { // NOLINT(misc-no-recursion)
+    for (const auto &e : makeRange(children(resID, resg))) {
+        if (holds<SubresourceViewTag>(e.target, resg)) {
+            get(SubresourceViewTag{}, e.target, resg).textureView.reset();
         }
+        resetSubresourceViews(resg, e.target);
     }
 }
 
-void passReorder(FrameGraphDispatcher &fgDispatcher) {
+// managed resources only share objects through aliasing. The ones that are not
+// aliased this time (views, reads of previous contents, moves, culled passes)
+// give up the shared object and get their own when they are mounted again.
+void unaliasResources(ResourceGraph &resg, const ccstd::pmr::vector<AliasingCandidate> &candidates,
+                      boost::container::pmr::memory_resource *scratch) {
+    PmrFlatMap<const gfx::GFXObject *, uint32_t> numHolders(scratch);
+    for (const auto resID : makeRange(vertices(resg))) {
+        if (const auto *object = getManagedObject(resg, resID)) {
+            ++numHolders[object];
+        }
+    }
+    ccstd::pmr::vector<bool> aliased(num_vertices(resg), false, scratch);
+    for (const auto &candidate : candidates) {
+        aliased[candidate.resID] = true;
+    }
+    for (const auto resID : makeRange(vertices(resg))) {
+        const auto *object = getManagedObject(resg, resID);
+        if (!object || aliased[resID]) {
+            continue;
+        }
+        auto &count = numHolders[object];
+        if (count < 2) {
+            continue;
+        }
+        --count;
+        if (holds<ManagedTextureTag>(resID, resg)) {
+            auto &texture = get(ManagedTextureTag{}, resID, resg);
+            resg.invalidatePersistentRenderPassAndFramebuffer(texture.texture.get());
+            texture.texture.reset();
+            resetSubresourceViews(resg, resID);
+        } else {
+            get(ManagedBufferTag{}, resID, resg).buffer.reset();
+        }
+    }
+}
+
+} // namespace
+
+void memoryAliasing(FrameGraphDispatcher &fgDispatcher) {
     auto *scratch = fgDispatcher.scratch;
     const auto &renderGraph = fgDispatcher.renderGraph;
     const auto &layoutGraph = fgDispatcher.layoutGraph;
@@ -2439,130 +2499,134 @@ void passReorder(FrameGraphDispatcher &fgDispatcher) {
         fgDispatcher._accessGraphBuilt = true;
     }
 
-    {
-        // determine do mem saving how many times
-        RelationGraph relationGraphTc(fgDispatcher.get_allocator());
-        boost::transitive_closure(relationGraph, relationGraphTc);
-
-        CloseCircuits circuits;
-        ccstd::vector<ResourceAccessGraph::edge_descriptor> crossEdges;
-        PassVisitor visitor(relationGraphTc, circuits);
-        auto colors = relationGraph.colors(scratch);
-        boost::depth_first_search(relationGraph, visitor, get(colors, relationGraph));
-
-        float percent = 0.0F;
-        uint32_t count = 0;
-        auto total = circuits.size();
-
-        float memsavePercent = 1.0F - fgDispatcher._paralellExecWeight;
-        for (auto iter = circuits.begin(); (iter != circuits.end()) && (percent < memsavePercent);) {
-            bool reduced = reduce(rag, resourceGraph, relationGraph, relationGraphTc, (*iter));
-            if (reduced) {
-                ++count;
-                iter = circuits.erase(iter);
-                percent = count / static_cast<float>(total);
-            } else {
-                ++iter;
+    // execution span of passes, subpasses share the span of their render pass,
+    // attachments of the same render pass are alive at the same time.
+    const auto numVerts = num_vertices(rag);
+    ccstd::pmr::vector<uint32_t> passRoot(numVerts, INVALID_ID, scratch);
+    ccstd::pmr::vector<uint32_t> spanStart(numVerts, INVALID_ID, scratch);
+    ccstd::pmr::vector<uint32_t> spanEnd(numVerts, 0, scratch);
+    for (uint32_t order = 0; order != rag.topologicalOrder.size(); ++order) {
+        const auto ragVertID = rag.topologicalOrder[order];
+        if (ragVertID == EXPECT_START_ID) {
+            continue;
+        }
+        const auto passID = get(ResourceAccessGraph::PassIDTag{}, rag, ragVertID);
+        if (passID == RenderGraph::null_vertex()) {
+            continue;
+        }
+        auto rootID = ragVertID;
+        if (holds<RasterSubpassTag>(passID, renderGraph) || holds<ComputeSubpassTag>(passID, renderGraph)) {
+            auto iter = rag.passIndex.find(parent(passID, renderGraph));
+            if (iter != rag.passIndex.end()) {
+                rootID = iter->second;
             }
         }
+        passRoot[ragVertID] = rootID;
+        spanStart[rootID] = std::min(spanStart[rootID], order);
+        spanEnd[rootID] = std::max(spanEnd[rootID], order);
+    }
 
-        // topological sort
-        rag.topologicalOrder.clear();
-        bool empty = relationGraph._vertices.empty();
-        ScoreMap scoreMap;
-        RelationVerts candidates;
-        candidates.push_back(EXPECT_START_ID);
-
-        ccstd::vector<RelationVert> candidateBuffer;
-        uint32_t coloredVerts = 0;
-        while (coloredVerts < relationGraph._vertices.size()) {
-            // decreasing order, pop back from vector, push into queue, then it's ascending order.
-            std::sort(candidates.begin(), candidates.end(), [&](RelationVert lhsVert, RelationVert rhsVert) {
-                int64_t lhsForwardScore{0};
-                int64_t rhsForwardScore{0};
-                int64_t lhsBackwardScore{0};
-                int64_t rhsBackwardScore{0};
-                if (scoreMap.find(lhsVert) == scoreMap.end()) {
-                    auto lhsRagVert = get(RelationGraph::DescIDTag{}, relationGraph, lhsVert);
-                    const auto &lhsForwardStatus = evaluateHeaviness(rag, resourceGraph, lhsRagVert, true);
-                    lhsForwardScore = get<1>(lhsForwardStatus);
-                    const auto &lhsBackwardStatus = evaluateHeaviness(rag, resourceGraph, lhsRagVert, false);
-                    lhsBackwardScore = get<1>(lhsBackwardStatus);
-                    scoreMap.emplace(lhsVert, std::pair<int64_t, int64_t>{lhsBackwardScore, lhsForwardScore});
-                } else {
-                    lhsBackwardScore = scoreMap[lhsVert].first;
-                    lhsForwardScore = scoreMap[lhsVert].second;
-                }
-
-                if (scoreMap.find(rhsVert) == scoreMap.end()) {
-                    auto rhsRagVert = get(RelationGraph::DescIDTag{}, relationGraph, rhsVert);
-                    const auto &rhsForwardStatus = evaluateHeaviness(rag, resourceGraph, rhsRagVert, true);
-                    rhsForwardScore = get<1>(rhsForwardStatus);
-                    const auto &rhsBackwardStatus = evaluateHeaviness(rag, resourceGraph, rhsRagVert, false);
-                    rhsBackwardScore = get<1>(rhsBackwardStatus);
-                    scoreMap.emplace(rhsVert, std::pair<int64_t, int64_t>{rhsBackwardScore, rhsForwardScore});
-                } else {
-                    rhsBackwardScore = scoreMap[rhsVert].first;
-                    rhsForwardScore = scoreMap[rhsVert].second;
-                }
-                return lhsBackwardScore - lhsForwardScore > rhsBackwardScore - rhsForwardScore;
-            });
-
-            const auto vert = candidates.back();
-            candidates.pop_back();
-
-            auto ragVert = get(RelationGraph::DescIDTag{}, relationGraph, vert);
-            rag.topologicalOrder.emplace_back(ragVert);
-            if (!candidateBuffer.empty()) {
-                candidates.insert(candidates.end(), candidateBuffer.begin(), candidateBuffer.end());
-                candidateBuffer.clear();
+    // lifetime of transient resources
+    ccstd::pmr::vector<AliasingCandidate> candidates(scratch);
+    for (const auto &[resName, accessRecord] : rag.resourceAccess) {
+        const auto resID = findVertex(resName, resourceGraph);
+        if (!isAliasingCandidate(rag, resourceGraph, resName, resID)) {
+            continue;
+        }
+        AliasingCandidate candidate{resID};
+        bool valid = true;
+        bool firstAccess = true;
+        for (const auto &[ragVertID, status] : accessRecord) {
+            if (ragVertID == EXPECT_START_ID) {
+                continue;
             }
-
-            for (const auto nextGeneration : makeRange(out_edges(vert, relationGraph))) {
-                auto targetID = target(nextGeneration, relationGraph);
-                if (in_degree(targetID, relationGraph) == 1) {
-                    candidateBuffer.emplace_back(targetID);
+            if (firstAccess) {
+                firstAccess = false;
+                // contents of the previous frame are read, cannot be shared
+                gfx::LoadOp loadOp{gfx::LoadOp::CLEAR};
+                const auto *attachmentAccess = getAttachmentAccess(rag, renderGraph, ragVertID, resName, loadOp);
+                if (attachmentAccess ? loadOp == gfx::LoadOp::LOAD : isReadOnlyAccess(status.accessFlag)) {
+                    valid = false;
+                    break;
                 }
             }
-
-            auto deprecatedEdges = out_edges(vert, relationGraph);
-            for (auto iter = deprecatedEdges.first; iter < deprecatedEdges.second;) {
-                remove_edge(*iter, relationGraph);
-                deprecatedEdges = out_edges(vert, relationGraph);
-                iter = deprecatedEdges.first;
-            }
-
-            if (candidates.empty()) {
-                candidates.insert(candidates.end(), candidateBuffer.begin(), candidateBuffer.end());
-                candidateBuffer.clear();
+            const auto rootID = ragVertID < numVerts ? passRoot[ragVertID] : INVALID_ID;
+            if (rootID == INVALID_ID) { // culled
+                valid = false;
+                break;
             }
+            candidate.start = std::min(candidate.start, spanStart[rootID]);
+            candidate.end = std::max(candidate.end, spanEnd[rootID]);
+        }
+        if (valid && !firstAccess) {
+            candidates.emplace_back(candidate);
+        }
+    }
+    unaliasResources(resourceGraph, candidates, scratch);
+    if (candidates.size() < 2) {
+        return;
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const AliasingCandidate &lhs, const AliasingCandidate &rhs) {
+        return std::forward_as_tuple(lhs.start, lhs.resID) < std::forward_as_tuple(rhs.start, rhs.resID);
+    });
 
-            coloredVerts++;
+    // first fit, resources share a slot if their lifetimes do not overlap
+    ccstd::pmr::vector<AliasingSlot> slots(scratch);
+    for (uint32_t candidateID = 0; candidateID != candidates.size(); ++candidateID) {
+        const auto &candidate = candidates[candidateID];
+        const auto &desc = get(ResourceGraph::DescTag{}, resourceGraph, candidate.resID);
+        auto iter = std::find_if(slots.begin(), slots.end(), [&](const AliasingSlot &slot) {
+            return slot.end < candidate.start &&
+                   isAliasingCompatible(get(ResourceGraph::DescTag{}, resourceGraph, slot.headID), desc);
+        });
+        if (iter == slots.end()) {
+            iter = slots.emplace(slots.end(), candidate.resID, scratch);
+        }
+        auto &slot = *iter;
+        if (desc.width > get(ResourceGraph::DescTag{}, resourceGraph, slot.headID).width) {
+            slot.headID = candidate.resID;
         }
+        slot.end = candidate.end;
+        slot.members.emplace_back(candidateID);
+    }
 
-        // remove all edges
-        for (auto vert : makeRange(vertices(rag))) {
-            clear_in_edges(vert, rag);
-            clear_out_edges(vert, rag);
+    // share one resource per slot
+    auto *device = gfx::Device::getInstance();
+    ccstd::pmr::vector<const gfx::GFXObject *> claimed(scratch);
+    for (const auto &slot : slots) {
+        if (holds<ManagedTextureTag>(slot.headID, resourceGraph)) {
+            aliasTextures(resourceGraph, device, slot, candidates, claimed);
+        } else {
+            aliasBuffers(resourceGraph, device, slot, candidates, claimed);
         }
+    }
+
+    // a member starts from the last access of the previous one, so that it waits for it
+    for (const auto &slot : slots) {
+        for (uint32_t i = 1; i < slot.members.size(); ++i) {
+            const auto prevID = candidates[slot.members[i - 1]].resID;
+            const auto currID = candidates[slot.members[i]].resID;
+            const auto &prevRecord = rag.resourceAccess.at(get(ResourceGraph::NameTag{}, resourceGraph, prevID));
+            const auto lastAccess = prevRecord.rbegin()->second.accessFlag;
 
-        // apply relation
-        for (auto rlgVert : makeRange(vertices(relationGraph))) {
-            auto ragVert = get(RelationGraph::DescIDTag{}, relationGraph, rlgVert);
-            auto inEdges = in_edges(rlgVert, relationGraph);
-            for (auto e : makeRange(inEdges)) {
-                auto srcRlgVert = source(e, relationGraph);
-                auto srcRagVert = get(RelationGraph::DescIDTag{}, relationGraph, srcRlgVert);
-                add_edge(srcRagVert, ragVert, rag);
+            const auto &currName = get(ResourceGraph::NameTag{}, resourceGraph, currID);
+            auto &currRecord = rag.resourceAccess.at(currName);
+            auto iter = currRecord.begin();
+            if (iter->first == EXPECT_START_ID) {
+                iter->second.accessFlag = lastAccess;
+                ++iter;
+            }
+            CC_ENSURES(iter != currRecord.end());
+            gfx::LoadOp loadOp{gfx::LoadOp::CLEAR};
+            auto *attachmentAccess = getAttachmentAccess(rag, renderGraph, iter->first, currName, loadOp);
+            if (attachmentAccess) {
+                attachmentAccess->prevAccess = lastAccess;
             }
         }
     }
 }
 
-#pragma endregion PASS_REORDER
-
-void memoryAliasing(FrameGraphDispatcher &fgDispatcher) {
-}
+#pragma endregion MEMORY_ALIASING
 
 #pragma region assisstantFuncDefinition
 template <typename Graph>
@@ -28,6 +28,7 @@
 #include "LayoutGraphGraphs.h"
 #include "LayoutGraphTypes.h"
 #include "LayoutGraphUtils.h"
+#include "NativePipelineCache.h"
 #include "NativePipelineFwd.h"
 #include "NativePipelineTypes.h"
 #include "NativeUtils.h"
@@ -36,6 +37,8 @@
 #include "RenderGraphTypes.h"
 #include "RenderingModule.h"
 #include "NativeRenderGraphUtils.h"
+#include "cocos/base/job-system/JobSystem.h"
+#include "cocos/profiler/Profiler.h"
 #include "cocos/renderer/gfx-base/GFXBarrier.h"
 #include "cocos/renderer/gfx-base/GFXDef-common.h"
 #include "cocos/renderer/gfx-base/GFXDescriptorSetLayout.h"
@@ -93,8 +96,86 @@ struct RenderGraphVisitorContext {
     LayoutGraphData::vertex_descriptor currentPassLayoutID = LayoutGraphData::null_vertex();
     RenderGraph::vertex_descriptor currentInFlightPassID = RenderGraph::null_vertex();
     Mat4 currentProjMatrix{};
+    // raster passes recorded into the secondary command buffers on job threads
+    const ccstd::pmr::vector<bool>* parallelPasses = nullptr;
+    gfx::CommandBuffer* const* secondaryCmdBuffs = nullptr;
+    uint32_t numSecondaryCmdBuffs = 0;
 };
 
+// state the inline recording would have bound when reaching a draw range
+struct ParallelDrawState {
+    gfx::Viewport viewport;
+    gfx::DescriptorSet* perPassSet = nullptr;
+    gfx::DescriptorSet* perPhaseSet = nullptr;
+};
+
+// contiguous instances of a draw queue, or batches of an instancing queue
+struct ParallelDrawRange {
+    const RenderDrawQueue* drawQueue = nullptr;
+    const RenderInstancingQueue* instancingQueue = nullptr;
+    uint32_t first = 0;
+    uint32_t count = 0;
+    uint32_t stateID = 0;
+    uint32_t workerID = 0;
+    uint32_t firstPipelineState = 0;
+};
+
+uint32_t getInstancingDrawCount(const RenderInstancingQueue& queue, uint32_t batchID) {
+    const auto* instanceBuffer = queue.sortedBatches[batchID];
+    return instanceBuffer->hasPendingModels()
+               ? static_cast<uint32_t>(instanceBuffer->getInstances().size())
+               : 0;
+}
+
+uint32_t getInstancingDrawCount(const RenderInstancingQueue& queue) {
+    uint32_t numDraws = 0;
+    for (uint32_t batchID = 0; batchID != queue.sortedBatches.size(); ++batchID) {
+        numDraws += getInstancingDrawCount(queue, batchID);
+    }
+    return numDraws;
+}
+
+// Only raster passes drawing scenes are recorded on job threads. Custom callbacks,
+// ui, profiler and subpasses use states of the render thread and stay inline.
+uint32_t getParallelDrawCount(const RenderGraphVisitorContext& ctx, RenderGraph::vertex_descriptor passID) {
+    const auto& g = ctx.g;
+    if (!ctx.validPasses[passID] || !holds<RasterPassTag>(passID, g)) {
+        return 0;
+    }
+    const auto& pass = get(RasterPassTag{}, passID, g);
+    if (!get(RenderGraph::DataTag{}, g, passID).custom.empty() ||
+        pass.showStatistics || !pass.subpassGraph.subpasses.empty()) {
+        return 0;
+    }
+    const auto& sceneCulling = ctx.context.sceneCulling;
+    uint32_t numDraws = 0;
+    for (const auto queueEdge : makeRange(children(passID, g))) {
+        const auto queueID = target(queueEdge, g);
+        if (!ctx.validPasses[queueID]) {
+            continue;
+        }
+        if (!holds<QueueTag>(queueID, g) || !get(RenderGraph::DataTag{}, g, queueID).custom.empty()) {
+            return 0;
+        }
+        for (const auto sceneEdge : makeRange(children(queueID, g))) {
+            const auto sceneID = target(sceneEdge, g);
+            if (!ctx.validPasses[sceneID] || holds<ClearTag>(sceneID, g) || holds<ViewportTag>(sceneID, g)) {
+                continue;
+            }
+            if (!holds<SceneTag>(sceneID, g) || any(get(SceneTag{}, sceneID, g).flags & SceneFlags::UI)) {
+                return 0;
+            }
+            const auto& queueDesc = sceneCulling.sceneQueryIndex.at(sceneID);
+            const auto& queue = sceneCulling.renderQueues[queueDesc.renderQueueTarget];
+            numDraws += static_cast<uint32_t>(queue.opaqueQueue.instances.size());
+            numDraws += getInstancingDrawCount(queue.opaqueInstancingQueue);
+            numDraws += static_cast<uint32_t>(queue.transparentQueue.instances.size());
+            numDraws += getInstancingDrawCount(queue.transparentInstancingQueue);
+        }
+    }
+    return numDraws;
+}
+
 void clear(gfx::RenderPassInfo& info) {
     info.colorAttachments.clear();
     info.depthStencilAttachment = {};
@@ -1117,6 +1198,176 @@ struct RenderGraphVisitor : boost::dfs_visitor<> {
                 iter->second);
         }
     }
+    gfx::DescriptorSet* findDescriptorSet(RenderGraph::vertex_descriptor vertID) const {
+        auto iter = ctx.renderGraphDescriptorSet.find(vertID);
+        return iter != ctx.renderGraphDescriptorSet.end() ? iter->second : nullptr;
+    }
+    // Records the draws of the pass into the secondary command buffers, split
+    // evenly by draw count. Returns the number of command buffers used.
+    uint32_t recordSecondaryCommandBuffers(
+        RenderGraph::vertex_descriptor passID,
+        gfx::RenderPass* renderPass, gfx::Framebuffer* framebuffer,
+        const gfx::Rect& renderArea) const {
+        const auto& g = ctx.g;
+        const auto& sceneCulling = ctx.context.sceneCulling;
+        ccstd::pmr::vector<ParallelDrawState> states(ctx.scratch);
+        ccstd::pmr::vector<ParallelDrawRange> queues(ctx.scratch);
+        uint32_t numDraws = 0;
+
+        // replay begin(RenderQueue) and begin(SceneData), the secondary command buffers inherit nothing
+        ParallelDrawState state{
+            gfx::Viewport{renderArea.x, renderArea.y, renderArea.width, renderArea.height},
+            findDescriptorSet(passID),
+            nullptr,
+        };
+        for (const auto queueEdge : makeRange(children(passID, g))) {
+            const auto queueID = target(queueEdge, g);
+            if (!ctx.validPasses[queueID]) {
+                continue;
+            }
+            const auto& queue = get(QueueTag{}, queueID, g);
+            if (queue.viewport.width != 0 && queue.viewport.height != 0) {
+                state.viewport = queue.viewport;
+            }
+            if (auto* perPhaseSet = findDescriptorSet(queueID)) {
+                state.perPhaseSet = perPhaseSet;
+            }
+            for (const auto sceneEdge : makeRange(children(queueID, g))) {
+                const auto sceneID = target(sceneEdge, g);
+                if (!ctx.validPasses[sceneID] || !holds<SceneTag>(sceneID, g)) {
+                    continue;
+                }
+                if (auto* perPassSet = findDescriptorSet(sceneID)) {
+                    state.perPassSet = perPassSet;
+                }
+                const auto stateID = static_cast<uint32_t>(states.size());
+                states.emplace_back(state);
+
+                const auto& queueDesc = sceneCulling.sceneQueryIndex.at(sceneID);
+                const auto& renderQueue = sceneCulling.renderQueues[queueDesc.renderQueueTarget];
+                auto addDrawQueue = [&](const RenderDrawQueue& drawQueue) {
+                    const auto count = static_cast<uint32_t>(drawQueue.instances.size());
+                    if (count) {
+                        queues.emplace_back(ParallelDrawRange{&drawQueue, nullptr, 0, count, stateID});
+                        numDraws += count;
+                    }
+                };
+                auto addInstancingQueue = [&](const RenderInstancingQueue& instancingQueue) {
+                    const auto count = static_cast<uint32_t>(instancingQueue.sortedBatches.size());
+                    if (count) {
+                        queues.emplace_back(ParallelDrawRange{nullptr, &instancingQueue, 0, count, stateID});
+                        numDraws += getInstancingDrawCount(instancingQueue);
+                    }
+                };
+                addDrawQueue(renderQueue.opaqueQueue);
+                addInstancingQueue(renderQueue.opaqueInstancingQueue);
+                addDrawQueue(renderQueue.transparentQueue);
+                addInstancingQueue(renderQueue.transparentInstancingQueue);
+            }
+        }
+
+        // split the queues into contiguous ranges, one worker after another
+        const uint32_t numWorkers = ctx.numSecondaryCmdBuffs;
+        const uint32_t drawsPerWorker = std::max(1U, (numDraws + numWorkers - 1) / numWorkers);
+        ccstd::pmr::vector<ParallelDrawRange> ranges(ctx.scratch);
+        uint32_t workerID = 0;
+        uint32_t load = 0;
+        auto advance = [&](uint32_t numDrawsAdded) {
+            load += numDrawsAdded;
+            if (load >= drawsPerWorker && workerID + 1 < numWorkers) {
+                ++workerID;
+                load = 0;
+            }
+        };
+        for (const auto& queue : queues) {
+            if (queue.drawQueue) {
+                for (uint32_t first = 0; first != queue.count;) {
+                    const auto count = workerID + 1 == numWorkers
+                                           ? queue.count - first
+                                           : std::min(queue.count - first, drawsPerWorker - load);
+                    auto& range = ranges.emplace_back(queue);
+                    range.first = first;
+                    range.count = count;
+                    range.workerID = workerID;
+                    first += count;
+                    advance(count);
+                }
+                continue;
+            }
+            for (uint32_t batchID = 0; batchID != queue.count; ++batchID) {
+                if (ranges.empty() || ranges.back().instancingQueue != queue.instancingQueue ||
+                    ranges.back().workerID != workerID) {
+                    auto& range = ranges.emplace_back(queue);
+                    range.first = batchID;
+                    range.count = 0;
+                    range.workerID = workerID;
+                }
+                ++ranges.back().count;
+                advance(getInstancingDrawCount(*queue.instancingQueue, batchID));
+            }
+        }
+        if (ranges.empty()) {
+            return 0;
+        }
+
+        // the pipeline state cache is not thread safe, resolve on this thread
+        ccstd::pmr::vector<gfx::PipelineState*> pipelineStates(ctx.scratch);
+        pipelineStates.reserve(numDraws);
+        for (auto& range : ranges) {
+            range.firstPipelineState = static_cast<uint32_t>(pipelineStates.size());
+            if (range.drawQueue) {
+                resolvePipelineStates(*range.drawQueue, renderPass, 0, range.first, range.count, pipelineStates);
+            } else {
+                resolvePipelineStates(*range.instancingQueue, renderPass, range.first, range.count, pipelineStates);
+            }
+        }
+
+        const uint32_t numCmdBuffs = ranges.back().workerID + 1;
+        ccstd::pmr::vector<uint32_t> firstRanges(numCmdBuffs + 1, static_cast<uint32_t>(ranges.size()), ctx.scratch);
+        for (auto rangeID = static_cast<uint32_t>(ranges.size()); rangeID-- > 0;) {
+            firstRanges[ranges[rangeID].workerID] = rangeID;
+        }
+
+        auto record = [&](uint32_t cmdBuffID) {
+            auto* cmdBuff = ctx.secondaryCmdBuffs[cmdBuffID];
+            cmdBuff->begin(renderPass, 0, framebuffer);
+            cmdBuff->setScissor(renderArea);
+            const ParallelDrawState* lastState = nullptr;
+            for (uint32_t rangeID = firstRanges[cmdBuffID]; rangeID != firstRanges[cmdBuffID + 1]; ++rangeID) {
+                const auto& range = ranges[rangeID];
+                const auto& drawState = states[range.stateID];
+                if (!lastState || lastState->viewport != drawState.viewport) {
+                    cmdBuff->setViewport(drawState.viewport);
+                }
+                if (drawState.perPassSet && (!lastState || lastState->perPassSet != drawState.perPassSet)) {
+                    cmdBuff->bindDescriptorSet(static_cast<uint32_t>(pipeline::SetIndex::GLOBAL), drawState.perPassSet);
+                }
+                if (drawState.perPhaseSet && (!lastState || lastState->perPhaseSet != drawState.perPhaseSet)) {
+                    cmdBuff->bindDescriptorSet(static_cast<uint32_t>(pipeline::SetIndex::COUNT), drawState.perPhaseSet);
+                }
+                lastState = &drawState;
+
+                const auto* rangePipelineStates = pipelineStates.data() + range.firstPipelineState;
+                if (range.drawQueue) {
+                    recordResolvedCommandBuffer(*range.drawQueue, cmdBuff, rangePipelineStates, range.first, range.count);
+                } else {
+                    recordResolvedCommandBuffer(*range.instancingQueue, cmdBuff, rangePipelineStates, range.first, range.count);
+                }
+            }
+            cmdBuff->end();
+        };
+
+        if (numCmdBuffs > 1) {
+            JobGraph jobs(JobSystem::getInstance());
+            jobs.createForEachIndexJob(1U, numCmdBuffs, 1U, record);
+            jobs.run();
+            record(0);
+            jobs.waitForAll();
+        } else {
+            record(0);
+        }
+        return numCmdBuffs;
+    }
     void begin(const RasterPass& pass, RenderGraph::vertex_descriptor vertID) const {
         const auto& renderData = get(RenderGraph::DataTag{}, ctx.g, vertID);
         if (!renderData.custom.empty()) {
@@ -1144,6 +1395,21 @@ struct RenderGraphVisitor : boost::dfs_visitor<> {
             const auto& data = res;
             auto* cmdBuff = ctx.cmdBuff;
 
+            if (ctx.parallelPasses && (*ctx.parallelPasses)[vertID]) {
+                // the children are not visited, see the terminator in executeRenderGraph
+                const auto numCmdBuffs = recordSecondaryCommandBuffers(
+                    vertID, data.renderPass.get(), data.framebuffer.get(), scissor);
+                cmdBuff->beginRenderPass(
+                    data.renderPass.get(),
+                    data.framebuffer.get(),
+                    scissor, data.clearColors.data(),
+                    data.clearDepth, data.clearStencil,
+                    ctx.secondaryCmdBuffs, numCmdBuffs);
+                cmdBuff->execute(ctx.secondaryCmdBuffs, numCmdBuffs);
+                ctx.currentPass = data.renderPass.get();
+                return;
+            }
+
             cmdBuff->beginRenderPass(
                 data.renderPass.get(),
                 data.framebuffer.get(),
@@ -1865,12 +2131,18 @@ struct CommandSubmitter {
     CommandSubmitter& operator=(const CommandSubmitter&) = delete;
     ~CommandSubmitter() noexcept {
         primaryCommandBuffer->end();
+        // executed by the primary command buffer, must be flushed first
+        if (numSecondaryCommandBuffers) {
+            device->flushCommands(secondaryCommandBuffers, numSecondaryCommandBuffers);
+        }
         device->flushCommands(cmdBuffers);
         device->getQueue()->submit(cmdBuffers);
     }
     gfx::Device* device = nullptr;
     const std::vector<gfx::CommandBuffer*>& cmdBuffers;
     gfx::CommandBuffer* primaryCommandBuffer = nullptr;
+    gfx::CommandBuffer* const* secondaryCommandBuffers = nullptr;
+    uint32_t numSecondaryCommandBuffers = 0;
 };
 
 void extendResourceLifetime(const NativeRenderQueue& queue, ResourceGroup& group) {
@@ -1883,6 +2155,376 @@ void extendResourceLifetime(const NativeRenderQueue& queue, ResourceGroup& group
     }
 }
 
+uint64_t getTextureMemorySize(const gfx::TextureInfo& info) {
+    uint64_t size = 0;
+    for (uint32_t mip = 0; mip < std::max(info.levelCount, 1U); ++mip) {
+        size += gfx::formatSize(
+            info.format,
+            std::max(info.width >> mip, 1U),
+            std::max(info.height >> mip, 1U),
+            std::max(info.depth >> mip, 1U));
+    }
+    return size * std::max(info.layerCount, 1U) * static_cast<uint32_t>(info.samples);
+}
+
+void collectTransientMemory(const ResourceGraph& resg, RenderGraphStatistics& stats) {
+    // resources of the same aliasing slot share one gfx object
+    ccstd::vector<const gfx::GFXObject*> objects;
+    stats.transientMemorySize = 0;
+    stats.aliasedTransientMemorySize = 0;
+    for (const auto& vertID : makeRange(vertices(resg))) {
+        const auto& traits = get(ResourceGraph::TraitsTag{}, resg, vertID);
+        if (traits.residency != ResourceResidency::MANAGED) {
+            continue;
+        }
+        const gfx::GFXObject* object = nullptr;
+        uint64_t size = 0;
+        if (holds<ManagedTextureTag>(vertID, resg)) {
+            const auto& texture = get(ManagedTextureTag{}, vertID, resg);
+            if (texture.texture && texture.fenceValue == resg.nextFenceValue) {
+                object = texture.texture.get();
+                size = getTextureMemorySize(texture.texture->getInfo());
+            }
+        } else if (holds<ManagedBufferTag>(vertID, resg)) {
+            const auto& buffer = get(ManagedBufferTag{}, vertID, resg);
+            if (buffer.buffer && buffer.fenceValue == resg.nextFenceValue) {
+                object = buffer.buffer.get();
+                size = buffer.buffer->getSize();
+            }
+        }
+        if (!object) {
+            continue;
+        }
+        stats.transientMemorySize += size;
+        if (std::find(objects.begin(), objects.end(), object) == objects.end()) {
+            objects.emplace_back(object);
+            stats.aliasedTransientMemorySize += size;
+        }
+    }
+}
+
+// Flattened inputs of FrameGraphDispatcher::run.
+// The compiled graph keeps them and compares them on a hash hit,
+// so that a hash collision cannot replay the wrong graph.
+// Per-frame data such as clear values, viewports and queue contents is left out.
+struct RenderGraphStructure {
+    explicit RenderGraphStructure(boost::container::pmr::memory_resource* scratch)
+    : data(scratch) {}
+
+    template <class T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, bool> = true>
+    void write(T value) {
+        ccstd::hash_combine(hash, value);
+        data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    void write(std::string_view str) {
+        write(static_cast<uint32_t>(str.size()));
+        ccstd::hash_combine(hash, str);
+        data.append(str.data(), str.size());
+    }
+    void write(const RasterView& view) {
+        write(view.slotName);
+        write(view.slotName1);
+        write(view.accessType);
+        write(view.attachmentType);
+        write(view.loadOp);
+        write(view.storeOp);
+        write(view.clearFlags);
+        write(view.shaderStageFlags);
+    }
+    void write(const ComputeView& view) {
+        write(view.name);
+        write(view.accessType);
+        write(view.plane);
+        write(view.clearFlags);
+        write(view.clearValueType);
+        write(view.shaderStageFlags);
+    }
+    void write(const ResolvePair& pair) {
+        write(pair.source);
+        write(pair.target);
+        write(pair.resolveFlags);
+        write(pair.mode);
+        write(pair.mode1);
+    }
+    void write(const Subpass& subpass) {
+        write(subpass.rasterViews);
+        write(subpass.computeViews);
+        write(subpass.resolvePairs);
+    }
+    template <class T>
+    void write(const ccstd::pmr::vector<T>& values) {
+        write(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            write(value);
+        }
+    }
+    template <class T>
+    void write(const PmrTransparentMap<ccstd::pmr::string, T>& values) {
+        write(static_cast<uint32_t>(values.size()));
+        for (const auto& [name, value] : values) {
+            write(name);
+            write(value);
+        }
+    }
+
+    ccstd::hash_t hash{0};
+    ccstd::pmr::string data;
+};
+
+void writeRenderGraphStructure(
+    const RenderGraph& rg, const ResourceGraph& resg, const LayoutGraphData& lg,
+    RenderGraphStructure& structure) {
+    // the dispatcher keeps references to both graphs
+    structure.write(reinterpret_cast<uintptr_t>(&rg));
+    structure.write(reinterpret_cast<uintptr_t>(&lg));
+
+    // render graph
+    structure.write(num_vertices(rg));
+    for (const auto vertID : makeRange(vertices(rg))) {
+        structure.write(tag(vertID, rg).index());
+        structure.write(get(RenderGraph::NameTag{}, rg, vertID));
+        structure.write(get(RenderGraph::LayoutTag{}, rg, vertID));
+        structure.write(parent(vertID, rg));
+        structure.write(out_degree(vertID, rg));
+        for (const auto e : makeRange(out_edges(vertID, rg))) {
+            structure.write(target(e, rg));
+        }
+        visitObject(
+            vertID, rg,
+            [&](const RasterPass& pass) {
+                structure.write(pass.rasterViews);
+                structure.write(pass.computeViews);
+                structure.write(pass.textures);
+                structure.write(pass.subpassGraph.names);
+                structure.write(pass.subpassGraph.subpasses);
+                structure.write(pass.width);
+                structure.write(pass.height);
+                structure.write(pass.count);
+                structure.write(pass.quality);
+            },
+            [&](const RasterSubpass& subpass) {
+                structure.write(subpass.rasterViews);
+                structure.write(subpass.computeViews);
+                structure.write(subpass.resolvePairs);
+                structure.write(subpass.subpassID);
+                structure.write(subpass.count);
+                structure.write(subpass.quality);
+            },
+            [&](const ComputeSubpass& subpass) {
+                structure.write(subpass.rasterViews);
+                structure.write(subpass.computeViews);
+                structure.write(subpass.subpassID);
+            },
+            [&](const ComputePass& pass) {
+                structure.write(pass.computeViews);
+                structure.write(pass.textures);
+            },
+            [&](const ResolvePass& pass) {
+                structure.write(pass.resolvePairs);
+            },
+            [&](const CopyPass& pass) {
+                structure.write(static_cast<uint32_t>(pass.copyPairs.size()));
+                for (const auto& pair : pass.copyPairs) {
+                    structure.write(pair.source);
+                    structure.write(pair.target);
+                    structure.write(pair.mipLevels);
+                    structure.write(pair.numSlices);
+                    structure.write(pair.sourceMostDetailedMip);
+                    structure.write(pair.sourceFirstSlice);
+                    structure.write(pair.sourcePlaneSlice);
+                    structure.write(pair.targetMostDetailedMip);
+                    structure.write(pair.targetFirstSlice);
+                    structure.write(pair.targetPlaneSlice);
+                    structure.write(pair.sourceOffset);
+                    structure.write(pair.targetOffset);
+                    structure.write(pair.bufferSize);
+                }
+                structure.write(static_cast<uint32_t>(pass.uploadPairs.size()));
+                for (const auto& pair : pass.uploadPairs) {
+                    structure.write(pair.target);
+                    structure.write(pair.mipLevels);
+                    structure.write(pair.numSlices);
+                    structure.write(pair.targetMostDetailedMip);
+                    structure.write(pair.targetFirstSlice);
+                    structure.write(pair.targetPlaneSlice);
+                }
+            },
+            [&](const MovePass& pass) {
+                structure.write(static_cast<uint32_t>(pass.movePairs.size()));
+                for (const auto& pair : pass.movePairs) {
+                    structure.write(pair.source);
+                    structure.write(pair.target);
+                    structure.write(pair.mipLevels);
+                    structure.write(pair.numSlices);
+                    structure.write(pair.targetMostDetailedMip);
+                    structure.write(pair.targetFirstSlice);
+                    structure.write(pair.targetPlaneSlice);
+                }
+            },
+            [&](const RaytracePass& pass) {
+                structure.write(pass.computeViews);
+            },
+            [&](const auto& /*leaf*/) {});
+    }
+    structure.write(rg.sortedVertices);
+
+    // resource graph
+    structure.write(num_vertices(resg));
+    for (const auto resID : makeRange(vertices(resg))) {
+        const auto& desc = get(ResourceGraph::DescTag{}, resg, resID);
+        const auto& traits = get(ResourceGraph::TraitsTag{}, resg, resID);
+        structure.write(tag(resID, resg).index());
+        structure.write(get(ResourceGraph::NameTag{}, resg, resID));
+        structure.write(parent(resID, resg));
+        structure.write(desc.dimension);
+        structure.write(desc.alignment);
+        structure.write(desc.width);
+        structure.write(desc.height);
+        structure.write(desc.depthOrArraySize);
+        structure.write(desc.mipLevels);
+        structure.write(desc.format);
+        structure.write(desc.sampleCount);
+        structure.write(desc.textureFlags);
+        structure.write(desc.flags);
+        structure.write(traits.residency);
+        if (traits.hasSideEffects()) {
+            // barriers of external resources start from their previous states
+            structure.write(get(ResourceGraph::StatesTag{}, resg, resID).states);
+        }
+        // aliasing depends on which managed resources already own an object
+        if (holds<ManagedTextureTag>(resID, resg)) {
+            structure.write(static_cast<bool>(get(ManagedTextureTag{}, resID, resg).texture));
+        } else if (holds<ManagedBufferTag>(resID, resg)) {
+            structure.write(static_cast<bool>(get(ManagedBufferTag{}, resID, resg).buffer));
+        } else if (holds<SubresourceViewTag>(resID, resg)) {
+            const auto& view = get(SubresourceViewTag{}, resID, resg);
+            structure.write(view.format);
+            structure.write(view.indexOrFirstMipLevel);
+            structure.write(view.numMipLevels);
+            structure.write(view.firstArraySlice);
+            structure.write(view.numArraySlices);
+            structure.write(view.firstPlane);
+            structure.write(view.numPlanes);
+        }
+    }
+}
+
+// pass scheduling switches, set by ppl.setValue(name, value)
+constexpr const char* PASS_REORDER_MACRO = "CC_PIPELINE_PASS_REORDER";
+constexpr const char* PARALLEL_WEIGHT_MACRO = "CC_PIPELINE_PARALLEL_WEIGHT";
+
+struct PassSchedulingConfig {
+    bool enablePassReorder{false};
+    // percent, 0 favors memory, 100 favors parallelism
+    int32_t parallelWeight{0};
+};
+
+PassSchedulingConfig getPassSchedulingConfig(const NativePipeline& ppl) {
+    PassSchedulingConfig config{};
+    auto iter = ppl.macros.find(PASS_REORDER_MACRO);
+    if (iter != ppl.macros.end() && ccstd::holds_alternative<bool>(iter->second)) {
+        config.enablePassReorder = ccstd::get<bool>(iter->second);
+    }
+    iter = ppl.macros.find(PARALLEL_WEIGHT_MACRO);
+    if (iter != ppl.macros.end() && ccstd::holds_alternative<int32_t>(iter->second)) {
+        config.parallelWeight = std::clamp(ccstd::get<int32_t>(iter->second), 0, 100);
+    }
+    return config;
+}
+
+FrameGraphDispatcher& compileRenderGraph(NativePipeline& ppl, const RenderGraph& rg, const LayoutGraphData& lg) {
+    auto& cache = getPipelineCache(ppl).compiledRenderGraph;
+    auto& resg = ppl.resourceGraph;
+
+    const auto config = getPassSchedulingConfig(ppl);
+    RenderGraphStructure structure(&ppl.unsyncPool);
+    writeRenderGraphStructure(rg, resg, lg, structure);
+    structure.write(config.enablePassReorder);
+    structure.write(config.parallelWeight);
+    if (cache.dispatcher && cache.key == structure.hash &&
+        std::string_view{cache.structure} == std::string_view{structure.data}) {
+        // same graph as last time, replay the states run() would have left
+        for (const auto& [resID, states] : cache.finalStates) {
+            get(ResourceGraph::StatesTag{}, resg, resID).states = states;
+        }
+        ++getPipelineCache(ppl).statistics.numCacheHits;
+        return *cache.dispatcher;
+    }
+
+    // the dispatcher outlives the frame, so it is allocated from the pipeline
+    // and only uses the frame pool as scratch.
+    cache.dispatcher = std::make_unique<FrameGraphDispatcher>(
+        resg, rg, lg, &ppl.unsyncPool, ppl.get_allocator());
+    auto& fgd = *cache.dispatcher;
+    fgd.enableMemoryAliasing(true);
+    fgd.enablePassReorder(config.enablePassReorder);
+    fgd.setParalellWeight(static_cast<float>(config.parallelWeight) / 100.0F);
+    fgd.run();
+
+    cache.finalStates.clear();
+    for (const auto resID : makeRange(vertices(resg))) {
+        if (get(ResourceGraph::TraitsTag{}, resg, resID).hasSideEffects()) {
+            cache.finalStates.emplace_back(resID, get(ResourceGraph::StatesTag{}, resg, resID).states);
+        }
+    }
+    cache.key = structure.hash;
+    cache.structure.assign(structure.data.begin(), structure.data.end());
+    ++getPipelineCache(ppl).statistics.numCacheMisses;
+    return fgd;
+}
+
+// parallel recording switch, set by ppl.setValue(name, value)
+constexpr const char* PARALLEL_RECORDING_MACRO = "CC_PIPELINE_PARALLEL_RECORDING";
+// passes with fewer draws are cheaper to record inline
+constexpr uint32_t PARALLEL_RECORDING_MIN_DRAWS = 256;
+
+uint32_t getParallelRecordingWorkerCount(const NativePipeline& ppl) {
+    auto iter = ppl.macros.find(PARALLEL_RECORDING_MACRO);
+    if (iter != ppl.macros.end() && ccstd::holds_alternative<bool>(iter->second) &&
+        !ccstd::get<bool>(iter->second)) {
+        return 1;
+    }
+    // only vulkan records secondary command buffers from any thread
+    if (ppl.device->getGfxAPI() != gfx::API::VULKAN) {
+        return 1;
+    }
+    return JobSystem::getInstance()->threadCount() + 1;
+}
+
+// sortedVertices ordered as the dispatcher scheduled the passes,
+// vertices without a pass of their own keep following their predecessor.
+ccstd::pmr::vector<RenderGraph::vertex_descriptor> getPassExecutionOrder(
+    const FrameGraphDispatcher& fgd, const RenderGraph& rg,
+    boost::container::pmr::memory_resource* scratch) {
+    const auto& rag = fgd.resourceAccessGraph;
+    ccstd::pmr::vector<uint32_t> position(
+        num_vertices(rag), std::numeric_limits<uint32_t>::max(), scratch);
+    for (uint32_t i = 0; i != rag.topologicalOrder.size(); ++i) {
+        position[rag.topologicalOrder[i]] = i;
+    }
+
+    ccstd::pmr::vector<std::pair<uint32_t, RenderGraph::vertex_descriptor>> ranked(scratch);
+    ranked.reserve(rg.sortedVertices.size());
+    uint32_t rank = 0;
+    for (const auto vertID : rg.sortedVertices) {
+        auto iter = rag.passIndex.find(vertID);
+        if (iter != rag.passIndex.end() && position[iter->second] != std::numeric_limits<uint32_t>::max()) {
+            rank = position[iter->second];
+        }
+        ranked.emplace_back(rank, vertID);
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    ccstd::pmr::vector<RenderGraph::vertex_descriptor> order(scratch);
+    order.reserve(ranked.size());
+    for (const auto& [r, vertID] : ranked) {
+        order.emplace_back(vertID);
+    }
+    return order;
+}
+
 void collectStatistics(const NativePipeline& ppl, PipelineStatistics& stats) {
     // resources
     stats.numRenderPasses = static_cast<uint32_t>(ppl.resourceGraph.renderPasses.size());
@@ -1933,13 +2575,7 @@ void NativePipeline::executeRenderGraph(const RenderGraph& rg) {
     ResourceCleaner cleaner(ppl.resourceGraph);
 
     auto& lg = ppl.programLibrary->layoutGraph;
-    FrameGraphDispatcher fgd(
-        ppl.resourceGraph, rg,
-        lg, &ppl.unsyncPool, scratch);
-    fgd.enableMemoryAliasing(false);
-    fgd.enablePassReorder(false);
-    fgd.setParalellWeight(0);
-    fgd.run();
+    const auto& fgd = compileRenderGraph(ppl, rg, lg);
 
     AddressableView<RenderGraph> graphView(rg);
     ccstd::pmr::vector<bool> validPasses(num_vertices(rg), true, scratch);
@@ -1999,6 +2635,8 @@ void NativePipeline::executeRenderGraph(const RenderGraph& rg) {
             boost::keep_all, RenderGraphFilter>
             fg(graphView, boost::keep_all{}, RenderGraphFilter{&validPasses});
 
+        // outlives the submitter, which flushes them
+        ccstd::pmr::vector<gfx::CommandBuffer*> secondaryCmdBuffs(scratch);
         CommandSubmitter submit(ppl.device, ppl.getCommandBuffers());
 
         // upload buffers
@@ -2048,17 +2686,57 @@ void NativePipeline::executeRenderGraph(const RenderGraph& rg) {
             },
             scratch};
 
+        // draw heavy raster passes are recorded on job threads
+        ccstd::pmr::vector<bool> parallelPasses(num_vertices(rg), false, scratch);
+        uint32_t numParallelPasses = 0;
+        const auto numWorkers = getParallelRecordingWorkerCount(ppl);
+        if (numWorkers > 1) {
+            for (const auto vertID : makeRange(vertices(rg))) {
+                if (getParallelDrawCount(ctx, vertID) >= PARALLEL_RECORDING_MIN_DRAWS) {
+                    parallelPasses[vertID] = true;
+                    ++numParallelPasses;
+                }
+            }
+        }
+        if (numParallelPasses) {
+            auto& cmdBuffs = getPipelineCache(ppl).secondaryCommandBuffers;
+            while (cmdBuffs.size() < numWorkers) {
+                cmdBuffs.emplace_back(ppl.device->createCommandBuffer(
+                    gfx::CommandBufferInfo{ppl.device->getQueue(), gfx::CommandBufferType::SECONDARY}));
+            }
+            for (uint32_t i = 0; i != numWorkers; ++i) {
+                secondaryCmdBuffs.emplace_back(cmdBuffs[i].get());
+            }
+            ctx.parallelPasses = &parallelPasses;
+            ctx.secondaryCmdBuffs = secondaryCmdBuffs.data();
+            ctx.numSecondaryCmdBuffs = numWorkers;
+            submit.secondaryCommandBuffers = secondaryCmdBuffs.data();
+            submit.numSecondaryCommandBuffers = numWorkers;
+        }
+
         RenderGraphVisitor visitor{{}, ctx};
         auto colors = rg.colors(scratch);
-        for (const auto vertID : ctx.g.sortedVertices) {
+        for (const auto vertID : getPassExecutionOrder(fgd, ctx.g, scratch)) {
             if (holds<RasterPassTag>(vertID, ctx.g) || holds<ComputeTag>(vertID, ctx.g) || holds<CopyTag>(vertID, ctx.g)) {
-                boost::depth_first_visit(fg, vertID, visitor, get(colors, ctx.g));
+                boost::depth_first_visit(
+                    fg, vertID, visitor, get(colors, ctx.g),
+                    [&parallelPasses](RenderGraph::vertex_descriptor v, const auto& /*g*/) {
+                        return bool(parallelPasses[v]);
+                    });
             }
         }
+        getPipelineCache(*this).statistics.numParallelRecordedPasses = numParallelPasses;
     }
 
     // collect statistics
     collectStatistics(*this, statistics);
+    auto& renderGraphStatistics = getPipelineCache(*this).statistics;
+    collectTransientMemory(resourceGraph, renderGraphStatistics);
+    CC_PROFILE_OBJECT_UPDATE(RenderGraphCacheHits, renderGraphStatistics.numCacheHits);
+    CC_PROFILE_OBJECT_UPDATE(RenderGraphCacheMisses, renderGraphStatistics.numCacheMisses);
+    CC_PROFILE_OBJECT_UPDATE(TransientMemoryKB, static_cast<uint32_t>(renderGraphStatistics.transientMemorySize / 1024));
+    CC_PROFILE_OBJECT_UPDATE(AliasedTransientMemoryKB, static_cast<uint32_t>(renderGraphStatistics.aliasedTransientMemorySize / 1024));
+    CC_PROFILE_OBJECT_UPDATE(ParallelRecordedPasses, renderGraphStatistics.numParallelRecordedPasses);
 }
 
 } // namespace render
@@ -26,6 +26,7 @@
 #include <sstream>
 #include "BinaryArchive.h"
 #include "LayoutGraphSerialization.h"
+#include "NativePipelineCache.h"
 #include "NativePipelineTypes.h"
 #include "RenderInterfaceTypes.h"
 #include "RenderingModule.h"
@@ -63,6 +64,7 @@ RenderingModule* Factory::init(gfx::Device* deviceIn, const ccstd::vector<unsign
 void Factory::destroy(RenderingModule* renderingModule) noexcept {
     auto* ptr = dynamic_cast<NativeRenderingModule*>(renderingModule);
     if (ptr) {
+        destroyProgramVariantCache(*ptr->programLibrary);
         ptr->programLibrary.reset();
         CC_EXPECTS(sRenderingModule == renderingModule);
         sRenderingModule = nullptr;
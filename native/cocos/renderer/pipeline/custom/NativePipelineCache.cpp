@@ -0,0 +1,71 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#include "cocos/renderer/pipeline/custom/NativePipelineCache.h"
+#include "cocos/renderer/pipeline/custom/NativePipelineTypes.h"
+
+namespace cc {
+
+namespace render {
+
+namespace {
+
+// keyed by owner, both are created and destroyed on the main thread
+ccstd::unordered_map<const NativePipeline *, std::unique_ptr<NativePipelineCache>> pipelineCaches;
+ccstd::unordered_map<const NativeProgramLibrary *, std::unique_ptr<ProgramVariantCache>> programVariantCaches;
+
+template <class Cache, class Owner>
+Cache &getOrCreate(ccstd::unordered_map<const Owner *, std::unique_ptr<Cache>> &caches, const Owner &owner) {
+    auto &cache = caches[&owner];
+    if (!cache) {
+        cache = std::make_unique<Cache>();
+    }
+    return *cache;
+}
+
+} // namespace
+
+NativePipelineCache &getPipelineCache(const NativePipeline &ppl) {
+    return getOrCreate(pipelineCaches, ppl);
+}
+
+void destroyPipelineCache(const NativePipeline &ppl) {
+    pipelineCaches.erase(&ppl);
+}
+
+const RenderGraphStatistics &getRenderGraphStatistics(const NativePipeline &ppl) {
+    return getPipelineCache(ppl).statistics;
+}
+
+ProgramVariantCache &getProgramVariantCache(const NativeProgramLibrary &lib) {
+    return getOrCreate(programVariantCaches, lib);
+}
+
+void destroyProgramVariantCache(const NativeProgramLibrary &lib) {
+    programVariantCaches.erase(&lib);
+}
+
+} // namespace render
+
+} // namespace cc
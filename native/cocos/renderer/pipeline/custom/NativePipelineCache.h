@@ -0,0 +1,82 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+
+#pragma once
+#include "cocos/base/Ptr.h"
+#include "cocos/base/std/container/string.h"
+#include "cocos/base/std/container/unordered_map.h"
+#include "cocos/base/std/container/vector.h"
+#include "cocos/renderer/core/ProgramVariantKey.h"
+#include "cocos/renderer/gfx-base/GFXCommandBuffer.h"
+#include "cocos/renderer/pipeline/custom/FGDispatcherTypes.h"
+#include "cocos/renderer/pipeline/custom/NativePipelineFwd.h"
+#include "cocos/renderer/pipeline/custom/PrivateTypes.h"
+#include "cocos/renderer/pipeline/custom/RenderGraphTypes.h"
+
+namespace cc {
+
+namespace render {
+
+// NativePipeline and NativeProgramLibrary are generated together with the web pipeline,
+// the states only the native pipeline keeps are stored here.
+
+struct CompiledRenderGraph {
+    std::unique_ptr<FrameGraphDispatcher> dispatcher;
+    ccstd::hash_t key{0};
+    // flattened inputs of the dispatcher, compared on a key hit
+    ccstd::string structure;
+    ccstd::vector<std::pair<ResourceGraph::vertex_descriptor, gfx::AccessFlagBit>> finalStates;
+};
+
+struct RenderGraphStatistics {
+    uint64_t transientMemorySize{0};
+    uint64_t aliasedTransientMemorySize{0};
+    uint32_t numCacheHits{0};
+    uint32_t numCacheMisses{0};
+    uint32_t numParallelRecordedPasses{0};
+};
+
+struct NativePipelineCache {
+    CompiledRenderGraph compiledRenderGraph;
+    RenderGraphStatistics statistics;
+    // raster passes recorded on job threads, one per worker
+    ccstd::vector<IntrusivePtr<gfx::CommandBuffer>> secondaryCommandBuffers;
+};
+
+// packed variant keys per phase, resolving to the proxies of ProgramGroup::programProxies
+using ProgramVariantCache = ccstd::unordered_map<
+    uint32_t, ccstd::unordered_map<ProgramVariantKey, IntrusivePtr<ProgramProxy>, ccstd::hash<ProgramVariantKey>>>;
+
+NativePipelineCache &getPipelineCache(const NativePipeline &ppl);
+void destroyPipelineCache(const NativePipeline &ppl);
+
+// counters of the last executed render graph, the cache counters accumulate since startup
+const RenderGraphStatistics &getRenderGraphStatistics(const NativePipeline &ppl);
+
+ProgramVariantCache &getProgramVariantCache(const NativeProgramLibrary &lib);
+void destroyProgramVariantCache(const NativeProgramLibrary &lib);
+
+} // namespace render
+
+} // namespace cc
@@ -33,6 +33,7 @@
 #include <utility>
 #include "LayoutGraphGraphs.h"
 #include "LayoutGraphUtils.h"
+#include "NativePipelineCache.h"
 #include "NativePipelineTypes.h"
 #include "ProgramLib.h"
 #include "base/Ptr.h"
@@ -1242,6 +1243,7 @@ void NativeProgramLibrary::setPipeline(PipelineRuntime *pipelineIn) {
 }
 
 void NativeProgramLibrary::destroy() {
+    destroyProgramVariantCache(*this);
     emptyDescriptorSetLayout.reset();
     emptyPipelineLayout.reset();
 }
@@ -1473,8 +1475,16 @@ ProgramProxy *NativeProgramLibrary::getProgramVariant(
 
     std::string_view key;
     ccstd::string key1;
+    ProgramVariantKey variantKey;
 
     if (key0 == nullptr) {
+        // packed key, the string key is only built when the variant is missing
+        variantKey = getProgramVariantKey(programInfo, defines);
+        auto &variants = getProgramVariantCache(*this)[phaseID];
+        auto iter3 = variants.find(variantKey);
+        if (iter3 != variants.end()) {
+            return iter3->second.get();
+        }
         key1 = getVariantKey(programInfo, defines);
         key = key1;
     } else {
@@ -1483,6 +1493,9 @@ ProgramProxy *NativeProgramLibrary::getProgramVariant(
 
     auto iter3 = phase.programProxies.find(key);
     if (iter3 != phase.programProxies.end()) {
+        if (key0 == nullptr) {
+            getProgramVariantCache(*this)[phaseID].emplace(variantKey, iter3->second);
+        }
         return iter3->second.get();
     }
 
@@ -1528,6 +1541,9 @@ ProgramProxy *NativeProgramLibrary::getProgramVariant(
         key,
         IntrusivePtr<ProgramProxy>(new NativeProgramProxy(std::move(shader))));
     CC_ENSURES(res.second);
+    if (key0 == nullptr) {
+        getProgramVariantCache(*this)[phaseID].emplace(variantKey, res.first->second);
+    }
 
     return res.first->second.get();
 }
@@ -25,8 +25,10 @@
 #include <algorithm>
 #include <iterator>
 #include "NativePipelineTypes.h"
+#include "NativeUtils.h"
 #include "cocos/renderer/pipeline/Define.h"
 #include "cocos/renderer/pipeline/PipelineStateManager.h"
+#include "cocos/renderer/pipeline/RenderQueueSort.h"
 #include "cocos/renderer/pipeline/custom/details/GslUtils.h"
 #include "scene/gpu-scene/GPUBatchPool.h"
 #include "scene/gpu-scene/GPUScene.h"
@@ -37,6 +39,34 @@ namespace cc {
 
 namespace render {
 
+namespace {
+
+// Sorts the instances by packed keys, returns false if an instance does not fit in its key.
+template <class MakeKey>
+bool sortDrawInstances(ccstd::pmr::vector<DrawInstance> &instances, const MakeKey &makeKey) {
+    const auto count = static_cast<uint32_t>(instances.size());
+    ccstd::pmr::vector<pipeline::RenderQueueSortKey> keys(count, instances.get_allocator());
+    for (uint32_t i = 0; i != count; ++i) {
+        keys[i].index = i;
+        if (!makeKey(instances[i], &keys[i].key)) {
+            return false;
+        }
+    }
+    ccstd::pmr::vector<pipeline::RenderQueueSortKey> scratch(count, instances.get_allocator());
+    pipeline::sortRenderQueueKeys(keys.data(), scratch.data(), count);
+    pipeline::sortRenderQueueKeyTies(keys.data(), count, [&](uint32_t index) { return instances[index].shaderID; });
+
+    ccstd::pmr::vector<DrawInstance> sorted(instances.get_allocator());
+    sorted.reserve(count);
+    for (const auto &key : keys) {
+        sorted.emplace_back(instances[key.index]);
+    }
+    instances.swap(sorted);
+    return true;
+}
+
+} // namespace
+
 // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
 void RenderDrawQueue::add(const scene::Model &model, float depth, uint32_t subModelIdx, uint32_t passIdx) {
     const auto *subModel = model.getSubModels()[subModelIdx].get();
@@ -52,6 +82,13 @@ void RenderDrawQueue::add(const scene::Model &model, float depth, uint32_t subMo
 }
 
 void RenderDrawQueue::sortOpaqueOrCutout() {
+    const bool sorted = sortDrawInstances(instances, [](const DrawInstance &instance, uint64_t *key) {
+        *key = pipeline::makeOpaqueSortKey(instance.hash, instance.depth);
+        return true;
+    });
+    if (sorted) {
+        return;
+    }
     std::sort(instances.begin(), instances.end(), [](const DrawInstance &lhs, const DrawInstance &rhs) {
         return std::forward_as_tuple(lhs.hash, lhs.depth, lhs.shaderID) <
                std::forward_as_tuple(rhs.hash, rhs.depth, rhs.shaderID);
@@ -59,6 +96,12 @@ void RenderDrawQueue::sortOpaqueOrCutout() {
 }
 
 void RenderDrawQueue::sortTransparent() {
+    const bool sorted = sortDrawInstances(instances, [](const DrawInstance &instance, uint64_t *key) {
+        return pipeline::makeTransparentSortKey(instance.priority, instance.hash, instance.depth, key);
+    });
+    if (sorted) {
+        return;
+    }
     std::sort(instances.begin(), instances.end(), [](const DrawInstance &lhs, const DrawInstance &rhs) {
         return std::forward_as_tuple(lhs.priority, lhs.hash, -lhs.depth, lhs.shaderID) <
                std::forward_as_tuple(rhs.priority, rhs.hash, -rhs.depth, rhs.shaderID);
@@ -86,6 +129,38 @@ void RenderDrawQueue::recordCommandBuffer(
     }
 }
 
+void resolvePipelineStates(
+    const RenderDrawQueue &queue, gfx::RenderPass *renderPass, uint32_t subpassIndex, uint32_t first, uint32_t count,
+    ccstd::pmr::vector<gfx::PipelineState *> &pipelineStates) {
+    CC_EXPECTS(first + count <= queue.instances.size());
+    for (uint32_t i = first; i != first + count; ++i) {
+        const auto &instance = queue.instances[i];
+        const auto *subModel = instance.subModel;
+        const auto passIdx = instance.passIndex;
+        pipelineStates.emplace_back(pipeline::PipelineStateManager::getOrCreatePipelineState(
+            subModel->getPass(passIdx), subModel->getShader(passIdx),
+            subModel->getInputAssembler(), renderPass, subpassIndex));
+    }
+}
+
+void recordResolvedCommandBuffer(
+    const RenderDrawQueue &queue, gfx::CommandBuffer *cmdBuff, gfx::PipelineState *const *pipelineStates,
+    uint32_t first, uint32_t count) {
+    CC_EXPECTS(first + count <= queue.instances.size());
+    for (uint32_t i = 0; i != count; ++i) {
+        const auto &instance = queue.instances[first + i];
+        const auto *subModel = instance.subModel;
+        auto *inputAssembler = subModel->getInputAssembler();
+        const auto *pass = subModel->getPass(instance.passIndex);
+
+        cmdBuff->bindPipelineState(pipelineStates[i]);
+        cmdBuff->bindDescriptorSet(pipeline::materialSet, pass->getDescriptorSet());
+        cmdBuff->bindDescriptorSet(pipeline::localSet, subModel->getDescriptorSet());
+        cmdBuff->bindInputAssembler(inputAssembler);
+        cmdBuff->draw(inputAssembler);
+    }
+}
+
 bool RenderInstancingQueue::empty() const noexcept {
     CC_EXPECTS(!passInstances.empty() || sortedBatches.empty());
     return passInstances.empty();
@@ -177,6 +252,53 @@ void RenderInstancingQueue::recordCommandBuffer(
     }
 }
 
+void resolvePipelineStates(
+    const RenderInstancingQueue &queue, gfx::RenderPass *renderPass, uint32_t firstBatch, uint32_t batchCount,
+    ccstd::pmr::vector<gfx::PipelineState *> &pipelineStates) {
+    CC_EXPECTS(firstBatch + batchCount <= queue.sortedBatches.size());
+    for (uint32_t i = firstBatch; i != firstBatch + batchCount; ++i) {
+        const auto *instanceBuffer = queue.sortedBatches[i];
+        if (!instanceBuffer->hasPendingModels()) {
+            continue;
+        }
+        const auto *drawPass = instanceBuffer->getPass();
+        for (const auto &instance : instanceBuffer->getInstances()) {
+            pipelineStates.emplace_back(instance.drawInfo.instanceCount
+                                            ? pipeline::PipelineStateManager::getOrCreatePipelineState(
+                                                  drawPass, instance.shader, instance.ia, renderPass)
+                                            : nullptr);
+        }
+    }
+}
+
+void recordResolvedCommandBuffer(
+    const RenderInstancingQueue &queue, gfx::CommandBuffer *cmdBuffer, gfx::PipelineState *const *pipelineStates,
+    uint32_t firstBatch, uint32_t batchCount) {
+    CC_EXPECTS(firstBatch + batchCount <= queue.sortedBatches.size());
+    for (uint32_t i = firstBatch; i != firstBatch + batchCount; ++i) {
+        const auto *instanceBuffer = queue.sortedBatches[i];
+        if (!instanceBuffer->hasPendingModels()) {
+            continue;
+        }
+        const auto &instances = instanceBuffer->getInstances();
+        cmdBuffer->bindDescriptorSet(pipeline::materialSet, instanceBuffer->getPass()->getDescriptorSet());
+        gfx::PipelineState *lastPSO = nullptr;
+        for (const auto &instance : instances) {
+            auto *pso = *pipelineStates++;
+            if (!instance.drawInfo.instanceCount) {
+                continue;
+            }
+            if (lastPSO != pso) {
+                cmdBuffer->bindPipelineState(pso);
+                lastPSO = pso;
+            }
+            cmdBuffer->bindDescriptorSet(pipeline::localSet, instance.descriptorSet, instanceBuffer->dynamicOffsets());
+            cmdBuffer->bindInputAssembler(instance.ia);
+            cmdBuffer->draw(instance.ia);
+        }
+    }
+}
+
 void RenderBatchingQueue::recordCommandBuffer(gfx::Device *device, const scene::Camera *camera, 
     gfx::RenderPass *renderPass, gfx::CommandBuffer *cmdBuffer, SceneFlags sceneFlags) {
     std::ignore = device;
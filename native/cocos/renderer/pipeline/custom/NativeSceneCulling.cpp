@@ -1,3 +1,8 @@
+#include <atomic>
+#include "cocos/base/job-system/JobSystem.h"
+#include "cocos/base/std/container/deque.h"
+#include "cocos/core/geometry/FrustumCulling.h"
+#include "cocos/renderer/pipeline/LightBinning.h"
 #include "cocos/renderer/pipeline/custom/NativePipelineTypes.h"
 #include "cocos/renderer/pipeline/custom/NativeRenderGraphUtils.h"
 #include "cocos/renderer/pipeline/custom/details/GslUtils.h"
@@ -127,14 +132,16 @@ bool isFrustumVisible(const scene::Model& model, const geometry::Frustum& frustu
     return transWorldBounds.aabbFrustum(frustum);
 }
 
+// results[i] receives the models visible in frustums[i]
 void octreeCulling(
     const scene::Octree& octree,
     const scene::Model* skyboxModelToSkip,
     const scene::RenderScene& scene,
     const scene::Camera& camera,
-    const geometry::Frustum& cameraOrLightFrustum,
+    const geometry::Frustum* const* frustums,
+    uint32_t frustumCount,
     bool bCastShadow,
-    ccstd::vector<const scene::Model*>& models) {
+    ccstd::vector<const scene::Model*>* const* results) {
     const auto visibility = camera.getVisibility();
     // add instances without world bounds
     for (const auto& pModel : scene.getModels()) {
@@ -157,19 +164,24 @@ void octreeCulling(
         }
         // filter model by view visibility
         if (isNodeVisible(model.getNode(), visibility) || isModelVisible(model, visibility)) {
-            models.emplace_back(&model);
+            for (uint32_t i = 0; i != frustumCount; ++i) {
+                results[i]->emplace_back(&model);
+            }
         }
     }
     // add instances with world bounds
-    octree.queryVisibility(&camera, cameraOrLightFrustum, bCastShadow, models);
+    octree.queryVisibility(&camera, frustums, frustumCount, bCastShadow, results);
 
     // TODO(zhouzhenglong): move lod culling into octree query
-    auto iter = std::remove_if(
-        models.begin(), models.end(),
-        [&](const scene::Model* model) {
-            return scene.isCulledByLod(&camera, model);
-        });
-    models.erase(iter, models.end());
+    for (uint32_t i = 0; i != frustumCount; ++i) {
+        auto& models = *results[i];
+        auto iter = std::remove_if(
+            models.begin(), models.end(),
+            [&](const scene::Model* model) {
+                return scene.isCulledByLod(&camera, model);
+            });
+        models.erase(iter, models.end());
+    }
 }
 
 void bruteForceCulling(
@@ -208,18 +220,80 @@ void bruteForceCulling(
     }
 }
 
+// Storage reused across frames, owned by one culling worker at a time.
+struct CullingScratch {
+    ccstd::vector<uint64_t> frustumVisibility;
+    ccstd::vector<const geometry::Frustum*> frustums;
+    ccstd::vector<ccstd::vector<const scene::Model*>*> results;
+    ccstd::vector<scene::Model*> lightCandidates;
+};
+
+void batchedBruteForceCulling(
+    const scene::Model* skyboxModelToSkip,
+    const scene::RenderScene& scene,
+    const geometry::PackedAABBs& packedBounds,
+    const scene::Camera& camera,
+    const geometry::Frustum& cameraOrLightFrustum,
+    bool bCastShadow,
+    CullingScratch& scratch,
+    ccstd::vector<const scene::Model*>& models) {
+    auto& frustumVisibility = scratch.frustumVisibility;
+    const auto& sceneModels = scene.getModels();
+    CC_EXPECTS(packedBounds.size() == sceneModels.size());
+
+    // frustum culling, all models at once
+    geometry::frustumCullingBatch(cameraOrLightFrustum, packedBounds, frustumVisibility);
+
+    // remaining tests only run on models inside the frustum
+    const auto visibility = camera.getVisibility();
+    geometry::forEachVisible(frustumVisibility, [&](uint32_t modelID) {
+        const auto& model = *sceneModels[modelID];
+        if (!model.isEnabled()) {
+            return;
+        }
+        if (bCastShadow && !model.isCastShadow()) {
+            return;
+        }
+        // filter model by view visibility
+        if (!isNodeVisible(model.getNode(), visibility) && !isModelVisible(model, visibility)) {
+            return;
+        }
+        // is skybox, skip
+        if (&model == skyboxModelToSkip) {
+            return;
+        }
+        // lod culling
+        if (scene.isCulledByLod(&camera, &model)) {
+            return;
+        }
+        models.emplace_back(&model);
+    });
+}
+
 void sceneCulling(
     const scene::Model* skyboxModelToSkip,
     const scene::RenderScene& scene,
     const scene::Camera& camera,
     const geometry::Frustum& cameraOrLightFrustum,
     bool bCastShadow,
+    CullingScratch& scratch,
     ccstd::vector<const scene::Model*>& models) {
     const auto* const octree = scene.getOctree();
     if (octree && octree->isEnabled()) {
+        const geometry::Frustum* const frustums[] = {&cameraOrLightFrustum};
+        ccstd::vector<const scene::Model*>* const results[] = {&models};
         octreeCulling(
             *octree, skyboxModelToSkip,
-            scene, camera, cameraOrLightFrustum, bCastShadow, models);
+            scene, camera, frustums, 1, bCastShadow, results);
+        return;
+    }
+    // planar shadow transforms world bounds by the light matrix, which packed bounds do not handle
+    const auto* const packedBounds = scene.getPackedModelBounds();
+    const bool bPlanarShadow = bCastShadow && pSceneData->getShadows()->getType() == scene::ShadowType::PLANAR;
+    if (packedBounds && !bPlanarShadow) {
+        batchedBruteForceCulling(
+            skyboxModelToSkip,
+            scene, *packedBounds, camera, cameraOrLightFrustum, bCastShadow, scratch, models);
     } else {
         bruteForceCulling(
             skyboxModelToSkip,
@@ -227,12 +301,89 @@ void sceneCulling(
     }
 }
 
+// Models lit by a sphere, point or ranged directional light: only the models overlapping
+// the light volume are taken from the scene's spatial index, then culled by the camera.
+// Models without world bounds are not indexed and receive no per-light pass.
+void lightVolumeCulling(
+    const scene::Model* skyboxModelToSkip,
+    const scene::RenderScene& scene,
+    const scene::Camera& camera,
+    const geometry::Frustum& cameraFrustum,
+    bool bCastShadow,
+    const scene::Light& light,
+    const geometry::AABB& lightBounds,
+    CullingScratch& scratch,
+    ccstd::vector<const scene::Model*>& models) {
+    auto& candidates = scratch.lightCandidates;
+    candidates.clear();
+    scene.queryModels(lightBounds, candidates);
+
+    const auto visibility = camera.getVisibility();
+    for (const auto* pModel : candidates) {
+        const auto& model = *pModel;
+        if (bCastShadow && !model.isCastShadow()) {
+            continue;
+        }
+        // filter model by view visibility
+        if (!isNodeVisible(model.getNode(), visibility) && !isModelVisible(model, visibility)) {
+            continue;
+        }
+        if (!isFrustumVisible(model, cameraFrustum, bCastShadow)) {
+            continue;
+        }
+        // is skybox, skip
+        if (&model == skyboxModelToSkip) {
+            continue;
+        }
+        if (!pipeline::LightBinning::isModelLit(light, lightBounds, model)) {
+            continue;
+        }
+        // lod culling
+        if (scene.isCulledByLod(&camera, &model)) {
+            continue;
+        }
+        models.emplace_back(&model);
+    }
+}
+
+// A culling query with its frustum resolved, ready to run on any thread.
+struct CullingTask {
+    const scene::RenderScene* scene{nullptr};
+    const scene::Camera* camera{nullptr};
+    const geometry::Frustum* frustum{nullptr};
+    bool bCastShadow{false};
+    uint32_t sourceID{0xFFFFFFFF};
+    // set for lights culled by their volume
+    const scene::Light* light{nullptr};
+    geometry::AABB lightBounds;
+};
+
+// Consecutive tasks culled together, more than one only when they can share an octree traversal.
+struct CullingGroup {
+    uint32_t firstTask{0};
+    uint32_t taskCount{0};
+};
+
+bool canShareTraversal(const CullingTask& lhs, const CullingTask& rhs) {
+    return lhs.scene == rhs.scene && lhs.camera == rhs.camera && lhs.bCastShadow == rhs.bCastShadow &&
+           !lhs.light && !rhs.light;
+}
+
+ccstd::vector<CullingTask> cullingTasks;
+ccstd::vector<CullingGroup> cullingGroups;
+ccstd::vector<CullingScratch> cullingScratches;
+// CSM frustums are overwritten when layers are updated for another camera, keep a copy per task.
+ccstd::deque<geometry::Frustum> csmFrustums;
+
 } // namespace
 
 void SceneCulling::batchCulling(const pipeline::PipelineSceneData& pplSceneData) {
     const auto* const skybox = pplSceneData.getSkybox();
     const auto* const skyboxModelToSkip = skybox ? skybox->getModel() : nullptr;
 
+    // Serial phase: resolve frustums, CSM layers are updated here.
+    cullingTasks.clear();
+    uint32_t numCsmFrustums = 0;
     for (const auto& [scene, queries] : sceneQueries) {
         CC_ENSURES(scene);
         for (const auto& [key, sourceID] : queries.culledResultIndex) {
@@ -244,23 +395,17 @@ void SceneCulling::batchCulling(const pipeline::PipelineSceneData& pplSceneData)
             const auto bCastShadow = key.castShadow;
 
             CC_EXPECTS(sourceID < culledResults.size());
-            auto& models = culledResults[sourceID];
 
+            const geometry::Frustum* frustum = nullptr;
             if (light) {
                 switch (light->getType()) {
                     case scene::LightType::SPOT:
-                        sceneCulling(
-                            skyboxModelToSkip,
-                            *scene, camera,
-                            dynamic_cast<const scene::SpotLight*>(light)->getFrustum(),
-                            bCastShadow,
-                            models);
+                        frustum = &dynamic_cast<const scene::SpotLight*>(light)->getFrustum();
                         break;
                     case scene::LightType::DIRECTIONAL: {
                         auto& csmLayers = *pplSceneData.getCSMLayers();
                         const auto* mainLight = dynamic_cast<const scene::DirectionalLight*>(light);
                         const auto& csmLevel = mainLight->getCSMLevel();
-                        const geometry::Frustum* frustum = nullptr;
                         const auto& shadows = *pplSceneData.getShadows();
                         if (shadows.getType() == scene::ShadowType::PLANAR) {
                             frustum = &camera.getFrustum();
@@ -269,32 +414,130 @@ void SceneCulling::batchCulling(const pipeline::PipelineSceneData& pplSceneData)
                                 csmLayers.update(&pplSceneData, &camera);
                             }
                             // const
+                            const geometry::Frustum* layerFrustum = nullptr;
                             if (mainLight->isShadowFixedArea() || csmLevel == scene::CSMLevel::LEVEL_1) {
-                                frustum = &csmLayers.getSpecialLayer()->getValidFrustum();
+                                layerFrustum = &csmLayers.getSpecialLayer()->getValidFrustum();
                             } else {
-                                frustum = &csmLayers.getLayers()[level]->getValidFrustum();
+                                layerFrustum = &csmLayers.getLayers()[level]->getValidFrustum();
                             }
+                            if (numCsmFrustums < csmFrustums.size()) {
+                                csmFrustums[numCsmFrustums] = *layerFrustum;
+                            } else {
+                                csmFrustums.emplace_back(*layerFrustum);
+                            }
+                            frustum = &csmFrustums[numCsmFrustums++];
+                        }
+                    } break;
+                    case scene::LightType::SPHERE:
+                    case scene::LightType::POINT:
+                    case scene::LightType::RANGED_DIRECTIONAL: {
+                        // bounds are resolved here, ranged directional lights update their node
+                        CullingTask task{scene, &camera, &camera.getFrustum(), bCastShadow, sourceID, light};
+                        if (pipeline::LightBinning::getLightBounds(*light, task.lightBounds)) {
+                            cullingTasks.emplace_back(task);
                         }
-                        sceneCulling(
-                            skyboxModelToSkip,
-                            *scene, camera,
-                            *frustum,
-                            bCastShadow,
-                            models);
                     } break;
                     default:
                         // noop
                         break;
                 }
             } else {
+                frustum = &camera.getFrustum();
+            }
+            if (frustum) {
+                cullingTasks.emplace_back(CullingTask{scene, &camera, frustum, bCastShadow, sourceID});
+            }
+        }
+    }
+
+    // Queries of the same camera on an octree scene, e.g. CSM levels, traverse the octree once.
+    std::stable_sort(
+        cullingTasks.begin(), cullingTasks.end(),
+        [](const CullingTask& lhs, const CullingTask& rhs) {
+            const bool lhsLight = lhs.light != nullptr;
+            const bool rhsLight = rhs.light != nullptr;
+            return std::forward_as_tuple(lhs.scene, lhs.camera, lhs.bCastShadow, lhsLight) <
+                   std::forward_as_tuple(rhs.scene, rhs.camera, rhs.bCastShadow, rhsLight);
+        });
+    const auto taskCount = static_cast<uint32_t>(cullingTasks.size());
+    cullingGroups.clear();
+    for (uint32_t taskID = 0; taskID != taskCount;) {
+        const auto& task = cullingTasks[taskID];
+        const auto* const octree = task.scene->getOctree();
+        uint32_t endID = taskID + 1;
+        if (octree && octree->isEnabled()) {
+            while (endID != taskCount &&
+                   endID - taskID < scene::OCTREE_MAX_QUERY_FRUSTUMS &&
+                   canShareTraversal(task, cullingTasks[endID])) {
+                ++endID;
+            }
+        }
+        cullingGroups.emplace_back(CullingGroup{taskID, endID - taskID});
+        taskID = endID;
+    }
+
+    // Parallel phase: every task writes its own culledResults[sourceID].
+    const auto groupCount = static_cast<uint32_t>(cullingGroups.size());
+    const uint32_t jobThreadCount = JobSystem::getInstance()->threadCount();
+    const uint32_t workerCount = std::max(1U, std::min(jobThreadCount + 1, groupCount));
+    if (cullingScratches.size() < workerCount) {
+        cullingScratches.resize(workerCount);
+    }
+
+    // Groups differ a lot in cost, workers pull them one at a time.
+    std::atomic<uint32_t> nextGroupID{0};
+    auto cullingWorker = [&](uint32_t workerID) {
+        auto& scratch = cullingScratches[workerID];
+        for (auto groupID = nextGroupID.fetch_add(1, std::memory_order_relaxed);
+             groupID < groupCount;
+             groupID = nextGroupID.fetch_add(1, std::memory_order_relaxed)) {
+            const auto& group = cullingGroups[groupID];
+            const auto& task = cullingTasks[group.firstTask];
+            if (task.light) {
+                lightVolumeCulling(
+                    skyboxModelToSkip,
+                    *task.scene, *task.camera,
+                    *task.frustum,
+                    task.bCastShadow,
+                    *task.light, task.lightBounds,
+                    scratch,
+                    culledResults[task.sourceID]);
+                continue;
+            }
+            if (group.taskCount == 1) {
                 sceneCulling(
                     skyboxModelToSkip,
-                    *scene, camera,
-                    camera.getFrustum(),
-                    bCastShadow,
-                    models);
+                    *task.scene, *task.camera,
+                    *task.frustum,
+                    task.bCastShadow,
+                    scratch,
+                    culledResults[task.sourceID]);
+                continue;
+            }
+            scratch.frustums.clear();
+            scratch.results.clear();
+            for (uint32_t i = 0; i != group.taskCount; ++i) {
+                const auto& groupTask = cullingTasks[group.firstTask + i];
+                scratch.frustums.emplace_back(groupTask.frustum);
+                scratch.results.emplace_back(&culledResults[groupTask.sourceID]);
             }
+            octreeCulling(
+                *task.scene->getOctree(), skyboxModelToSkip,
+                *task.scene, *task.camera,
+                scratch.frustums.data(), group.taskCount,
+                task.bCastShadow,
+                scratch.results.data());
         }
+    };
+
+    if (workerCount > 1) {
+        JobGraph g(JobSystem::getInstance());
+        g.createForEachIndexJob(1U, workerCount, 1U, cullingWorker);
+        g.run();
+        cullingWorker(0);
+        g.waitForAll();
+    } else {
+        cullingWorker(0);
     }
 }
 
@@ -23,9 +23,11 @@
 ****************************************************************************/
 
 #pragma once
+#include "cocos/base/std/container/vector.h"
 #include "cocos/core/ArrayBuffer.h"
 #include "cocos/math/Vec4.h"
 #include "cocos/renderer/pipeline/custom/LayoutGraphFwd.h"
+#include "cocos/renderer/pipeline/custom/NativePipelineFwd.h"
 #include "cocos/renderer/pipeline/custom/RenderGraphFwd.h"
 #include "cocos/renderer/pipeline/custom/RenderInterfaceFwd.h"
 
@@ -75,6 +77,26 @@ void setReadWriteTextureImpl(RenderData &data, const LayoutGraphData &lg, const
 
 void setSamplerImpl(RenderData &data, const LayoutGraphData &lg, const ccstd::string &name, gfx::Sampler *sampler);
 
+// pipeline states of the instances in [first, first + count), render thread only
+void resolvePipelineStates(
+    const RenderDrawQueue &queue, gfx::RenderPass *renderPass, uint32_t subpassIndex, uint32_t first, uint32_t count,
+    ccstd::pmr::vector<gfx::PipelineState *> &pipelineStates);
+
+// records the instances with the resolved pipeline states, safe on worker threads
+void recordResolvedCommandBuffer(
+    const RenderDrawQueue &queue, gfx::CommandBuffer *cmdBuff, gfx::PipelineState *const *pipelineStates,
+    uint32_t first, uint32_t count);
+
+// pipeline states of the batches in [firstBatch, firstBatch + batchCount), render thread only
+void resolvePipelineStates(
+    const RenderInstancingQueue &queue, gfx::RenderPass *renderPass, uint32_t firstBatch, uint32_t batchCount,
+    ccstd::pmr::vector<gfx::PipelineState *> &pipelineStates);
+
+// records the batches with the resolved pipeline states, safe on worker threads
+void recordResolvedCommandBuffer(
+    const RenderInstancingQueue &queue, gfx::CommandBuffer *cmdBuffer, gfx::PipelineState *const *pipelineStates,
+    uint32_t firstBatch, uint32_t batchCount);
+
 } // namespace render
 
 } // namespace cc
@@ -81,7 +81,7 @@ void PostProcessStage::activate(RenderPipeline *pipeline, RenderFlow *flow) {
             phase |= getPhaseID(stage);
         }
 
-        std::function<int(const RenderPass &, const RenderPass &)> sortFunc = opaqueCompareFn;
+        RenderQueueSortFunc sortFunc = opaqueCompareFn;
         switch (descriptor->sortMode) {
             case RenderQueueSortMode::BACK_TO_FRONT:
                 sortFunc = transparentCompareFn;
@@ -178,12 +178,42 @@ void Model::updateUBOs(uint32_t stamp) {
 
     updateSHUBOs();
 
+    if (updateLocalUBOData()) {
+        flushLocalUBOData();
+    }
+}
+
+void Model::prepareParallelUpdate(uint32_t stamp) {
+    CC_ASSERT(isParallelUpdateSupported());
+    updateTransform(stamp);
+    _updateStamp = stamp;
+    _pendingSHUpload = updateSHData();
+    _pendingLocalUpload = updateLocalUBOData();
+}
+
+void Model::commitParallelUpdate() {
+    CC_PROFILE(ModelCommitParallelUpdate);
+    for (SubModel *subModel : _subModels) {
+        subModel->update();
+    }
+    if (_pendingSHUpload) {
+        _pendingSHUpload = false;
+        updateSHBuffer();
+    }
+    if (_pendingLocalUpload) {
+        _pendingLocalUpload = false;
+        flushLocalUBOData();
+    }
+    updateOctree();
+}
+
+bool Model::updateLocalUBOData() {
     const auto *pipeline = Root::getInstance()->getPipeline();
     const auto *shadowInfo = pipeline->getPipelineSceneData()->getShadows();
     const auto forceUpdateUBO = shadowInfo->isEnabled() && shadowInfo->getType() == ShadowType::PLANAR;
 
     if (!_localDataUpdated) {
-        return;
+        return false;
     }
     _localDataUpdated = false;
     getTransform()->updateWorldTransform();
@@ -241,11 +271,16 @@ void Model::updateUBOs(uint32_t stamp) {
             }
         }
 
-        _localBuffer->update();
-        const bool enableOcclusionQuery = Root::getInstance()->getPipeline()->isOcclusionQueryEnabled();
-        if (enableOcclusionQuery) {
-            updateWorldBoundUBOs();
-        }
+        return true;
+    }
+    return false;
+}
+
+void Model::flushLocalUBOData() {
+    _localBuffer->update();
+    const bool enableOcclusionQuery = Root::getInstance()->getPipeline()->isOcclusionQueryEnabled();
+    if (enableOcclusionQuery) {
+        updateWorldBoundUBOs();
     }
 }
 
@@ -414,17 +449,29 @@ void Model::clearSHUBOs() {
 }
 
 void Model::updateSHUBOs() {
+    if (updateSHData()) {
+        updateSHBuffer();
+    }
+}
+
+bool Model::isSHUpdateRequired() const {
     if (!isLightProbeAvailable()) {
-        return;
+        return false;
     }
 
-    const auto center = _worldBounds->getCenter();
 #if !CC_EDITOR
-    if (center.approxEquals(_lastWorldBoundCenter, math::EPSILON)) {
-        return;
-    }
+    return !_worldBounds->getCenter().approxEquals(_lastWorldBoundCenter, math::EPSILON);
+#else
+    return true;
 #endif
+}
 
+bool Model::updateSHData() {
+    if (!isSHUpdateRequired()) {
+        return false;
+    }
+
+    const auto center = _worldBounds->getCenter();
     ccstd::vector<Vec3> coefficients;
     Vec4 weights(0.0F, 0.0F, 0.0F, 0.0F);
     const auto *pipeline = Root::getInstance()->getPipeline();
@@ -434,16 +481,29 @@ void Model::updateSHUBOs() {
     _tetrahedronIndex = lightProbes->getData()->getInterpolationWeights(center, _tetrahedronIndex, weights);
     bool result = lightProbes->getData()->getInterpolationSHCoefficients(_tetrahedronIndex, weights, coefficients);
     if (!result) {
-        return;
+        return false;
     }
 
+    return fillSHData(coefficients);
+}
+
+void Model::applySHCoefficients(int32_t tetIndex, ccstd::vector<Vec3> &coefficients) {
+    _lastWorldBoundCenter.set(_worldBounds->getCenter());
+    _tetrahedronIndex = tetIndex;
+    if (fillSHData(coefficients)) {
+        updateSHBuffer();
+    }
+}
+
+bool Model::fillSHData(ccstd::vector<Vec3> &coefficients) {
     if (_localSHData.empty()) {
-        return;
+        return false;
     }
 
+    const auto *lightProbes = Root::getInstance()->getPipeline()->getPipelineSceneData()->getLightProbes();
     gi::SH::reduceRinging(coefficients, lightProbes->getReduceRinging());
     gi::SH::updateUBOData(_localSHData, pipeline::UBOSH::SH_LINEAR_CONST_R_OFFSET, coefficients);
-    updateSHBuffer();
+    return true;
 }
 
 ccstd::vector<IMacroPatch> Model::getMacroPatches(index_t subModelIndex) {
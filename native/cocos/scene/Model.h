@@ -142,6 +142,16 @@ public:
     void updateLightingmap(Texture2D *texture, const Vec4 &uvParam);
     void clearSHUBOs();
     void updateSHUBOs();
+    /**
+     * @en Whether the light probe data needs to be interpolated again, i.e. the world bounds moved.
+     * @zh 是否需要重新插值光照探针数据，即世界包围盒是否移动。
+     */
+    bool isSHUpdateRequired() const;
+    /**
+     * @en Apply light probe SH coefficients interpolated in batch, see gi::LightProbesData::getInterpolationSHCoefficients.
+     * @zh 应用批量插值得到的光照探针球谐系数，参见 gi::LightProbesData::getInterpolationSHCoefficients。
+     */
+    void applySHCoefficients(int32_t tetIndex, ccstd::vector<Vec3> &coefficients);
     void updateOctree();
     void updateWorldBoundUBOs();
     void updateLocalShadowBias();
@@ -151,6 +161,19 @@ public:
     void updateReflectionProbeDataMap(Texture2D *texture);
     void updateReflectionProbeBlendCubemap(TextureCube *texture);
 
+    /**
+     * @en Split version of updateTransform + updateUBOs used by the parallel scene update.
+     * prepareParallelUpdate only touches CPU side data of this model and may run on a worker thread,
+     * commitParallelUpdate submits the prepared data to the GPU and must run on the main thread.
+     * Skinning models fill their joint palette in prepareParallelUpdate, joint world matrices are shared between threads.
+     * @zh updateTransform + updateUBOs 的拆分版本，用于场景并行更新。
+     * prepareParallelUpdate 只修改模型自身的 CPU 数据，可以在工作线程执行；commitParallelUpdate 提交 GPU 数据，必须在主线程执行。
+     * 蒙皮模型在 prepareParallelUpdate 中填充骨骼矩阵，关节世界矩阵在线程间共享。
+     */
+    void prepareParallelUpdate(uint32_t stamp);
+    virtual void commitParallelUpdate();
+    inline bool isParallelUpdateSupported() const { return _type == Type::DEFAULT || _type == Type::SKINNING; }
+
     inline void attachToScene(RenderScene *scene) {
         _scene = scene;
         _localDataUpdated = true;
@@ -177,6 +200,7 @@ public:
         _worldBoundsDirty = true;
     }
     inline void setOctreeNode(OctreeNode *node) { _octreeNode = node; }
+    inline void setSpatialProxy(uint32_t proxy) { _spatialProxy = proxy; }
     inline void setScene(RenderScene *scene) {
         _scene = scene;
         if (scene) _localDataUpdated = true;
@@ -227,6 +251,7 @@ public:
     inline Type getType() const { return _type; };
     inline void setType(Type type) { _type = type; }
     inline OctreeNode *getOctreeNode() const { return _octreeNode; }
+    inline uint32_t getSpatialProxy() const { return _spatialProxy; }
     inline RenderScene *getScene() const { return _scene; }
     inline void setDynamicBatching(bool val) { _isDynamicBatching = val; }
     inline bool isDynamicBatching() const { return _isDynamicBatching; }
@@ -257,7 +282,11 @@ protected:
 
     void updateAttributesAndBinding(index_t subModelIndex);
     bool isLightProbeAvailable() const;
+    bool updateSHData();
+    bool fillSHData(ccstd::vector<Vec3> &coefficients);
     void updateSHBuffer();
+    bool updateLocalUBOData();
+    void flushLocalUBOData();
 
     // Please declare variables in descending order of memory size occupied by variables.
     Type _type{Type::DEFAULT};
@@ -273,6 +302,8 @@ protected:
     float _reflectionProbeBlendWeight{0.F};
 
     OctreeNode *_octreeNode{nullptr};
+    // proxy in the spatial query tree of the scene, see RenderScene::queryModels
+    uint32_t _spatialProxy{0xFFFFFFFF};
     RenderScene *_scene{nullptr};
     gfx::Device *_device{nullptr};
 
@@ -295,6 +326,8 @@ protected:
     bool _useLightProbe = false;
     bool _bakeToReflectionProbe{true};
     bool _receiveDirLight{true};
+    bool _pendingSHUpload{false};
+    bool _pendingLocalUpload{false};
     // For JS
     bool _isCalledFromJS{false};
 
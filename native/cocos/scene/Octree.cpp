@@ -25,6 +25,7 @@
 #include "Octree.h"
 #include <future>
 #include <utility>
+#include "core/geometry/FrustumCulling.h"
 #include "scene/Camera.h"
 #include "scene/Model.h"
 
@@ -83,6 +84,27 @@ void OctreeInfo::activate(Octree *resource) {
     --------
  **/
 
+struct OctreeQuery {
+    uint32_t visibility{0};
+    bool isShadow{false};
+    uint32_t frustumCount{0};
+    ccstd::array<geometry::FrustumPlanes, OCTREE_MAX_QUERY_FRUSTUMS> planes;
+};
+
+namespace {
+
+BBox getLooseBox(const BBox &box) {
+    const cc::Vec3 center = box.getCenter();
+    const cc::Vec3 halfExtents = (box.max - box.min) * (0.5F * OCTREE_LOOSE_FACTOR);
+    return {center - halfExtents, center + halfExtents};
+}
+
+uint32_t getFrustumMask(uint32_t frustumCount) {
+    return frustumCount == OCTREE_MAX_QUERY_FRUSTUMS ? 0xFFFFFFFF : (1U << frustumCount) - 1;
+}
+
+} // namespace
+
 /**
  * OctreeNode class
  */
@@ -96,6 +118,11 @@ OctreeNode::~OctreeNode() {
     }
 }
 
+void OctreeNode::setBox(const BBox &aabb) {
+    _aabb = aabb;
+    _cullingBox = _owner->isLooseEnabled() ? getLooseBox(aabb) : aabb;
+}
+
 BBox OctreeNode::getChildBox(uint32_t index) const {
     cc::Vec3 min = _aabb.min;
     cc::Vec3 max = _aabb.max;
@@ -125,7 +152,7 @@ BBox OctreeNode::getChildBox(uint32_t index) const {
 OctreeNode *OctreeNode::getOrCreateChild(uint32_t index) {
     if (!_children[index]) {
         BBox childBox = getChildBox(index);
-        auto *child = _children[index] = ccnew OctreeNode(_owner, this);
+        auto *child = _children[index] = _owner->createNode(this);
         child->setBox(childBox);
         child->setDepth(_depth + 1);
         child->setIndex(index);
@@ -136,7 +163,7 @@ OctreeNode *OctreeNode::getOrCreateChild(uint32_t index) {
 
 void OctreeNode::deleteChild(uint32_t index) {
     if (_children[index]) {
-        delete _children[index];
+        _owner->destroyNode(_children[index]);
         _children[index] = nullptr;
     }
 }
@@ -153,6 +180,9 @@ void OctreeNode::insert(Model *model) { // NOLINT(misc-no-recursion)
         index += modelCenter.z < nodeCenter.z ? 0 : 4;
 
         BBox childBox = getChildBox(index);
+        if (_owner->isLooseEnabled()) {
+            childBox = getLooseBox(childBox);
+        }
         if (childBox.contain(modelBox)) {
             split = true;
 
@@ -221,8 +251,28 @@ void OctreeNode::gatherModels(ccstd::vector<Model *> &results) const { // NOLINT
     }
 }
 
-void OctreeNode::doQueryVisibility(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const {
-    const auto visibility = camera->getVisibility();
+bool OctreeNode::testFrustums(const OctreeQuery &query, uint32_t &intersectMask, uint32_t &insideMask) const {
+    const cc::Vec3 center = _cullingBox.getCenter();
+    const cc::Vec3 halfExtents = (_cullingBox.max - _cullingBox.min) * 0.5F;
+    for (uint32_t i = 0; i < query.frustumCount; i++) {
+        const uint32_t bit = 1U << i;
+        if (!(intersectMask & bit)) {
+            continue;
+        }
+        const int result = query.planes[i].testBox(center, halfExtents);
+        if (result != 1) {
+            // completely outside or inside, no need to test children against this frustum
+            intersectMask &= ~bit;
+            if (result == 0) {
+                insideMask |= bit;
+            }
+        }
+    }
+    return (intersectMask | insideMask) != 0;
+}
+
+void OctreeNode::doQueryVisibility(const OctreeQuery &query, uint32_t intersectMask, uint32_t insideMask, ccstd::vector<const Model *> *const *results) const {
+    const auto visibility = query.visibility;
     for (auto *model : _models) {
         if (!model->isEnabled()) {
             continue;
@@ -235,61 +285,70 @@ void OctreeNode::doQueryVisibility(const Camera *camera, const geometry::Frustum
             if (!modelWorldBounds) {
                 continue;
             }
+            if (query.isShadow && !model->isCastShadow()) {
+                continue;
+            }
 
-            if (isShadow) {
-                if (model->isCastShadow() && modelWorldBounds->aabbFrustum(frustum)) {
-                    results.push_back(model);
-                }
-            } else {
-                if (modelWorldBounds->aabbFrustum(frustum)) {
-                    results.push_back(model);
+            for (uint32_t i = 0; i < query.frustumCount; i++) {
+                const uint32_t bit = 1U << i;
+                if (insideMask & bit) {
+                    // the node is inside the frustum, so is the model
+                    results[i]->push_back(model);
+                } else if ((intersectMask & bit) &&
+                           query.planes[i].testBox(modelWorldBounds->getCenter(), modelWorldBounds->getHalfExtents()) != -1) {
+                    results[i]->push_back(model);
                 }
             }
         }
     }
 }
 
-void OctreeNode::queryVisibilityParallelly(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const {
-    geometry::AABB box;
-    geometry::AABB::fromPoints(_aabb.min, _aabb.max, &box);
-    if (!box.aabbFrustum(frustum)) {
+void OctreeNode::queryVisibilityParallelly(const OctreeQuery &query, ccstd::vector<const Model *> *const *results) const {
+    uint32_t intersectMask = getFrustumMask(query.frustumCount);
+    uint32_t insideMask = 0;
+    if (!testFrustums(query, intersectMask, insideMask)) {
         return;
     }
 
-    ccstd::array<std::future<ccstd::vector<const Model *>>, OCTREE_CHILDREN_NUM> futures{};
+    using ChildResults = ccstd::vector<ccstd::vector<const Model *>>;
+    ccstd::array<std::future<ChildResults>, OCTREE_CHILDREN_NUM> futures{};
     for (auto i = 0; i < OCTREE_CHILDREN_NUM; i++) {
         if (_children[i]) {
-            futures[i] = std::async(std::launch::async, [=, &frustum] {
-                ccstd::vector<const Model *> models;
-                _children[i]->queryVisibilitySequentially(camera, frustum, isShadow, models);
+            futures[i] = std::async(std::launch::async, [=, &query] {
+                ChildResults models(query.frustumCount);
+                ccstd::array<ccstd::vector<const Model *> *, OCTREE_MAX_QUERY_FRUSTUMS> childResults{};
+                for (uint32_t j = 0; j < query.frustumCount; j++) {
+                    childResults[j] = &models[j];
+                }
+                _children[i]->queryVisibilitySequentially(query, intersectMask, insideMask, childResults.data());
                 return models;
             });
         }
     }
 
-    doQueryVisibility(camera, frustum, isShadow, results);
+    doQueryVisibility(query, intersectMask, insideMask, results);
 
     for (auto i = 0; i < OCTREE_CHILDREN_NUM; i++) {
         if (_children[i]) {
             auto models = futures[i].get();
-            results.insert(results.end(), models.begin(), models.end());
+            for (uint32_t j = 0; j < query.frustumCount; j++) {
+                results[j]->insert(results[j]->end(), models[j].begin(), models[j].end());
+            }
         }
     }
 }
 
-void OctreeNode::queryVisibilitySequentially(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const { // NOLINT(misc-no-recursion)
-    geometry::AABB box;
-    geometry::AABB::fromPoints(_aabb.min, _aabb.max, &box);
-    if (!box.aabbFrustum(frustum)) {
+void OctreeNode::queryVisibilitySequentially(const OctreeQuery &query, uint32_t intersectMask, uint32_t insideMask, ccstd::vector<const Model *> *const *results) const { // NOLINT(misc-no-recursion)
+    if (!testFrustums(query, intersectMask, insideMask)) {
         return;
     }
 
-    doQueryVisibility(camera, frustum, isShadow, results);
+    doQueryVisibility(query, intersectMask, insideMask, results);
 
     // query recursively.
     for (auto *child : _children) {
         if (child) {
-            child->queryVisibilitySequentially(camera, frustum, isShadow, results);
+            child->queryVisibilitySequentially(query, intersectMask, insideMask, results);
         }
     }
 }
@@ -298,11 +357,34 @@ void OctreeNode::queryVisibilitySequentially(const Camera *camera, const geometr
  * Octree class
  */
 Octree::Octree() {
-    _root = ccnew OctreeNode(this, nullptr);
+    _root = createNode(nullptr);
 }
 
 Octree::~Octree() {
-    delete _root;
+    destroyNode(_root);
+    for (auto *block : _nodeBlocks) {
+        CC_FREE(block);
+    }
+}
+
+OctreeNode *Octree::createNode(OctreeNode *parent) {
+    OctreeNode *storage = nullptr;
+    if (!_freeNodes.empty()) {
+        storage = _freeNodes.back();
+        _freeNodes.pop_back();
+    } else {
+        if (_nodeBlockUsed == OCTREE_NODE_POOL_BLOCK_SIZE) {
+            _nodeBlocks.emplace_back(static_cast<OctreeNode *>(CC_MALLOC(sizeof(OctreeNode) * OCTREE_NODE_POOL_BLOCK_SIZE)));
+            _nodeBlockUsed = 0;
+        }
+        storage = _nodeBlocks.back() + _nodeBlockUsed++;
+    }
+    return ccnew_placement(storage) OctreeNode(this, parent);
+}
+
+void Octree::destroyNode(OctreeNode *node) {
+    node->~OctreeNode();
+    _freeNodes.push_back(node);
 }
 
 void Octree::initialize(const OctreeInfo &info) {
@@ -342,17 +424,29 @@ void Octree::resize(const Vec3 &minPos, const Vec3 &maxPos, uint32_t maxDepth) {
         return;
     }
 
+    _maxDepth = std::max(maxDepth, 1U);
+    rebuild(BBox{minPos - expand, maxPos});
+}
+
+void Octree::setLooseEnabled(bool val) {
+    if (_looseEnabled == val) {
+        return;
+    }
+    _looseEnabled = val;
+    rebuild(_root->getBox());
+}
+
+void Octree::rebuild(BBox rootBox) {
     ccstd::vector<Model *> models;
     _root->gatherModels(models);
 
-    delete _root;
-    _root = ccnew OctreeNode(this, nullptr);
-    _root->setBox(BBox{minPos - expand, maxPos});
+    destroyNode(_root);
+    _root = createNode(nullptr);
+    _root->setBox(rootBox);
     _root->setDepth(0);
     _root->setIndex(0);
 
-    _maxDepth = std::max(maxDepth, 1U);
-
+    _totalCount = 0;
     for (auto *model : models) {
         model->setOctreeNode(nullptr);
         insert(model);
@@ -390,14 +484,41 @@ void Octree::remove(Model *model) {
 }
 
 void Octree::update(Model *model) {
+    // a loose cell tolerates movement, keep the model until it leaves the enlarged box
+    if (_looseEnabled) {
+        const OctreeNode *node = model->getOctreeNode();
+        const geometry::AABB *worldBounds = model->getWorldBounds();
+        if (node && worldBounds && node->getCullingBox().contain(BBox(*worldBounds))) {
+            return;
+        }
+    }
     insert(model);
 }
 
 void Octree::queryVisibility(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const {
+    const geometry::Frustum *frustums[] = {&frustum};
+    ccstd::vector<const Model *> *const resultLists[] = {&results};
+    queryVisibility(camera, frustums, 1, isShadow, resultLists);
+}
+
+void Octree::queryVisibility(const Camera *camera, const geometry::Frustum *const *frustums, uint32_t frustumCount, bool isShadow, ccstd::vector<const Model *> *const *results) const {
+    CC_ASSERT(frustumCount <= OCTREE_MAX_QUERY_FRUSTUMS);
+    if (!frustumCount) {
+        return;
+    }
+
+    OctreeQuery query;
+    query.visibility = camera->getVisibility();
+    query.isShadow = isShadow;
+    query.frustumCount = frustumCount;
+    for (uint32_t i = 0; i < frustumCount; i++) {
+        query.planes[i].set(*frustums[i]);
+    }
+
     if (_totalCount > USE_MULTI_THRESHOLD) {
-        _root->queryVisibilityParallelly(camera, frustum, isShadow, results);
+        _root->queryVisibilityParallelly(query, results);
     } else {
-        _root->queryVisibilitySequentially(camera, frustum, isShadow, results);
+        _root->queryVisibilitySequentially(query, getFrustumMask(frustumCount), 0, results);
     }
 }
 
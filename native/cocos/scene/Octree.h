@@ -27,6 +27,7 @@
 #include "base/Macros.h"
 #include "base/RefCounted.h"
 #include "base/std/container/array.h"
+#include "base/std/container/vector.h"
 #include "core/geometry/AABB.h"
 #include "math/Vec3.h"
 
@@ -36,6 +37,7 @@ namespace scene {
 class Camera;
 class Model;
 class Octree;
+struct OctreeQuery;
 
 constexpr int OCTREE_CHILDREN_NUM = 8;
 constexpr int DEFAULT_OCTREE_DEPTH = 8;
@@ -43,6 +45,9 @@ const Vec3 DEFAULT_WORLD_MIN_POS = {-1024.0F, -1024.0F, -1024.0F};
 const Vec3 DEFAULT_WORLD_MAX_POS = {1024.0F, 1024.0F, 1024.0F};
 const float OCTREE_BOX_EXPAND_SIZE = 10.0F;
 constexpr int USE_MULTI_THRESHOLD = 1024; // use parallel culling if greater than this value
+constexpr float OCTREE_LOOSE_FACTOR = 2.0F;  // size of a loose cell relative to its tight box
+constexpr uint32_t OCTREE_NODE_POOL_BLOCK_SIZE = 256;
+constexpr uint32_t OCTREE_MAX_QUERY_FRUSTUMS = 32;
 
 class CC_DLL OctreeInfo final : public RefCounted {
 public:
@@ -137,12 +142,14 @@ private:
     OctreeNode(Octree *owner, OctreeNode *parent);
     ~OctreeNode();
 
-    inline void setBox(const BBox &aabb) { _aabb = aabb; }
+    void setBox(const BBox &aabb);
     inline void setDepth(uint32_t depth) { _depth = depth; }
     inline void setIndex(uint32_t index) { _index = index; }
 
     inline Octree *getOwner() const { return _owner; }
     inline const BBox &getBox() const { return _aabb; }
+    // the box models are contained in, enlarged when the owner is loose
+    inline const BBox &getCullingBox() const { return _cullingBox; }
     BBox getChildBox(uint32_t index) const;
     OctreeNode *getOrCreateChild(uint32_t index);
     void deleteChild(uint32_t index);
@@ -151,15 +158,18 @@ private:
     void remove(Model *model);
     void onRemoved();
     void gatherModels(ccstd::vector<Model *> &results) const;
-    void doQueryVisibility(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const;
-    void queryVisibilityParallelly(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const;
-    void queryVisibilitySequentially(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const;
+    // intersectMask: frustums the node intersects, insideMask: frustums that contain the node
+    void doQueryVisibility(const OctreeQuery &query, uint32_t intersectMask, uint32_t insideMask, ccstd::vector<const Model *> *const *results) const;
+    bool testFrustums(const OctreeQuery &query, uint32_t &intersectMask, uint32_t &insideMask) const;
+    void queryVisibilityParallelly(const OctreeQuery &query, ccstd::vector<const Model *> *const *results) const;
+    void queryVisibilitySequentially(const OctreeQuery &query, uint32_t intersectMask, uint32_t insideMask, ccstd::vector<const Model *> *const *results) const;
 
     Octree *_owner{nullptr};
     OctreeNode *_parent{nullptr};
     ccstd::array<OctreeNode *, OCTREE_CHILDREN_NUM> _children{};
     ccstd::vector<Model *> _models;
     BBox _aabb{};
+    BBox _cullingBox{};
     uint32_t _depth{0};
     uint32_t _index{0};
 
@@ -217,20 +227,51 @@ public:
     // return octree depth
     inline uint32_t getMaxDepth() const { return _maxDepth; }
 
+    /**
+     * @en
+     * Whether to use loose cells, enlarged by OCTREE_LOOSE_FACTOR. A moving model is only
+     * reinserted when it leaves its enlarged cell. Changing it rebuilds the tree.
+     * @zh
+     * 是否使用松散八叉树，节点按 OCTREE_LOOSE_FACTOR 放大。移动的模型只有离开放大后的节点时才会重新插入。
+     * 修改此值会重建八叉树。
+     */
+    void setLooseEnabled(bool val);
+    inline bool isLooseEnabled() const { return _looseEnabled; }
+
     // view frustum culling
     void queryVisibility(const Camera *camera, const geometry::Frustum &frustum, bool isShadow, ccstd::vector<const Model *> &results) const;
 
+    /**
+     * @en
+     * View frustum culling against several frustums in one traversal, e.g. the levels of cascaded shadow maps.
+     * Results of frustums[i] are appended to results[i]. At most OCTREE_MAX_QUERY_FRUSTUMS frustums.
+     * @zh
+     * 在一次遍历中对多个视锥进行剔除，例如级联阴影的各个层级。frustums[i] 的结果追加到 results[i]，最多 OCTREE_MAX_QUERY_FRUSTUMS 个视锥。
+     */
+    void queryVisibility(const Camera *camera, const geometry::Frustum *const *frustums, uint32_t frustumCount, bool isShadow, ccstd::vector<const Model *> *const *results) const;
+
 private:
     bool isInside(Model *model) const;
     bool isOutside(Model *model) const;
+    void rebuild(BBox rootBox); // by value, the old root is released before the new one is set up
+
+    OctreeNode *createNode(OctreeNode *parent);
+    void destroyNode(OctreeNode *node);
 
     OctreeNode *_root{nullptr};
+    // nodes are allocated in blocks of OCTREE_NODE_POOL_BLOCK_SIZE, released nodes are reused
+    ccstd::vector<OctreeNode *> _nodeBlocks;
+    ccstd::vector<OctreeNode *> _freeNodes;
+    uint32_t _nodeBlockUsed{OCTREE_NODE_POOL_BLOCK_SIZE};
+    bool _looseEnabled{false};
     uint32_t _maxDepth{DEFAULT_OCTREE_DEPTH};
     uint32_t _totalCount{0};
 
     bool _enabled{false};
     Vec3 _minPos;
     Vec3 _maxPos;
+
+    friend class OctreeNode;
 };
 
 } // namespace scene
@@ -39,6 +39,7 @@
 #include "renderer/gfx-base/states/GFXSampler.h"
 #include "renderer/pipeline/Define.h"
 #include "renderer/pipeline/InstancedBuffer.h"
+#include "renderer/pipeline/PipelineStateManager.h"
 #include "scene/Define.h"
 
 namespace cc {
@@ -145,8 +146,8 @@ ccstd::hash_t Pass::getPassHash(Pass *pass) {
         ccstd::hash_combine(hashValue, pass->_phaseID);
         ccstd::hash_range(hashValue, shaderKey.begin(), shaderKey.end());
     } else {
-        const ccstd::string &shaderKey = ProgramLib::getInstance()->getKey(pass->getProgram(), pass->getDefines());
-        ccstd::hash_range(hashValue, shaderKey.begin(), shaderKey.end());
+        const auto shaderKey = ProgramLib::getInstance()->getVariantKey(pass->getProgram(), pass->getDefines(), {}, pass->_root->getPipeline());
+        ccstd::hash_combine(hashValue, shaderKey);
     }
 
     return hashValue;
@@ -467,6 +468,7 @@ bool Pass::tryCompile() {
     }
 
     _hash = Pass::getPassHash(this);
+    pipeline::PipelineStateManager::prewarm(this, _shader);
     return true;
 }
 
@@ -494,27 +496,27 @@ gfx::Shader *Pass::getShaderVariant(const ccstd::vector<IMacroPatch> &patches) {
 #endif
 
     auto *pipeline = _root->getPipeline();
-    for (const auto &patch : patches) {
-        _defines[patch.name] = patch.value;
-    }
-
     gfx::Shader *shader = nullptr;
     auto *programLib = render::getProgramLibrary();
     if (programLib) {
+        for (const auto &patch : patches) {
+            _defines[patch.name] = patch.value;
+        }
         const auto *program = programLib->getProgramVariant(_device, _phaseID, _programName, _defines);
         if (program) {
             shader = program->getShader();
         }
-    } else {
-        shader = ProgramLib::getInstance()->getGFXShader(_device, _programName, _defines, pipeline);
-    }
-
-    for (const auto &patch : patches) {
-        auto iter = _defines.find(patch.name);
-        if (iter != _defines.end()) {
-            _defines.erase(iter);
+        for (const auto &patch : patches) {
+            auto iter = _defines.find(patch.name);
+            if (iter != _defines.end()) {
+                _defines.erase(iter);
+            }
         }
+    } else {
+        // the patches are looked up in place, _defines stays untouched
+        shader = ProgramLib::getInstance()->getGFXShader(_device, _programName, _defines, patches, pipeline);
     }
+    pipeline::PipelineStateManager::prewarm(this, shader);
     return shader;
 }
 
@@ -25,12 +25,17 @@
 #include "scene/RenderScene.h"
 #include "scene/Camera.h"
 
+#include <algorithm>
 #include <utility>
 #include "3d/models/BakedSkinningModel.h"
 #include "3d/models/SkinningModel.h"
 #include "base/Log.h"
+#include "base/job-system/JobChunks.h"
+#include "core/geometry/Intersect.h"
 #include "core/Root.h"
 #include "core/scene-graph/Node.h"
+#include "gi/light-probe/LightProbe.h"
+#include "gi/light-probe/SH.h"
 #include "profiler/Profiler.h"
 #include "renderer/pipeline/PipelineSceneData.h"
 #include "renderer/pipeline/custom/RenderInterfaceTypes.h"
@@ -42,6 +47,8 @@
 #include "scene/Octree.h"
 #include "scene/PointLight.h"
 #include "scene/RangedDirectionalLight.h"
+#include "scene/ReflectionProbe.h"
+#include "scene/ReflectionProbeManager.h"
 #include "scene/SphereLight.h"
 #include "scene/SpotLight.h"
 #include "scene/gpu-scene/GPUScene.h"
@@ -49,6 +56,12 @@
 namespace cc {
 namespace scene {
 
+namespace {
+// Below this amount the job dispatching overhead outweighs the gain.
+constexpr uint32_t PARALLEL_UPDATE_MIN_MODELS = 256;
+constexpr uint32_t PARALLEL_UPDATE_MIN_MODELS_PER_CHUNK = 64;
+} // namespace
+
 /**
  * @zh 管理LODGroup的使用状态，包含使用层级及其上的model可见相机列表；便于判断当前model是否被LODGroup裁剪
  * @en Manage the usage status of LODGroup, including the usage level and the list of visible cameras on its models; easy to determine whether the current mod is cropped by LODGroup。
@@ -80,7 +93,11 @@ public:
 
     void updateLodState();
 
-    bool isLodModelCulled(const Camera *camera, const Model *model);
+    /**
+     * @zh 只读查询，可被多个线程同时调用，但不能与 updateLodState 等修改操作并发
+     * @en Read only query, safe for concurrent callers as long as no modification such as updateLodState runs at the same time.
+     */
+    bool isLodModelCulled(const Camera *camera, const Model *model) const;
 
     void clearCache();
 
@@ -190,13 +207,12 @@ void RenderScene::update(uint32_t stamp) {
     for (const auto &light : _rangedDirLights) {
         light->update();
     }
-    for (const auto &model : _models) {
-        if (model->isEnabled()) {
-            model->updateTransform(stamp);
-            model->updateUBOs(stamp);
-            model->updateOctree();
-        }
+    if (_parallelUpdateEnabled && _models.size() >= PARALLEL_UPDATE_MIN_MODELS) {
+        updateModelsParallel(stamp);
+    } else {
+        updateModels(stamp);
     }
+    updatePackedModelBounds();
     if (_gpuScene) {
         _gpuScene->update(stamp);
     }
@@ -209,6 +225,126 @@ void RenderScene::update(uint32_t stamp) {
     _lodStateCache->updateLodState();
 }
 
+void RenderScene::updateModels(uint32_t stamp) {
+    for (const auto &model : _models) {
+        if (model->isEnabled()) {
+            model->updateTransform(stamp);
+        }
+    }
+#if !CC_EDITOR
+    // The editor interpolates the light probes of every model each frame, keep it on the per model path.
+    updateModelsSH();
+#endif
+    for (const auto &model : _models) {
+        if (model->isEnabled()) {
+            model->updateUBOs(stamp);
+            model->updateOctree();
+        }
+    }
+}
+
+void RenderScene::updateModelsSH() {
+    const auto *pipeline = Root::getInstance()->getPipeline();
+    const auto *lightProbes = pipeline ? pipeline->getPipelineSceneData()->getLightProbes() : nullptr;
+    if (!lightProbes || lightProbes->empty() || !lightProbes->getData()->hasCoefficients()) {
+        return;
+    }
+
+    _shModels.clear();
+    _shPositions.clear();
+    _shTetIndices.clear();
+    for (const auto &model : _models) {
+        if (model->isEnabled() && model->isSHUpdateRequired()) {
+            _shModels.emplace_back(model.get());
+            _shPositions.emplace_back(model->getWorldBounds()->getCenter());
+            _shTetIndices.emplace_back(model->getTetrahedronIndex());
+        }
+    }
+    if (_shModels.empty()) {
+        return;
+    }
+
+    // Interpolate all moved models at once, updateUBOs then finds their SH data up to date.
+    const auto count = static_cast<uint32_t>(_shModels.size());
+    const auto basisCount = gi::SH::getBasisCount();
+    _shWeights.resize(count);
+    _shCoefficients.resize(count * basisCount);
+    const auto *data = lightProbes->getData();
+    data->getInterpolationWeights(_shPositions.data(), _shTetIndices.data(), _shWeights.data(), count);
+    data->getInterpolationSHCoefficients(_shTetIndices.data(), _shWeights.data(), count, _shCoefficients.data());
+
+    ccstd::vector<Vec3> coefficients(basisCount);
+    for (uint32_t i = 0; i < count; ++i) {
+        std::copy_n(_shCoefficients.begin() + i * basisCount, basisCount, coefficients.begin());
+        _shModels[i]->applySHCoefficients(_shTetIndices[i], coefficients);
+    }
+
+    CC_PROFILE_OBJECT_UPDATE(BatchedSHModels, count);
+}
+
+void RenderScene::updateModelsParallel(uint32_t stamp) {
+    CC_PROFILE(RenderSceneUpdateModelsParallel);
+
+    // Serial phase: models implemented in JS or with their own update logic go through the
+    // regular path. For the others, flush the node hierarchy so that workers never write
+    // to a node shared by several models.
+    _parallelModels.clear();
+    for (const auto &model : _models) {
+        if (!model->isEnabled()) {
+            continue;
+        }
+        if (model->isParallelUpdateSupported()) {
+            model->getTransform()->updateWorldTransform();
+            _parallelModels.emplace_back(model.get());
+        } else {
+            model->updateTransform(stamp);
+            model->updateUBOs(stamp);
+            model->updateOctree();
+        }
+    }
+    // Reflection probe nodes are read while filling the local UBO.
+    for (auto *probe : ReflectionProbeManager::getInstance()->getAllProbes()) {
+        if (probe && probe->getNode()) {
+            probe->getNode()->updateWorldTransform();
+        }
+    }
+
+    // Parallel phase: transform bounds and fill CPU side buffers, chunked across workers.
+    const auto modelCount = static_cast<uint32_t>(_parallelModels.size());
+    const uint32_t chunkCount = parallelForRange(modelCount, PARALLEL_UPDATE_MIN_MODELS_PER_CHUNK, [this, stamp](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            _parallelModels[i]->prepareParallelUpdate(stamp);
+        }
+    });
+
+    // Serial phase: GPU buffer submission and octree reinsertion.
+    for (auto *model : _parallelModels) {
+        model->commitParallelUpdate();
+    }
+
+    CC_PROFILE_OBJECT_UPDATE(ParallelUpdatedModels, modelCount);
+    CC_PROFILE_OBJECT_UPDATE(ParallelUpdateChunks, chunkCount);
+}
+
+void RenderScene::updatePackedModelBounds() {
+    // culling goes through the octree instead
+    if (_octree && _octree->isEnabled()) {
+        _packedModelBoundsValid = false;
+        return;
+    }
+    const auto modelCount = static_cast<uint32_t>(_models.size());
+    _packedModelBounds.resize(modelCount);
+    for (uint32_t i = 0; i != modelCount; ++i) {
+        const auto *worldBounds = _models[i]->getWorldBounds();
+        if (worldBounds) {
+            _packedModelBounds.set(i, *worldBounds);
+        } else {
+            _packedModelBounds.setUnbounded(i);
+        }
+    }
+    _packedModelBoundsValid = true;
+}
+
 void RenderScene::destroy() {
     removeCameras();
     removeSphereLights();
@@ -218,6 +354,7 @@ void RenderScene::destroy() {
     removeModels();
     removeGPUModels();
     _lodStateCache->clearCache();
+    _modelTree.clear();
     CC_SAFE_DESTROY_NULL(_gpuScene);
 }
 
@@ -361,9 +498,11 @@ void RenderScene::removeRangedDirLights() {
 void RenderScene::addModel(Model *model) {
     model->attachToScene(this);
     _models.emplace_back(model);
+    _packedModelBoundsValid = false;
     if (_octree && _octree->isEnabled()) {
         _octree->insert(model);
     }
+    updateModelProxy(model);
 }
 
 void RenderScene::removeModel(Model *model) {
@@ -372,9 +511,11 @@ void RenderScene::removeModel(Model *model) {
         if (_octree && _octree->isEnabled()) {
             _octree->remove(*iter);
         }
+        removeModelProxy(model);
         _lodStateCache->removeModel(model);
         model->detachFromScene();
         _models.erase(iter);
+        _packedModelBoundsValid = false;
     } else {
         CC_LOG_WARNING("Try to remove invalid model.");
     }
@@ -385,11 +526,13 @@ void RenderScene::removeModels() {
         if (_octree && _octree->isEnabled()) {
             _octree->remove(model);
         }
+        removeModelProxy(model);
         _lodStateCache->removeModel(model);
         model->detachFromScene();
         CC_SAFE_DESTROY(model);
     }
     _models.clear();
+    _packedModelBoundsValid = false;
 }
 
 void RenderScene::addGPUModel(Model* model) {
@@ -446,6 +589,106 @@ void RenderScene::updateOctree(Model *model) {
     if (_octree && _octree->isEnabled()) {
         _octree->update(model);
     }
+    updateModelProxy(model);
+}
+
+void RenderScene::updateModelProxy(Model *model) {
+    const auto *worldBounds = model->getWorldBounds();
+    const uint32_t proxy = model->getSpatialProxy();
+    if (!worldBounds) {
+        removeModelProxy(model);
+    } else if (proxy == geometry::DynamicAABBTree::NULL_NODE) {
+        model->setSpatialProxy(_modelTree.createProxy(*worldBounds, model));
+    } else {
+        _modelTree.moveProxy(proxy, *worldBounds);
+    }
+}
+
+void RenderScene::removeModelProxy(Model *model) {
+    const uint32_t proxy = model->getSpatialProxy();
+    if (proxy != geometry::DynamicAABBTree::NULL_NODE) {
+        _modelTree.destroyProxy(proxy);
+        model->setSpatialProxy(geometry::DynamicAABBTree::NULL_NODE);
+    }
+}
+
+void RenderScene::queryModels(const geometry::AABB &aabb, ccstd::vector<Model *> &results) const {
+    Vec3 min;
+    Vec3 max;
+    aabb.getBoundary(&min, &max);
+    _modelTree.queryBox(min, max, [&](void *userData) {
+        auto *model = static_cast<Model *>(userData);
+        if (model->isEnabled() && geometry::aabbWithAABB(*model->getWorldBounds(), aabb)) {
+            results.emplace_back(model);
+        }
+    });
+}
+
+void RenderScene::queryModels(const geometry::Sphere &sphere, ccstd::vector<Model *> &results) const {
+    _modelTree.querySphere(sphere, [&](void *userData) {
+        auto *model = static_cast<Model *>(userData);
+        if (model->isEnabled() && geometry::sphereAABB(sphere, *model->getWorldBounds())) {
+            results.emplace_back(model);
+        }
+    });
+}
+
+void RenderScene::queryModels(const geometry::Frustum &frustum, ccstd::vector<Model *> &results) const {
+    const geometry::FrustumPlanes planes{frustum};
+    _modelTree.queryFrustum(planes, [&](void *userData) {
+        auto *model = static_cast<Model *>(userData);
+        const auto *worldBounds = model->getWorldBounds();
+        if (model->isEnabled() && planes.testBox(worldBounds->center, worldBounds->halfExtents) >= 0) {
+            results.emplace_back(model);
+        }
+    });
+}
+
+void RenderScene::queryRayCandidates(const geometry::Ray &ray, float maxDistance, ccstd::vector<std::pair<float, Model *>> &candidates) const {
+    // the tree reports where the ray enters the enlarged bounds, which never exceeds the exact entry distance
+    _modelTree.queryRay(ray, maxDistance, [&](void *userData, float tNear) {
+        auto *model = static_cast<Model *>(userData);
+        if (model->isEnabled() && geometry::rayAABB(ray, *model->getWorldBounds()) != 0) {
+            candidates.emplace_back(tNear, model);
+        }
+    });
+    std::sort(candidates.begin(), candidates.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+    });
+}
+
+void RenderScene::queryModels(const geometry::Ray &ray, float maxDistance, ccstd::vector<Model *> &results) const {
+    ccstd::vector<std::pair<float, Model *>> candidates;
+    queryRayCandidates(ray, maxDistance, candidates);
+    results.reserve(results.size() + candidates.size());
+    for (const auto &candidate : candidates) {
+        results.emplace_back(candidate.second);
+    }
+}
+
+Model *RenderScene::raycastClosestModel(const geometry::Ray &ray, float maxDistance, float *distance) const {
+    ccstd::vector<std::pair<float, Model *>> candidates;
+    queryRayCandidates(ray, maxDistance, candidates);
+
+    Model *closest = nullptr;
+    float closestDistance = maxDistance;
+    geometry::IRayModelOptions options;
+    options.mode = geometry::ERaycastMode::CLOSEST;
+    for (const auto &candidate : candidates) {
+        if (candidate.first > closestDistance) {
+            break;
+        }
+        options.distance = closestDistance;
+        const float dist = geometry::rayModel(ray, *candidate.second, &options);
+        if (dist > 0 && dist <= closestDistance) {
+            closestDistance = dist;
+            closest = candidate.second;
+        }
+    }
+    if (closest && distance) {
+        *distance = closestDistance;
+    }
+    return closest;
 }
 
 void RenderScene::onGlobalPipelineStateChanged() {
@@ -628,7 +871,7 @@ void LodStateCache::updateLodState() {
     }
 }
 
-bool LodStateCache::isLodModelCulled(const Camera *camera, const Model *model) {
+bool LodStateCache::isLodModelCulled(const Camera *camera, const Model *model) const {
     const auto &itModel = _modelsInLODGroup.find(model);
     if (itModel == _modelsInLODGroup.end()) {
         return false;
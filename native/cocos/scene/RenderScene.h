@@ -24,11 +24,16 @@
 
 #pragma once
 
+#include <utility>
 #include "base/Macros.h"
 #include "base/Ptr.h"
 #include "base/RefCounted.h"
 #include "base/std/container/string.h"
 #include "base/std/container/vector.h"
+#include "core/geometry/DynamicAABBTree.h"
+#include "core/geometry/FrustumCulling.h"
+#include "math/Vec3.h"
+#include "math/Vec4.h"
 
 namespace cc {
 
@@ -80,6 +85,11 @@ public:
     void addLODGroup(LODGroup *group);
     void removeLODGroup(LODGroup *group);
     void removeLODGroups();
+    /**
+     * @en Whether the model is culled by its LOD group for the camera. Safe to call from several threads
+     * during culling, LOD states are only modified in update().
+     * @zh 模型在指定相机下是否被 LOD 组裁剪。剔除阶段可在多个线程中同时调用，LOD 状态仅在 update() 中修改。
+     */
     bool isCulledByLod(const Camera *camera, const Model *model) const;
 
     void unsetMainLight(DirectionalLight *dl);
@@ -134,7 +144,58 @@ public:
     inline const ccstd::vector<IntrusivePtr<Model>> &getGPUModels() const { return _gpuModels; }
     inline GPUScene *getGPUScene() const { return _gpuScene.get(); }
 
+    /**
+     * @en Update models in parallel through the job system, GPU submission and octree update are kept on the main thread.
+     * @zh 通过 job system 并行更新模型，GPU 数据提交和八叉树更新仍在主线程执行。
+     */
+    inline void setParallelUpdateEnabled(bool value) { _parallelUpdateEnabled = value; }
+    inline bool isParallelUpdateEnabled() const { return _parallelUpdateEnabled; }
+
+    /**
+     * @en World bounds of models packed for batched culling, indexed like getModels().
+     * Models without world bounds are stored as unbounded boxes.
+     * Returns nullptr when models changed since the last update.
+     * @zh 为批量剔除紧凑存储的模型世界包围盒，索引与 getModels() 一致。
+     * 没有世界包围盒的模型存储为无限大的包围盒。
+     * 若上次更新后模型列表发生变化，返回 nullptr。
+     */
+    inline const geometry::PackedAABBs *getPackedModelBounds() const { return _packedModelBoundsValid ? &_packedModelBounds : nullptr; }
+
+    /**
+     * @en Append the enabled models whose world bounds overlap the given volume.
+     * The scene keeps a dynamic AABB tree over the model world bounds, refreshed whenever they change,
+     * so the cost scales with the number of results instead of the number of models.
+     * @zh 将世界包围盒与给定体积相交的已启用模型追加到结果中。
+     * 场景维护模型世界包围盒的动态 AABB 树，并在包围盒变化时更新，因此开销取决于结果数量而非模型数量。
+     */
+    void queryModels(const geometry::AABB &aabb, ccstd::vector<Model *> &results) const;
+    void queryModels(const geometry::Sphere &sphere, ccstd::vector<Model *> &results) const;
+    void queryModels(const geometry::Frustum &frustum, ccstd::vector<Model *> &results) const;
+
+    /**
+     * @en Append the enabled models whose world bounds are hit by the ray within maxDistance, nearest bounds first.
+     * @zh 将世界包围盒在 maxDistance 内被射线击中的已启用模型追加到结果中，包围盒近的在前。
+     */
+    void queryModels(const geometry::Ray &ray, float maxDistance, ccstd::vector<Model *> &results) const;
+
+    /**
+     * @en Find the closest model whose meshes are hit by the ray, models are tested nearest bounds first
+     * and the search stops once the remaining bounds are farther than the closest hit.
+     * @zh 查找网格被射线击中的最近模型，按包围盒由近到远测试，剩余包围盒比最近命中更远时停止。
+     * @param distance @en Receives the hit distance when not null. @zh 非空时写入命中距离。
+     * @return @en The closest model, nullptr if nothing is hit. @zh 最近的模型，未命中时返回 nullptr。
+     */
+    Model *raycastClosestModel(const geometry::Ray &ray, float maxDistance, float *distance = nullptr) const;
+
 private:
+    void updateModels(uint32_t stamp);
+    void updateModelsParallel(uint32_t stamp);
+    void updateModelsSH();
+    void updatePackedModelBounds();
+    void updateModelProxy(Model *model);
+    void removeModelProxy(Model *model);
+    void queryRayCandidates(const geometry::Ray &ray, float maxDistance, ccstd::vector<std::pair<float, Model *>> &candidates) const;
+
     ccstd::string _name;
     uint64_t _modelId{0};
     IntrusivePtr<DirectionalLight> _mainLight;
@@ -151,6 +212,17 @@ private:
     Octree *_octree{nullptr};
     ccstd::vector<IntrusivePtr<Model>> _gpuModels;
     IntrusivePtr<GPUScene> _gpuScene;
+    ccstd::vector<Model *> _parallelModels;
+    bool _parallelUpdateEnabled{false};
+    geometry::PackedAABBs _packedModelBounds;
+    bool _packedModelBoundsValid{false};
+    geometry::DynamicAABBTree _modelTree;
+    // scratch buffers of the batched light probe interpolation
+    ccstd::vector<Model *> _shModels;
+    ccstd::vector<Vec3> _shPositions;
+    ccstd::vector<int32_t> _shTetIndices;
+    ccstd::vector<Vec4> _shWeights;
+    ccstd::vector<Vec3> _shCoefficients;
 
     CC_DISALLOW_COPY_MOVE_ASSIGN(RenderScene);
 };
@@ -0,0 +1,88 @@
+#include "cocos/core/geometry/AABB.h"
+#include "cocos/core/geometry/Frustum.h"
+#include "cocos/core/geometry/FrustumCulling.h"
+#include "cocos/math/Math.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+
+using cc::geometry::AABB;
+using cc::geometry::Frustum;
+using cc::geometry::PackedAABBs;
+
+constexpr int ITERATIONS = 100;
+
+template <class Func>
+double measure(Func &&func) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i != ITERATIONS; ++i) {
+        func();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / ITERATIONS;
+}
+
+bool run(uint32_t count, const Frustum &frustum) {
+    std::mt19937 rng(count);
+    std::uniform_real_distribution<float> position(-500.0F, 500.0F);
+    std::uniform_real_distribution<float> extent(0.1F, 10.0F);
+
+    ccstd::vector<AABB> boxes(count);
+    PackedAABBs packed;
+    packed.resize(count);
+    for (uint32_t i = 0; i != count; ++i) {
+        boxes[i].set({position(rng), position(rng), position(rng)}, {extent(rng), extent(rng), extent(rng)});
+        packed.set(i, boxes[i]);
+    }
+
+    // reference: one AABB per call, as NativeSceneCulling used to do
+    ccstd::vector<bool> reference(count);
+    const double aabbTime = measure([&]() {
+        for (uint32_t i = 0; i != count; ++i) {
+            reference[i] = boxes[i].aabbFrustum(frustum);
+        }
+    });
+
+    ccstd::vector<uint64_t> scalar;
+    const double scalarTime = measure([&]() {
+        cc::geometry::frustumCullingScalar(frustum, packed, scalar);
+    });
+
+    ccstd::vector<uint64_t> batch;
+    const double batchTime = measure([&]() {
+        cc::geometry::frustumCullingBatch(frustum, packed, batch);
+    });
+
+    uint32_t visibleCount = 0;
+    bool matched = scalar == batch;
+    for (uint32_t i = 0; i != count; ++i) {
+        const bool visible = (batch[i / 64] >> (i % 64)) & 1;
+        matched = matched && visible == reference[i];
+        visibleCount += visible ? 1 : 0;
+    }
+
+    std::cout << count << " models, " << visibleCount << " visible: "
+              << "aabbFrustum " << aabbTime << " us, "
+              << "scalar " << scalarTime << " us, "
+              << "batch " << batchTime << " us, "
+              << "speedup " << aabbTime / batchTime << "x"
+              << (matched ? "" : " MISMATCH") << std::endl;
+    return matched;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Frustum frustum;
+    cc::Mat4 transform;
+    cc::Mat4::fromRT(cc::Quaternion::identity(), cc::Vec3(0, 0, 300), &transform);
+    Frustum::createPerspective(&frustum, cc::math::PI / 3, 16.0F / 9.0F, 0.1F, 600.0F, transform);
+
+    bool matched = true;
+    for (const uint32_t count : {1000U, 10000U, 100000U}) {
+        matched = run(count, frustum) && matched;
+    }
+    return matched ? 0 : 1;
+}
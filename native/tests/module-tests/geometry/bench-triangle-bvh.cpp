@@ -0,0 +1,114 @@
+#include "cocos/core/geometry/Intersect.h"
+#include "cocos/core/geometry/Ray.h"
+#include "cocos/core/geometry/Triangle.h"
+#include "cocos/core/geometry/TriangleBVH.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+namespace {
+
+using cc::geometry::ERaycastMode;
+using cc::geometry::IRaySubMeshResult;
+using cc::geometry::Ray;
+using cc::geometry::TriangleBVH;
+
+constexpr uint32_t RAY_NUM = 200;
+
+template <class Func>
+double measure(Func &&func) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    func();
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+// a terrain like height field of 2 * grid * grid triangles
+bool run(uint32_t grid) {
+    std::mt19937 rng(grid);
+    std::uniform_real_distribution<float> noise(-0.2F, 0.2F);
+    ccstd::vector<float> positions;
+    ccstd::vector<uint32_t> indices;
+    for (uint32_t z = 0; z <= grid; ++z) {
+        for (uint32_t x = 0; x <= grid; ++x) {
+            const float height = std::sin(static_cast<float>(x) * 0.1F) * std::cos(static_cast<float>(z) * 0.1F) * 5.0F + noise(rng);
+            positions.insert(positions.end(), {static_cast<float>(x), height, static_cast<float>(z)});
+        }
+    }
+    for (uint32_t z = 0; z != grid; ++z) {
+        for (uint32_t x = 0; x != grid; ++x) {
+            const uint32_t i = z * (grid + 1) + x;
+            indices.insert(indices.end(), {i, i + grid + 1, i + 1, i + 1, i + grid + 1, i + grid + 2});
+        }
+    }
+    const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+    // picking rays from a camera above the terrain
+    std::uniform_real_distribution<float> target(0.0F, static_cast<float>(grid));
+    ccstd::vector<Ray> rays(RAY_NUM);
+    for (auto &ray : rays) {
+        ray.o.set(static_cast<float>(grid) * 0.5F, 50.0F, -20.0F);
+        ray.d = cc::Vec3(target(rng), 0.0F, target(rng)) - ray.o;
+        ray.d.normalize();
+    }
+
+    // reference: every triangle tested, as the linear narrowphase does
+    ccstd::vector<float> reference(RAY_NUM);
+    const double linearTime = measure([&]() {
+        cc::geometry::Triangle tri;
+        for (uint32_t r = 0; r != RAY_NUM; ++r) {
+            float minDis = 0.0F;
+            for (uint32_t i = 0; i != triangleCount; ++i) {
+                const float *a = positions.data() + indices[i * 3] * 3;
+                const float *b = positions.data() + indices[i * 3 + 1] * 3;
+                const float *c = positions.data() + indices[i * 3 + 2] * 3;
+                tri.a.set(a[0], a[1], a[2]);
+                tri.b.set(b[0], b[1], b[2]);
+                tri.c.set(c[0], c[1], c[2]);
+                const float dist = cc::geometry::rayTriangle(rays[r], tri, false);
+                if (dist != 0.0F && (minDis == 0.0F || dist < minDis)) {
+                    minDis = dist;
+                }
+            }
+            reference[r] = minDis;
+        }
+    });
+
+    TriangleBVH bvh;
+    const double buildTime = measure([&]() {
+        bvh.build(positions.data(), indices.data(), triangleCount);
+    });
+
+    ccstd::vector<float> closest(RAY_NUM);
+    ccstd::vector<IRaySubMeshResult> hits;
+    const double bvhTime = measure([&]() {
+        for (uint32_t r = 0; r != RAY_NUM; ++r) {
+            hits.clear();
+            closest[r] = bvh.raycast(rays[r], ERaycastMode::CLOSEST, FLT_MAX, false, hits);
+        }
+    });
+
+    bool matched = true;
+    for (uint32_t r = 0; r != RAY_NUM; ++r) {
+        matched = matched && std::abs(closest[r] - reference[r]) <= 1e-3F;
+    }
+
+    std::cout << triangleCount << " triangles, " << RAY_NUM << " rays: "
+              << "linear " << linearTime / RAY_NUM << " us/ray, "
+              << "bvh " << bvhTime / RAY_NUM << " us/ray, "
+              << "build " << buildTime / 1000.0 << " ms, "
+              << "speedup " << linearTime / bvhTime << "x"
+              << (matched ? "" : " MISMATCH") << std::endl;
+    return matched;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    bool matched = true;
+    for (const uint32_t grid : {32U, 100U, 317U}) {
+        matched = run(grid) && matched;
+    }
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+#include "cocos/math/Mat4.h"
+#include "cocos/math/MathUtil.h"
+#include "math/MathUtil.inl"
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define BENCH_SSE
+    #include "math/MathUtilSSE.inl"
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define BENCH_NEON64
+    #include "math/MathUtilNeon64.inl"
+#endif
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t MATRIX_NUM = 4096;
+constexpr uint32_t ROUND_NUM = 200;
+
+struct Data {
+    std::vector<float> lhs;
+    std::vector<float> rhs;
+    std::vector<float> dst;
+};
+
+Data createData() {
+    Data data;
+    data.lhs.resize(MATRIX_NUM * 16);
+    data.rhs.resize(MATRIX_NUM * 16);
+    data.dst.resize(MATRIX_NUM * 16);
+    for (uint32_t i = 0; i < MATRIX_NUM * 16; ++i) {
+        data.lhs[i] = static_cast<float>(i % 17) * 0.25F - 2.F;
+        data.rhs[i] = static_cast<float>(i % 13) * 0.5F - 3.F;
+    }
+    return data;
+}
+
+// returns the throughput in operations per microsecond
+template <typename Fn>
+double measure(Fn &&fn) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t round = 0; round < ROUND_NUM; ++round) {
+        fn();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return static_cast<double>(MATRIX_NUM) * ROUND_NUM / std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+template <typename Impl>
+void benchImpl(const char *name, Data &data, std::vector<float> &expected, bool &passed) {
+    const float *lhs = data.lhs.data();
+    const float *rhs = data.rhs.data();
+    float *dst = data.dst.data();
+
+    const double multiplyRate = measure([&]() {
+        for (uint32_t i = 0; i < MATRIX_NUM; ++i) {
+            Impl::multiplyMatrix(lhs + i * 16, rhs + i * 16, dst + i * 16);
+        }
+    });
+    if (expected.empty()) {
+        expected = data.dst;
+    }
+    for (uint32_t i = 0; i < MATRIX_NUM * 16; ++i) {
+        passed = passed && std::abs(expected[i] - data.dst[i]) < 1e-3F;
+    }
+
+    const double transposeRate = measure([&]() {
+        for (uint32_t i = 0; i < MATRIX_NUM; ++i) {
+            Impl::transposeMatrix(lhs + i * 16, dst + i * 16);
+        }
+    });
+    const double transformRate = measure([&]() {
+        for (uint32_t i = 0; i < MATRIX_NUM; ++i) {
+            Impl::transformVec4(lhs, rhs + i * 4, dst + i * 4);
+        }
+    });
+    std::cout << name << ": multiply " << multiplyRate << " ops/us, "
+              << "transpose " << transposeRate << " ops/us, "
+              << "transformVec4 " << transformRate << " ops/us" << std::endl;
+}
+
+// the public batched entry points, dispatched to the best kernel of the platform
+void benchBatched(Data &data, const std::vector<float> &expected, bool &passed) {
+    const auto *lhs = reinterpret_cast<const cc::Mat4 *>(data.lhs.data());
+    const auto *rhs = reinterpret_cast<const cc::Mat4 *>(data.rhs.data());
+    auto *dst = reinterpret_cast<cc::Mat4 *>(data.dst.data());
+
+    const double multiplyRate = measure([&]() { cc::Mat4::multiply(lhs, rhs, dst, MATRIX_NUM); });
+    for (uint32_t i = 0; i < MATRIX_NUM * 16; ++i) {
+        passed = passed && std::abs(expected[i] - data.dst[i]) < 1e-3F;
+    }
+    const double transformRate = measure([&]() {
+        lhs->transformVectors(reinterpret_cast<const cc::Vec4 *>(rhs), reinterpret_cast<cc::Vec4 *>(dst), MATRIX_NUM);
+    });
+    std::cout << "Mat4 batched: multiply " << multiplyRate << " ops/us, "
+              << "transformVectors " << transformRate << " ops/us" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    bool passed = sizeof(cc::Mat4) == 16 * sizeof(float) && sizeof(cc::Vec4) == 4 * sizeof(float);
+    Data data = createData();
+    std::vector<float> expected;
+
+    benchImpl<cc::MathUtilC>("scalar", data, expected, passed);
+#ifdef BENCH_SSE
+    benchImpl<cc::MathUtilSSE>("SSE", data, expected, passed);
+#endif
+#ifdef BENCH_NEON64
+    benchImpl<cc::MathUtilNeon64>("NEON64", data, expected, passed);
+#endif
+    benchBatched(data, expected, passed);
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+#include "cocos/renderer/core/ProgramUtils.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Fix linking error of undefined symbol cocos_main
+int cocos_main(int argc, const char **argv) {
+    return 0;
+}
+
+namespace {
+
+using cc::IProgramInfo;
+using cc::MacroRecord;
+using cc::ProgramVariantKey;
+
+constexpr int VARIANT_NUM = 256;
+constexpr int LOOKUP_NUM = 1000000;
+constexpr ccstd::hash_t PROGRAM_HASH = 0x5f3759df;
+
+// boolean defines take one bit each, number defines in [0, 7] take three
+IProgramInfo makeTemplate(int boolNum, int numberNum) {
+    IProgramInfo tmpl;
+    tmpl.name = "bench-shader-variant-key";
+    tmpl.hash = PROGRAM_HASH;
+    for (int i = 0; i < boolNum; ++i) {
+        tmpl.defines.emplace_back();
+        tmpl.defines.back().name = "CC_USE_FEATURE_" + std::to_string(i);
+        tmpl.defines.back().type = "boolean";
+    }
+    for (int i = 0; i < numberNum; ++i) {
+        tmpl.defines.emplace_back();
+        tmpl.defines.back().name = "CC_FEATURE_LEVEL_" + std::to_string(i);
+        tmpl.defines.back().type = "number";
+        tmpl.defines.back().range = ccstd::vector<int32_t>{0, 7};
+    }
+    cc::render::populateMacros(tmpl);
+    return tmpl;
+}
+
+std::vector<MacroRecord> makeVariants(const IProgramInfo &tmpl, std::mt19937 &rng) {
+    std::vector<MacroRecord> variants;
+    std::uniform_int_distribution<int32_t> isSet(0, 3);
+    // zero is left to the unset macros, the uber string key tells them apart from explicit zeros while the packed key doesn't
+    std::uniform_int_distribution<int32_t> value(1, 7);
+    while (variants.size() < VARIANT_NUM) {
+        MacroRecord defines;
+        for (const auto &tmplDef : tmpl.defines) {
+            if (isSet(rng) == 0) { // not every material sets every macro
+                continue;
+            }
+            if (tmplDef.type == "boolean") {
+                defines[tmplDef.name] = true;
+            } else {
+                defines[tmplDef.name] = value(rng);
+            }
+        }
+        variants.emplace_back(std::move(defines));
+    }
+    return variants;
+}
+
+std::string getStringKey(const IProgramInfo &tmpl, const MacroRecord &defines) {
+    return cc::render::getVariantKey(tmpl, defines);
+}
+
+ProgramVariantKey getPackedKey(const IProgramInfo &tmpl, const MacroRecord &defines) {
+    return cc::render::getProgramVariantKey(tmpl, defines);
+}
+
+// every variant resolves to the same program through both keys, and fields read back unchanged
+bool testKeys(const IProgramInfo &tmpl, const std::vector<MacroRecord> &variants) {
+    std::unordered_map<std::string, int> stringCache;
+    std::unordered_map<ProgramVariantKey, int, ccstd::hash<ProgramVariantKey>> packedCache;
+    for (int i = 0; i < static_cast<int>(variants.size()); ++i) {
+        const int stringId = stringCache.emplace(getStringKey(tmpl, variants[i]), i).first->second;
+        const int packedId = packedCache.emplace(getPackedKey(tmpl, variants[i]), i).first->second;
+        if (stringId != packedId) {
+            return false;
+        }
+        const auto key = getPackedKey(tmpl, variants[i]);
+        for (size_t j = 0; j < tmpl.defines.size(); ++j) {
+            const auto &tmplDef = tmpl.defines[j];
+            auto itDef = variants[i].find(tmplDef.name);
+            const auto expected = itDef != variants[i].end() ? static_cast<uint32_t>(tmplDef.map(itDef->second)) : 0U;
+            const auto count = j + 1 < tmpl.defines.size() ? static_cast<uint32_t>(tmpl.defines[j + 1].offset - tmplDef.offset) : 32U;
+            if (key.getBits(tmplDef.offset, count) != expected) {
+                return false;
+            }
+        }
+    }
+    return stringCache.size() == packedCache.size();
+}
+
+// returns the throughput in lookups per millisecond
+template <typename Cache, typename GetKey>
+double measure(const IProgramInfo &tmpl, const std::vector<MacroRecord> &variants, GetKey getKey, int &checksum) {
+    Cache cache;
+    for (int i = 0; i < static_cast<int>(variants.size()); ++i) {
+        cache.emplace(getKey(tmpl, variants[i]), i);
+    }
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < LOOKUP_NUM; ++i) {
+        const auto &defines = variants[(i * 7) % variants.size()];
+        checksum += cache.find(getKey(tmpl, defines))->second;
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return LOOKUP_NUM / std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    bool passed = true;
+    std::mt19937 rng(42);
+
+    // bits: 24 fits the hex key, 120 takes the uber path, 320 spills past the inline words
+    for (const auto &layout : {std::make_pair(12, 4), std::make_pair(48, 24), std::make_pair(80, 80)}) {
+        const auto tmpl = makeTemplate(layout.first, layout.second);
+        const auto variants = makeVariants(tmpl, rng);
+        passed = testKeys(tmpl, variants) && passed;
+
+        int stringChecksum = 0;
+        int packedChecksum = 0;
+        const double stringRate = measure<std::unordered_map<std::string, int>>(tmpl, variants, getStringKey, stringChecksum);
+        const double packedRate = measure<std::unordered_map<ProgramVariantKey, int, ccstd::hash<ProgramVariantKey>>>(tmpl, variants, getPackedKey, packedChecksum);
+        passed = stringChecksum == packedChecksum && passed;
+
+        std::cout << tmpl.defines.size() << " defines, " << tmpl.defines.back().offset + 3 << " bits: "
+                  << "string key " << stringRate << " lookups/ms, "
+                  << "packed key " << packedRate << " lookups/ms, "
+                  << "speedup " << packedRate / stringRate << "x" << std::endl;
+    }
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+#include "cocos/base/ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fix linking error of undefined symbol cocos_main
+int cocos_main(int argc, const char **argv) {
+    return 0;
+}
+
+namespace {
+
+using cc::LegacyThreadPool;
+
+constexpr int THREAD_NUM = 4;
+constexpr int TASKS_PER_PRODUCER = 100000;
+
+// reference: one mutex guarded queue shared by all threads, as LegacyThreadPool used to do
+class MutexPool {
+public:
+    explicit MutexPool(int threadNum) {
+        for (int i = 0; i < threadNum; ++i) {
+            _threads.emplace_back([this, i]() {
+                while (true) {
+                    std::function<void(int)> task;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _cv.wait(lock, [this]() { return !_tasks.empty() || _isDone; });
+                        if (_tasks.empty()) {
+                            return;
+                        }
+                        task = std::move(_tasks.front());
+                        _tasks.pop_front();
+                    }
+                    task(i);
+                }
+            });
+        }
+    }
+
+    ~MutexPool() {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _isDone = true;
+        }
+        _cv.notify_all();
+        for (auto &thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void pushTask(std::function<void(int)> task) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _tasks.push_back(std::move(task));
+        }
+        _cv.notify_one();
+    }
+
+private:
+    std::vector<std::thread> _threads;
+    std::deque<std::function<void(int)>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _isDone{false};
+};
+
+void waitFor(const std::atomic<int> &counter, int expected) {
+    while (counter.load() != expected) {
+        std::this_thread::yield();
+    }
+}
+
+// producers push tiny tasks concurrently, returns the throughput in tasks per millisecond
+template <typename Pool>
+double measure(Pool &pool, int producerNum) {
+    std::atomic<int> counter{0};
+    const int total = producerNum * TASKS_PER_PRODUCER;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerNum; ++p) {
+        producers.emplace_back([&]() {
+            for (int i = 0; i < TASKS_PER_PRODUCER; ++i) {
+                pool.pushTask([&counter](int /*tid*/) { counter.fetch_add(1); });
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    waitFor(counter, total);
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    return total / std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// tasks spawning sub tasks are queued on the spawning thread and stolen by the idle ones
+bool testNestedTasks(LegacyThreadPool *pool) {
+    constexpr int PARENT_NUM = 64;
+    constexpr int CHILD_NUM = 256;
+    std::atomic<int> counter{0};
+    for (int i = 0; i < PARENT_NUM; ++i) {
+        pool->pushTask([pool, &counter](int /*tid*/) {
+            for (int j = 0; j < CHILD_NUM; ++j) {
+                pool->pushTask([&counter](int /*tid*/) { counter.fetch_add(1); });
+            }
+        });
+    }
+    waitFor(counter, PARENT_NUM * CHILD_NUM);
+    return true;
+}
+
+bool testStopTasksByType(LegacyThreadPool *pool) {
+    std::atomic<bool> isBlocked{true};
+    std::atomic<int> started{0};
+    std::atomic<int> network{0};
+    std::atomic<int> io{0};
+
+    // keep every thread busy so that the following tasks stay queued
+    for (int i = 0; i < THREAD_NUM; ++i) {
+        pool->pushTask([&](int /*tid*/) {
+            started.fetch_add(1);
+            while (isBlocked.load()) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    waitFor(started, THREAD_NUM);
+
+    for (int i = 0; i < 100; ++i) {
+        pool->pushTask([&network](int /*tid*/) { network.fetch_add(1); }, LegacyThreadPool::TaskType::NETWORK);
+        pool->pushTask([&io](int /*tid*/) { io.fetch_add(1); }, LegacyThreadPool::TaskType::IO);
+    }
+    pool->stopTasksByType(LegacyThreadPool::TaskType::NETWORK);
+    isBlocked = false;
+
+    waitFor(io, 100);
+    while (pool->getTaskNum() > 0) {
+        std::this_thread::yield();
+    }
+    // tasks pushed after stopping run as usual
+    pool->pushTask([&network](int /*tid*/) { network.fetch_add(1); }, LegacyThreadPool::TaskType::NETWORK);
+    waitFor(network, 1);
+    return network.load() == 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    bool passed = true;
+    auto *pool = LegacyThreadPool::newFixedThreadPool(THREAD_NUM);
+
+    passed = testNestedTasks(pool) && passed;
+    passed = testStopTasksByType(pool) && passed;
+
+    {
+        MutexPool reference(THREAD_NUM);
+        for (const int producerNum : {1, 2, 4, 8}) {
+            const double referenceRate = measure(reference, producerNum);
+            const double rate = measure(*pool, producerNum);
+            std::cout << producerNum << " producers, " << THREAD_NUM << " threads: "
+                      << "mutex queue " << referenceRate << " tasks/ms, "
+                      << "work stealing " << rate << " tasks/ms, "
+                      << "speedup " << rate / referenceRate << "x" << std::endl;
+        }
+    }
+
+    delete pool;
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+/****************************************************************************
+Copyright (c) 2022 Xiamen Yaji Software Co., Ltd.
+
+http://www.cocos2d-x.org
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+****************************************************************************/
+
+#include "cocos/renderer/pipeline/custom/FGDispatcherGraphs.h"
+#include "cocos/renderer/pipeline/custom/test/test.h"
+#include "gfx-base/GFXDef-common.h"
+#include "gtest/gtest.h"
+#include "utils.h"
+
+namespace {
+
+using namespace cc::render;
+
+// transient render targets are aliased only when they are managed textures
+void addTransientTextures(ResourceGraph& rescGraph, std::initializer_list<const char*> names) {
+    for (const auto* name : names) {
+        ResourceDesc desc{};
+        desc.dimension = ResourceDimension::TEXTURE2D;
+        desc.width = 960;
+        desc.height = 640;
+        desc.depthOrArraySize = 1;
+        desc.mipLevels = 1;
+        desc.format = cc::gfx::Format::RGBA8;
+        desc.sampleCount = cc::gfx::SampleCount::X1;
+        desc.flags = ResourceFlags::SAMPLED | ResourceFlags::COLOR_ATTACHMENT |
+                     ResourceFlags::TRANSFER_SRC | ResourceFlags::TRANSFER_DST;
+        addVertex(
+            ManagedTextureTag{},
+            std::forward_as_tuple(name),
+            std::forward_as_tuple(desc),
+            std::forward_as_tuple(ResourceTraits{ResourceResidency::MANAGED}),
+            std::forward_as_tuple(),
+            std::forward_as_tuple(),
+            std::forward_as_tuple(),
+            rescGraph);
+    }
+}
+
+void addExternalTextures(ResourceGraph& rescGraph, std::initializer_list<const char*> names) {
+    for (const auto* name : names) {
+        auto resID = add_vertex(rescGraph, ManagedTag{}, name);
+        auto& desc = rescGraph.descs[resID];
+        desc.dimension = ResourceDimension::TEXTURE2D;
+        desc.width = 960;
+        desc.height = 640;
+        desc.format = cc::gfx::Format::RGBA8;
+        rescGraph.traits[resID].residency = ResourceResidency::EXTERNAL;
+    }
+}
+
+const cc::gfx::Texture* getManagedTexture(const ResourceGraph& rescGraph, const char* name) {
+    return get(ManagedTextureTag{}, findVertex(name, rescGraph), rescGraph).texture.get();
+}
+
+} // namespace
+
+TEST(fgDispatherAliasing, test16) {
+    // "0" dies before "2" is written, they share one texture:
+    // src -> pass0 -> 0 -> pass1 -> 1 -> pass2 -> 2 -> pass3 -> dst
+    ViewInfo rasterData = {
+        {PassType::COPY, {{{"src"}, {"0"}}}},
+        {PassType::COPY, {{{"0"}, {"1"}}}},
+        {PassType::COPY, {{{"1"}, {"2"}}}},
+        {PassType::COPY, {{{"2"}, {"dst"}}}},
+    };
+    LayoutInfo layoutInfo = {{}, {}, {}, {}};
+
+    boost::container::pmr::memory_resource* resource = boost::container::pmr::get_default_resource();
+    RenderGraph renderGraph(resource);
+    ResourceGraph rescGraph(resource);
+    LayoutGraphData layoutGraphData(resource);
+
+    addTransientTextures(rescGraph, {"0", "1", "2"});
+    addExternalTextures(rescGraph, {"src", "dst"});
+    fillTestGraph(rasterData, {}, layoutInfo, renderGraph, rescGraph, layoutGraphData);
+
+    FrameGraphDispatcher fgDispatcher(rescGraph, renderGraph, layoutGraphData, resource, resource);
+    fgDispatcher.enableMemoryAliasing(true);
+    fgDispatcher.run();
+
+    ExpectEq(getManagedTexture(rescGraph, "0") != nullptr, true);
+    ExpectEq(getManagedTexture(rescGraph, "0") == getManagedTexture(rescGraph, "2"), true);
+    ExpectEq(getManagedTexture(rescGraph, "1") != getManagedTexture(rescGraph, "0"), true);
+
+    // "0" now reads its previous contents first, so it gives up the texture shared with "2":
+    // 0 -> pass0 -> 1 -> pass1 -> 2 -> pass2 -> dst
+    ViewInfo nextRasterData = {
+        {PassType::COPY, {{{"0"}, {"1"}}}},
+        {PassType::COPY, {{{"1"}, {"2"}}}},
+        {PassType::COPY, {{{"2"}, {"dst"}}}},
+    };
+    LayoutInfo nextLayoutInfo = {{}, {}, {}};
+
+    RenderGraph nextRenderGraph(resource);
+    LayoutGraphData nextLayoutGraphData(resource);
+    fillTestGraph(nextRasterData, {}, nextLayoutInfo, nextRenderGraph, rescGraph, nextLayoutGraphData);
+
+    const auto* shared = getManagedTexture(rescGraph, "2");
+    FrameGraphDispatcher nextDispatcher(rescGraph, nextRenderGraph, nextLayoutGraphData, resource, resource);
+    nextDispatcher.enableMemoryAliasing(true);
+    nextDispatcher.run();
+
+    ExpectEq(getManagedTexture(rescGraph, "0") == nullptr, true);
+    ExpectEq(getManagedTexture(rescGraph, "2") == shared, true);
+    ExpectEq(getManagedTexture(rescGraph, "1") != getManagedTexture(rescGraph, "2"), true);
+}
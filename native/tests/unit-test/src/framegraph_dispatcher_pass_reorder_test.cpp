@@ -0,0 +1,130 @@
+/****************************************************************************
+Copyright (c) 2022 Xiamen Yaji Software Co., Ltd.
+
+http://www.cocos2d-x.org
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+****************************************************************************/
+
+#include "cocos/renderer/pipeline/custom/FGDispatcherGraphs.h"
+#include "cocos/renderer/pipeline/custom/test/test.h"
+#include "gfx-base/GFXDef-common.h"
+#include "gtest/gtest.h"
+#include "utils.h"
+
+// two independent copy chains joined by the last pass:
+// 4 -> pass0 -> 0 -> pass1 -> 1,
+// 5 -> pass2 -> 2 -> pass3 -> 3,
+// 1, 3 -> pass4 -> 22
+#define TEST_CASE_REORDER                                      \
+    TEST_CASE_DEFINE                                           \
+                                                               \
+    ViewInfo rasterData = {                                    \
+        {PassType::COPY, {{{"4"}, {"0"}}}},                    \
+        {PassType::COPY, {{{"0"}, {"1"}}}},                    \
+        {PassType::COPY, {{{"5"}, {"2"}}}},                    \
+        {PassType::COPY, {{{"2"}, {"3"}}}},                    \
+        {PassType::RASTER, {{{"1", "3"}, {"22"}}}},            \
+    };                                                         \
+                                                               \
+    LayoutInfo layoutInfo = {                                  \
+        {},                                                    \
+        {},                                                    \
+        {},                                                    \
+        {},                                                    \
+        {                                                      \
+            {"1", 1, cc::gfx::ShaderStageFlagBit::FRAGMENT},   \
+            {"3", 3, cc::gfx::ShaderStageFlagBit::FRAGMENT},   \
+            {"22", 22, cc::gfx::ShaderStageFlagBit::FRAGMENT}, \
+        },                                                     \
+    };
+
+TEST(fgDispatherReorder, test14) {
+    // memory first: the chains run one after another
+    TEST_CASE_REORDER;
+
+    boost::container::pmr::memory_resource* resource = boost::container::pmr::get_default_resource();
+    RenderGraph renderGraph(resource);
+    ResourceGraph rescGraph(resource);
+    LayoutGraphData layoutGraphData(resource);
+
+    fillTestGraph(rasterData, resources, layoutInfo, renderGraph, rescGraph, layoutGraphData);
+
+    FrameGraphDispatcher fgDispatcher(rescGraph, renderGraph, layoutGraphData, resource, resource);
+    fgDispatcher.enablePassReorder(true);
+    fgDispatcher.setParalellWeight(0.0F);
+    fgDispatcher.run();
+
+    const auto& rag = fgDispatcher.resourceAccessGraph;
+    ExpectEq(rag.topologicalOrder.size() >= 6, true);
+    ExpectEq(rag.topologicalOrder[0] == 0 && rag.topologicalOrder[1] == 1 &&
+                 rag.topologicalOrder[2] == 2 && rag.topologicalOrder[3] == 3 &&
+                 rag.topologicalOrder[4] == 4 && rag.topologicalOrder[5] == 5,
+             true);
+
+    // producer and consumer of "0" are adjacent
+    const auto& node1 = rag.barrier.at(1);
+    ExpectEq(node1.rearBarriers.size() == 1, true);
+    ExpectEq(node1.rearBarriers.front().type == BarrierType::FULL, true);
+    const auto& node2 = rag.barrier.at(2);
+    for (const auto& barrier : node2.frontBarriers) {
+        ExpectEq(barrier.type == BarrierType::SPLIT_END, false);
+    }
+}
+
+TEST(fgDispatherReorder, test15) {
+    // parallelism first: the chains are interleaved
+    TEST_CASE_REORDER;
+
+    boost::container::pmr::memory_resource* resource = boost::container::pmr::get_default_resource();
+    RenderGraph renderGraph(resource);
+    ResourceGraph rescGraph(resource);
+    LayoutGraphData layoutGraphData(resource);
+
+    fillTestGraph(rasterData, resources, layoutInfo, renderGraph, rescGraph, layoutGraphData);
+
+    FrameGraphDispatcher fgDispatcher(rescGraph, renderGraph, layoutGraphData, resource, resource);
+    fgDispatcher.enablePassReorder(true);
+    fgDispatcher.setParalellWeight(1.0F);
+    fgDispatcher.run();
+
+    const auto& rag = fgDispatcher.resourceAccessGraph;
+    ExpectEq(rag.topologicalOrder.size() >= 6, true);
+    ExpectEq(rag.topologicalOrder[0] == 0 && rag.topologicalOrder[1] == 1 &&
+                 rag.topologicalOrder[2] == 3 && rag.topologicalOrder[3] == 2 &&
+                 rag.topologicalOrder[4] == 4 && rag.topologicalOrder[5] == 5,
+             true);
+
+    // pass2 runs between the producer and the consumer of "0", the barrier is split around it
+    const auto& node1 = rag.barrier.at(1);
+    ExpectEq(node1.rearBarriers.size() == 1, true);
+    ExpectEq(node1.rearBarriers.front().type == BarrierType::SPLIT_BEGIN, true);
+
+    const auto& node2 = rag.barrier.at(2);
+    bool hasSplitEnd = false;
+    for (const auto& barrier : node2.frontBarriers) {
+        hasSplitEnd |= barrier.type == BarrierType::SPLIT_END && barrier.resourceID == node1.rearBarriers.front().resourceID;
+    }
+    ExpectEq(hasSplitEnd, true);
+
+    // same for "2" with pass1 in between
+    const auto& node3 = rag.barrier.at(3);
+    ExpectEq(node3.rearBarriers.size() == 1, true);
+    ExpectEq(node3.rearBarriers.front().type == BarrierType::SPLIT_BEGIN, true);
+}
@@ -0,0 +1,192 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "cocos/core/geometry/AABB.h"
+#include "cocos/core/geometry/DynamicAABBTree.h"
+#include "cocos/core/geometry/Frustum.h"
+#include "cocos/core/geometry/Ray.h"
+#include "cocos/core/geometry/Sphere.h"
+#include "cocos/math/Mat4.h"
+#include "cocos/math/Quaternion.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using cc::geometry::DynamicAABBTree;
+
+struct Proxy {
+    cc::geometry::AABB aabb;
+    uint32_t id{DynamicAABBTree::NULL_NODE};
+};
+
+bool overlaps(const DynamicAABBTree &tree, uint32_t id, const cc::Vec3 &min, const cc::Vec3 &max) {
+    const auto &fatMin = tree.getFatMin(id);
+    const auto &fatMax = tree.getFatMax(id);
+    return fatMin.x <= max.x && fatMin.y <= max.y && fatMin.z <= max.z &&
+           fatMax.x >= min.x && fatMax.y >= min.y && fatMax.z >= min.z;
+}
+
+template <class Query>
+ccstd::vector<uint32_t> collect(Query &&query) {
+    ccstd::vector<uint32_t> result;
+    query([&](void *userData) { result.emplace_back(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(userData))); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+} // namespace
+
+TEST(geometryDynamicAABBTreeTest, testQueries) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> position(-100.0F, 100.0F);
+    std::uniform_real_distribution<float> extent(0.1F, 5.0F);
+    std::uniform_real_distribution<float> offset(-3.0F, 3.0F);
+
+    DynamicAABBTree tree;
+    ccstd::vector<Proxy> proxies(2000);
+    for (uint32_t i = 0; i != proxies.size(); ++i) {
+        proxies[i].aabb.set({position(rng), position(rng), position(rng)}, {extent(rng), extent(rng), extent(rng)});
+        proxies[i].id = tree.createProxy(proxies[i].aabb, reinterpret_cast<void *>(static_cast<uintptr_t>(i)));
+    }
+    // move every proxy a bit, a few of them far away, and remove some
+    for (uint32_t i = 0; i != proxies.size(); ++i) {
+        auto &proxy = proxies[i];
+        if (i % 7 == 0) {
+            tree.destroyProxy(proxy.id);
+            proxy.id = DynamicAABBTree::NULL_NODE;
+            continue;
+        }
+        const cc::Vec3 shift = i % 5 == 0 ? cc::Vec3(position(rng), 0, 0) : cc::Vec3(offset(rng), offset(rng), offset(rng)) * 0.1F;
+        proxy.aabb.setCenter(proxy.aabb.getCenter() + shift);
+        tree.moveProxy(proxy.id, proxy.aabb);
+    }
+    EXPECT_EQ(tree.getProxyCount(), 2000 - (2000 + 6) / 7);
+    // balanced by rotations
+    EXPECT_LE(tree.getHeight(), 3 * 11);
+
+    for (const auto &proxy : proxies) {
+        if (proxy.id != DynamicAABBTree::NULL_NODE) {
+            cc::Vec3 min;
+            cc::Vec3 max;
+            proxy.aabb.getBoundary(&min, &max);
+            EXPECT_TRUE(overlaps(tree, proxy.id, min, max) && tree.getFatMin(proxy.id) <= min && max <= tree.getFatMax(proxy.id));
+        }
+    }
+
+    for (uint32_t q = 0; q != 50; ++q) {
+        // box
+        const cc::Vec3 center{position(rng), position(rng), position(rng)};
+        const cc::Vec3 half{extent(rng) * 4, extent(rng) * 4, extent(rng) * 4};
+        ccstd::vector<uint32_t> expected;
+        for (uint32_t i = 0; i != proxies.size(); ++i) {
+            if (proxies[i].id != DynamicAABBTree::NULL_NODE && overlaps(tree, proxies[i].id, center - half, center + half)) {
+                expected.emplace_back(i);
+            }
+        }
+        EXPECT_EQ(collect([&](auto &&func) { tree.queryBox(center - half, center + half, func); }), expected);
+
+        // sphere, compared against the box of the sphere which is a superset
+        cc::geometry::Sphere sphere(center.x, center.y, center.z, half.x);
+        const auto inSphere = collect([&](auto &&func) { tree.querySphere(sphere, func); });
+        const cc::Vec3 radius{half.x, half.x, half.x};
+        const auto inSphereBox = collect([&](auto &&func) { tree.queryBox(center - radius, center + radius, func); });
+        EXPECT_TRUE(std::includes(inSphereBox.begin(), inSphereBox.end(), inSphere.begin(), inSphere.end()));
+
+        // ray, every reported box is entered within the distance
+        cc::geometry::Ray ray(center.x, center.y, center.z, offset(rng), offset(rng), offset(rng));
+        ray.d.normalize();
+        ccstd::vector<uint32_t> hits;
+        tree.queryRay(ray, 50.0F, [&](void *userData, float distance) {
+            const auto i = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(userData));
+            const cc::Vec3 point = ray.o + ray.d * distance;
+            const cc::Vec3 eps{1e-3F, 1e-3F, 1e-3F};
+            EXPECT_LE(distance, 50.0F);
+            EXPECT_TRUE(overlaps(tree, proxies[i].id, point - eps, point + eps));
+            hits.emplace_back(i);
+        });
+        std::sort(hits.begin(), hits.end());
+        expected.clear();
+        for (uint32_t i = 0; i != proxies.size(); ++i) {
+            if (proxies[i].id == DynamicAABBTree::NULL_NODE) {
+                continue;
+            }
+            // reference slab test in double precision
+            double tMin = 0.0;
+            double tMax = 50.0;
+            const float o[] = {ray.o.x, ray.o.y, ray.o.z};
+            const float d[] = {ray.d.x, ray.d.y, ray.d.z};
+            const float lo[] = {tree.getFatMin(proxies[i].id).x, tree.getFatMin(proxies[i].id).y, tree.getFatMin(proxies[i].id).z};
+            const float hi[] = {tree.getFatMax(proxies[i].id).x, tree.getFatMax(proxies[i].id).y, tree.getFatMax(proxies[i].id).z};
+            for (uint32_t axis = 0; axis != 3; ++axis) {
+                const double t1 = (lo[axis] - o[axis]) / static_cast<double>(d[axis]);
+                const double t2 = (hi[axis] - o[axis]) / static_cast<double>(d[axis]);
+                tMin = std::max(tMin, std::min(t1, t2));
+                tMax = std::min(tMax, std::max(t1, t2));
+            }
+            if (tMin <= tMax) {
+                expected.emplace_back(i);
+            }
+        }
+        EXPECT_EQ(hits, expected);
+    }
+}
+
+TEST(geometryDynamicAABBTreeTest, testFrustum) {
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<float> position(-200.0F, 200.0F);
+    std::uniform_real_distribution<float> extent(0.1F, 10.0F);
+
+    cc::geometry::Frustum frustum;
+    cc::Mat4 transform;
+    cc::Mat4::fromRT(cc::Quaternion::identity(), cc::Vec3(0, 0, 100), &transform);
+    cc::geometry::Frustum::createPerspective(&frustum, 1.0F, 1.5F, 0.1F, 150.0F, transform);
+    const cc::geometry::FrustumPlanes planes(frustum);
+
+    DynamicAABBTree tree;
+    ccstd::vector<uint32_t> ids(3000);
+    for (uint32_t i = 0; i != ids.size(); ++i) {
+        cc::geometry::AABB aabb;
+        aabb.set({position(rng), position(rng), position(rng)}, {extent(rng), extent(rng), extent(rng)});
+        ids[i] = tree.createProxy(aabb, reinterpret_cast<void *>(static_cast<uintptr_t>(i)));
+    }
+
+    ccstd::vector<uint32_t> expected;
+    for (uint32_t i = 0; i != ids.size(); ++i) {
+        const auto &min = tree.getFatMin(ids[i]);
+        const auto &max = tree.getFatMax(ids[i]);
+        if (planes.testBox((min + max) * 0.5F, (max - min) * 0.5F) != -1) {
+            expected.emplace_back(i);
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(collect([&](auto &&func) { tree.queryFrustum(planes, func); }), expected);
+
+    for (const auto id : ids) {
+        tree.destroyProxy(id);
+    }
+    EXPECT_EQ(tree.getProxyCount(), 0);
+    EXPECT_TRUE(collect([&](auto &&func) { tree.queryFrustum(planes, func); }).empty());
+}
@@ -0,0 +1,122 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include <random>
+#include "cocos/core/geometry/AABB.h"
+#include "cocos/core/geometry/Frustum.h"
+#include "cocos/core/geometry/FrustumCulling.h"
+#include "cocos/core/geometry/Plane.h"
+#include "cocos/math/Mat4.h"
+#include "cocos/math/Quaternion.h"
+#include "cocos/math/Vec3.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+void makeFrustum(cc::geometry::Frustum &frustum) {
+    cc::Mat4 transform;
+    cc::Quaternion rotation;
+    cc::Quaternion::createFromAxisAngle(cc::Vec3(0.0F, 1.0F, 0.0F), 0.5F, &rotation);
+    cc::Mat4::fromRT(rotation, cc::Vec3(10.0F, 0.0F, 50.0F), &transform);
+    cc::geometry::Frustum::createPerspective(&frustum, 1.0F, 1.5F, 0.1F, 100.0F, transform);
+}
+
+int referenceTest(const cc::geometry::AABB &aabb, const cc::geometry::Frustum &frustum) {
+    bool inside = true;
+    for (const auto *plane : frustum.planes) {
+        const int result = aabb.aabbPlane(*plane);
+        if (result == -1) {
+            return -1;
+        }
+        inside = inside && result == 0;
+    }
+    return inside ? 0 : 1;
+}
+
+} // namespace
+
+TEST(geometryFrustumCullingTest, testPlanes) {
+    cc::geometry::Frustum frustum;
+    makeFrustum(frustum);
+    const cc::geometry::FrustumPlanes planes(frustum);
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> position(-120.0F, 120.0F);
+    std::uniform_real_distribution<float> extent(0.0F, 20.0F);
+    int counts[3] = {};
+    for (int i = 0; i < 10000; ++i) {
+        const cc::Vec3 center(position(rng), position(rng), position(rng));
+        const cc::Vec3 halfExtents(extent(rng), extent(rng), extent(rng));
+        cc::geometry::AABB aabb;
+        aabb.set(center, halfExtents);
+        const int expected = referenceTest(aabb, frustum);
+        EXPECT_EQ(planes.testBox(center, halfExtents), expected);
+        ++counts[expected + 1];
+    }
+    // all three outcomes are covered
+    EXPECT_GT(counts[0], 0);
+    EXPECT_GT(counts[1], 0);
+    EXPECT_GT(counts[2], 0);
+}
+
+TEST(geometryFrustumCullingTest, testBatch) {
+    cc::geometry::Frustum frustum;
+    makeFrustum(frustum);
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<float> position(-120.0F, 120.0F);
+    std::uniform_real_distribution<float> extent(0.0F, 20.0F);
+    for (const uint32_t count : {0U, 1U, 37U, 64U, 1000U}) {
+        ccstd::vector<cc::geometry::AABB> boxes(count);
+        cc::geometry::PackedAABBs packed;
+        packed.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            boxes[i].set({position(rng), position(rng), position(rng)}, {extent(rng), extent(rng), extent(rng)});
+            packed.set(i, boxes[i]);
+        }
+        if (count) {
+            // far away, but unbounded
+            boxes[0].set({1e6F, 1e6F, 1e6F}, {1.0F, 1.0F, 1.0F});
+            packed.setUnbounded(0);
+        }
+
+        ccstd::vector<uint64_t> batch;
+        ccstd::vector<uint64_t> scalar;
+        cc::geometry::frustumCullingBatch(frustum, packed, batch);
+        cc::geometry::frustumCullingScalar(frustum, packed, scalar);
+        EXPECT_EQ(batch, scalar);
+        ASSERT_EQ(batch.size(), cc::geometry::getVisibilityWordCount(count));
+
+        ccstd::vector<uint32_t> visible;
+        cc::geometry::forEachVisible(batch, [&](uint32_t index) {
+            visible.emplace_back(index);
+        });
+        ccstd::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (i == 0 || boxes[i].aabbFrustum(frustum)) {
+                expected.emplace_back(i);
+            }
+        }
+        EXPECT_EQ(visible, expected);
+    }
+}
@@ -0,0 +1,173 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include <random>
+#include "cocos/core/geometry/Intersect.h"
+#include "cocos/core/geometry/Ray.h"
+#include "cocos/core/geometry/Triangle.h"
+#include "cocos/core/geometry/TriangleBVH.h"
+#include "cocos/math/Vec3.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using cc::geometry::ERaycastMode;
+using cc::geometry::IRaySubMeshResult;
+
+struct TestMesh {
+    ccstd::vector<float> positions;
+    ccstd::vector<uint32_t> indices;
+    uint32_t getTriangleCount() const { return static_cast<uint32_t>(indices.size() / 3); }
+};
+
+// a bumpy height field facing +y, plus a few triangles floating above it
+TestMesh makeMesh() {
+    constexpr uint32_t GRID = 64;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> height(-1.0F, 1.0F);
+    TestMesh mesh;
+    for (uint32_t z = 0; z <= GRID; ++z) {
+        for (uint32_t x = 0; x <= GRID; ++x) {
+            mesh.positions.insert(mesh.positions.end(), {static_cast<float>(x), height(rng), static_cast<float>(z)});
+        }
+    }
+    for (uint32_t z = 0; z != GRID; ++z) {
+        for (uint32_t x = 0; x != GRID; ++x) {
+            const uint32_t i = z * (GRID + 1) + x;
+            mesh.indices.insert(mesh.indices.end(), {i, i + GRID + 1, i + 1, i + 1, i + GRID + 1, i + GRID + 2});
+        }
+    }
+    std::uniform_real_distribution<float> position(0.0F, static_cast<float>(GRID));
+    for (uint32_t i = 0; i != 100; ++i) {
+        const auto base = static_cast<uint32_t>(mesh.positions.size() / 3);
+        const float x = position(rng);
+        const float z = position(rng);
+        mesh.positions.insert(mesh.positions.end(), {x, 3.0F, z, x, 3.0F, z + 2.0F, x + 2.0F, 3.0F, z});
+        mesh.indices.insert(mesh.indices.end(), {base, base + 1, base + 2});
+    }
+    return mesh;
+}
+
+cc::geometry::Triangle getTriangle(const TestMesh &mesh, uint32_t triangle) {
+    const auto vertex = [&](uint32_t i) {
+        const float *p = mesh.positions.data() + mesh.indices[triangle * 3 + i] * 3;
+        return cc::Vec3(p[0], p[1], p[2]);
+    };
+    cc::geometry::Triangle tri;
+    tri.a = vertex(0);
+    tri.b = vertex(1);
+    tri.c = vertex(2);
+    return tri;
+}
+
+ccstd::vector<cc::geometry::Ray> makeRays() {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> position(-8.0F, 72.0F);
+    std::uniform_real_distribution<float> direction(-1.0F, 1.0F);
+    ccstd::vector<cc::geometry::Ray> rays;
+    for (uint32_t i = 0; i != 500; ++i) {
+        cc::geometry::Ray ray;
+        ray.o.set(position(rng), 10.0F * direction(rng), position(rng));
+        ray.d.set(direction(rng), direction(rng) - 0.5F, direction(rng));
+        ray.d.normalize();
+        rays.emplace_back(ray);
+    }
+    // straight down and axis aligned rays
+    rays.emplace_back(cc::geometry::Ray(10.5F, 20.0F, 20.25F, 0.0F, -1.0F, 0.0F));
+    rays.emplace_back(cc::geometry::Ray(-5.0F, 0.0F, 31.5F, 1.0F, 0.0F, 0.0F));
+    return rays;
+}
+
+} // namespace
+
+TEST(geometryTriangleBVHTest, testModes) {
+    const TestMesh mesh = makeMesh();
+    cc::geometry::TriangleBVH bvh;
+    bvh.build(mesh.positions.data(), mesh.indices.data(), mesh.getTriangleCount());
+    EXPECT_EQ(bvh.getTriangleCount(), mesh.getTriangleCount());
+
+    uint32_t hitRayCount = 0;
+    for (const bool doubleSided : {false, true}) {
+        for (const auto &ray : makeRays()) {
+            // brute force reference, same as the linear narrowphase
+            float closest = 0.0F;
+            uint32_t hitCount = 0;
+            for (uint32_t i = 0; i != mesh.getTriangleCount(); ++i) {
+                const float dist = cc::geometry::rayTriangle(ray, getTriangle(mesh, i), doubleSided);
+                if (dist != 0.0F) {
+                    closest = (closest == 0.0F || dist < closest) ? dist : closest;
+                    ++hitCount;
+                }
+            }
+            hitRayCount += hitCount ? 1 : 0;
+
+            ccstd::vector<IRaySubMeshResult> hits;
+            const float closestBVH = bvh.raycast(ray, ERaycastMode::CLOSEST, FLT_MAX, doubleSided, hits);
+            EXPECT_NEAR(closestBVH, closest, 1e-4F);
+            EXPECT_EQ(hits.size(), hitCount ? 1 : 0);
+
+            hits.clear();
+            bvh.raycast(ray, ERaycastMode::ALL, FLT_MAX, doubleSided, hits);
+            EXPECT_EQ(hits.size(), hitCount);
+
+            hits.clear();
+            const float any = bvh.raycast(ray, ERaycastMode::ANY, FLT_MAX, doubleSided, hits);
+            EXPECT_EQ(any != 0.0F, hitCount != 0);
+            EXPECT_EQ(hits.size(), hitCount ? 1 : 0);
+
+            // hits beyond the maximum distance are ignored
+            if (hitCount) {
+                hits.clear();
+                EXPECT_EQ(bvh.raycast(ray, ERaycastMode::CLOSEST, closest * 0.5F, doubleSided, hits), 0.0F);
+                EXPECT_TRUE(hits.empty());
+            }
+        }
+    }
+    // both hits and misses are covered
+    EXPECT_GT(hitRayCount, 0);
+    EXPECT_LT(hitRayCount, 1004);
+}
+
+TEST(geometryTriangleBVHTest, testVertexIndices) {
+    const float positions[] = {0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 1};
+    const uint32_t indices[] = {0, 1, 2, 2, 1, 3};
+    cc::geometry::TriangleBVH bvh;
+    bvh.build(positions, indices, 2);
+
+    ccstd::vector<IRaySubMeshResult> hits;
+    const float dist = bvh.raycast(cc::geometry::Ray(0.75F, 2.0F, 0.75F, 0.0F, -1.0F, 0.0F), ERaycastMode::CLOSEST, FLT_MAX, false, hits);
+    EXPECT_FLOAT_EQ(dist, 2.0F);
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_EQ(hits[0].vertexIndex0, 2);
+    EXPECT_EQ(hits[0].vertexIndex1, 1);
+    EXPECT_EQ(hits[0].vertexIndex2, 3);
+
+    // seen from below the triangles are back faces
+    hits.clear();
+    EXPECT_EQ(bvh.raycast(cc::geometry::Ray(0.75F, -2.0F, 0.75F, 0.0F, 1.0F, 0.0F), ERaycastMode::CLOSEST, FLT_MAX, false, hits), 0.0F);
+    EXPECT_FLOAT_EQ(bvh.raycast(cc::geometry::Ray(0.75F, -2.0F, 0.75F, 0.0F, 1.0F, 0.0F), ERaycastMode::CLOSEST, FLT_MAX, true, hits), 2.0F);
+
+    bvh.clear();
+    EXPECT_TRUE(bvh.empty());
+    EXPECT_EQ(bvh.raycast(cc::geometry::Ray(0.75F, 2.0F, 0.75F, 0.0F, -1.0F, 0.0F), ERaycastMode::ANY, FLT_MAX, true, hits), 0.0F);
+}
@@ -0,0 +1,126 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include <cstdlib>
+#include "cocos/gi/light-probe/LightProbe.h"
+#include "cocos/gi/light-probe/SH.h"
+#include "cocos/math/Vec3.h"
+#include "cocos/math/Vec4.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+float random01() {
+    return static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+}
+
+// jittered lattice of probes, jitter avoids degenerated delaunay cases
+cc::IntrusivePtr<cc::gi::LightProbesData> createProbesData(uint32_t size) {
+    ccstd::vector<cc::Vec3> points;
+    for (uint32_t z = 0; z < size; ++z) {
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                points.emplace_back(static_cast<float>(x) * 2.0F + random01() * 0.5F,
+                                    static_cast<float>(y) + random01() * 0.25F,
+                                    static_cast<float>(z) * 2.0F + random01() * 0.5F);
+            }
+        }
+    }
+
+    cc::IntrusivePtr<cc::gi::LightProbesData> data = ccnew cc::gi::LightProbesData();
+    data->updateProbes(points);
+    data->updateTetrahedrons();
+
+    const auto basisCount = cc::gi::SH::getBasisCount();
+    for (auto &probe : data->getProbes()) {
+        for (uint32_t i = 0; i < basisCount; ++i) {
+            probe.coefficients.emplace_back(probe.position * static_cast<float>(i + 1));
+        }
+    }
+    return data;
+}
+
+bool isInside(const cc::Vec4 &weights) {
+    constexpr float EPSILON = 1e-4F;
+    return weights.x >= -EPSILON && weights.y >= -EPSILON && weights.z >= -EPSILON && weights.w >= -EPSILON;
+}
+
+} // namespace
+
+TEST(giLightProbeTest, testLookup) {
+    std::srand(1);
+    auto data = createProbesData(8);
+    ASSERT_FALSE(data->empty());
+
+    // positions inside the probes, looked up without a previous tetrahedron and with a far one
+    const auto lastIndex = static_cast<int32_t>(data->getTetrahedrons().size()) - 1;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const cc::Vec3 position{1.0F + random01() * 12.0F, 0.5F + random01() * 6.0F, 1.0F + random01() * 12.0F};
+        cc::Vec4 weights;
+        const int32_t tetIndex = data->getInterpolationWeights(position, -1, weights);
+        ASSERT_GE(tetIndex, 0);
+        EXPECT_TRUE(isInside(weights));
+        EXPECT_TRUE(data->getTetrahedrons()[tetIndex].isInnerTetrahedron());
+        EXPECT_NEAR(weights.x + weights.y + weights.z + weights.w, 1.0F, 1e-4F);
+
+        cc::Vec4 otherWeights;
+        EXPECT_EQ(data->getInterpolationWeights(position, lastIndex, otherWeights), tetIndex);
+        EXPECT_EQ(data->getInterpolationWeights(position, tetIndex, otherWeights), tetIndex);
+    }
+
+    // positions outside the probes end in an outer cell
+    cc::Vec4 weights;
+    const int32_t outerIndex = data->getInterpolationWeights(cc::Vec3{-20.0F, 3.0F, 7.0F}, -1, weights);
+    EXPECT_TRUE(data->getTetrahedrons()[outerIndex].isOuterCell());
+    EXPECT_TRUE(isInside(weights));
+}
+
+TEST(giLightProbeTest, testBatch) {
+    std::srand(2);
+    auto data = createProbesData(6);
+    constexpr uint32_t COUNT = 256;
+    const auto basisCount = cc::gi::SH::getBasisCount();
+
+    ccstd::vector<cc::Vec3> positions;
+    ccstd::vector<int32_t> tetIndices(COUNT, -1);
+    ccstd::vector<cc::Vec4> weights(COUNT);
+    ccstd::vector<cc::Vec3> coefficients(COUNT * basisCount);
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        positions.emplace_back(-2.0F + random01() * 14.0F, -1.0F + random01() * 7.0F, -2.0F + random01() * 14.0F);
+    }
+    data->getInterpolationWeights(positions.data(), tetIndices.data(), weights.data(), COUNT);
+    ASSERT_TRUE(data->getInterpolationSHCoefficients(tetIndices.data(), weights.data(), COUNT, coefficients.data()));
+
+    ccstd::vector<cc::Vec3> expected;
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        cc::Vec4 expectedWeights;
+        const int32_t tetIndex = data->getInterpolationWeights(positions[i], -1, expectedWeights);
+        EXPECT_EQ(tetIndices[i], tetIndex);
+        EXPECT_TRUE(weights[i] == expectedWeights);
+
+        ASSERT_TRUE(data->getInterpolationSHCoefficients(tetIndex, expectedWeights, expected));
+        for (uint32_t j = 0; j < basisCount; ++j) {
+            EXPECT_TRUE(coefficients[i * basisCount + j] == expected[j]);
+        }
+    }
+}
@@ -284,3 +284,43 @@ TEST(mathMat4Test, test5) {
     cc::Mat4 b{1.111224F, 0.123455F, 0.384182F, 1.111223F, 3.123456F, 4.384184F, 5.111224F, 6.123456F, 2.384182F, 3.111223F, 4.123456F, 5.384184F, 6.111223F, 7.123455F, 8.384184F, 9.111223F};
     ExpectEq(a.approxEquals(b), true);
 }
+
+TEST(mathMat4Test, test6) {
+    // batched multiply matches the single one, also when dst aliases the input
+    logLabel = "test the mat4 batched multiply function";
+    cc::Mat4 lhs[3];
+    cc::Mat4 rhs[3];
+    cc::Mat4 out[3];
+    for (uint32_t i = 0; i < 3; ++i) {
+        for (uint32_t j = 0; j < 16; ++j) {
+            lhs[i].m[j] = static_cast<float>(i * 16 + j) * 0.5F;
+            rhs[i].m[j] = static_cast<float>(j) - static_cast<float>(i);
+        }
+    }
+    cc::Mat4::multiply(lhs, rhs, out, 3);
+    bool isSame = true;
+    for (uint32_t i = 0; i < 3; ++i) {
+        cc::Mat4 expected;
+        cc::Mat4::multiply(lhs[i], rhs[i], &expected);
+        isSame = isSame && out[i].approxEquals(expected);
+    }
+    ExpectEq(isSame, true);
+    cc::Mat4::multiply(lhs, rhs, lhs, 3);
+    ExpectEq(lhs[2].approxEquals(out[2]), true);
+
+    // batched transformVectors
+    logLabel = "test the mat4 batched transformVectors function";
+    cc::Mat4 trs;
+    trs.translate(1, 2, 3);
+    trs.scale(2);
+    cc::Vec4 vectors[5];
+    cc::Vec4 transformed[5];
+    for (uint32_t i = 0; i < 5; ++i) {
+        vectors[i].set(static_cast<float>(i), 1, -1, 1);
+    }
+    trs.transformVectors(vectors, transformed, 5);
+    ExpectEq(transformed[0] == cc::Vec4(1, 4, 1, 1), true);
+    ExpectEq(transformed[4] == cc::Vec4(9, 4, 1, 1), true);
+    trs.transformVectors(vectors, vectors, 5);
+    ExpectEq(vectors[3] == transformed[3], true);
+}
@@ -0,0 +1,200 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include <cstring>
+#include "cocos/3d/assets/Mesh.h"
+#include "cocos/core/assets/RenderingSubMesh.h"
+#include "cocos/math/Mat4.h"
+#include "cocos/math/Quaternion.h"
+#include "cocos/math/Vec3.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace cc;
+
+// position and normal are transformed on merge, the unorm color must be copied as is
+struct TestVertex {
+    Vec3 position;
+    Vec3 normal;
+    uint8_t color[4];
+};
+
+constexpr uint32_t POSITION_OFFSET = 0;
+constexpr uint32_t NORMAL_OFFSET = 12;
+constexpr uint32_t COLOR_OFFSET = 24;
+constexpr uint32_t VERTEX_STRIDE = 28;
+
+// The indices are stored in front of the vertices, so that the vertex bundle starts at a non-zero offset.
+IntrusivePtr<Mesh> createMesh(const ccstd::vector<TestVertex> &vertices, const ccstd::vector<uint32_t> &indices, uint32_t indexStride) {
+    const auto indexLength = static_cast<uint32_t>(indices.size()) * indexStride;
+    const uint32_t vertexOffset = (indexLength + 3) & ~3U;
+    const auto vertexLength = static_cast<uint32_t>(vertices.size()) * VERTEX_STRIDE;
+
+    auto *buffer = ccnew ArrayBuffer(vertexOffset + vertexLength);
+    uint8_t *data = buffer->getData();
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const uint16_t index16 = static_cast<uint16_t>(indices[i]);
+        memcpy(data + i * indexStride, indexStride == 2 ? static_cast<const void *>(&index16) : &indices[i], indexStride);
+    }
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        uint8_t *vertex = data + vertexOffset + i * VERTEX_STRIDE;
+        memcpy(vertex + POSITION_OFFSET, &vertices[i].position.x, 12);
+        memcpy(vertex + NORMAL_OFFSET, &vertices[i].normal.x, 12);
+        memcpy(vertex + COLOR_OFFSET, vertices[i].color, 4);
+    }
+
+    Mesh::IStruct structInfo;
+    structInfo.vertexBundles.emplace_back();
+    auto &bundle = structInfo.vertexBundles.back();
+    bundle.view = {vertexOffset, vertexLength, static_cast<uint32_t>(vertices.size()), VERTEX_STRIDE};
+    bundle.attributes.push_back({gfx::ATTR_NAME_POSITION, gfx::Format::RGB32F});
+    bundle.attributes.push_back({gfx::ATTR_NAME_NORMAL, gfx::Format::RGB32F});
+    bundle.attributes.push_back({gfx::ATTR_NAME_COLOR, gfx::Format::RGBA8, true});
+
+    structInfo.primitives.emplace_back();
+    auto &primitive = structInfo.primitives.back();
+    primitive.vertexBundelIndices = {0};
+    primitive.primitiveMode = gfx::PrimitiveMode::TRIANGLE_LIST;
+    primitive.indexView = Mesh::IBufferView{0, indexLength, static_cast<uint32_t>(indices.size()), indexStride};
+
+    IntrusivePtr<Mesh> mesh = ccnew Mesh();
+    mesh->reset({structInfo, Uint8Array(buffer)});
+    mesh->initialize();
+    return mesh;
+}
+
+const ccstd::vector<TestVertex> VERTICES_A{
+    {{0.F, 0.F, 0.F}, {0.F, 1.F, 0.F}, {255, 0, 0, 255}},
+    {{1.F, 0.F, 0.F}, {0.F, 1.F, 0.F}, {0, 255, 0, 255}},
+    {{0.F, 0.F, 1.F}, {0.F, 1.F, 0.F}, {0, 0, 255, 255}},
+};
+
+const ccstd::vector<TestVertex> VERTICES_B{
+    {{2.F, 1.F, -1.F}, {1.F, 0.F, 0.F}, {10, 20, 30, 40}},
+    {{-3.F, 0.5F, 4.F}, {0.F, 0.F, 1.F}, {50, 60, 70, 80}},
+    {{0.5F, -2.F, 0.F}, {0.F, 0.6F, 0.8F}, {90, 100, 110, 120}},
+};
+
+Vec3 readVec3(Mesh &mesh, uint32_t vertex, uint32_t attributeOffset) {
+    const auto &view = mesh.getStruct().vertexBundles[0].view;
+    const uint8_t *data = mesh.getData().buffer()->getData() + view.offset + vertex * view.stride + attributeOffset;
+    Vec3 v;
+    memcpy(&v.x, data, 12);
+    return v;
+}
+
+const uint8_t *readColor(Mesh &mesh, uint32_t vertex) {
+    const auto &view = mesh.getStruct().vertexBundles[0].view;
+    return mesh.getData().buffer()->getData() + view.offset + vertex * view.stride + COLOR_OFFSET;
+}
+
+ccstd::vector<uint32_t> readIndices(Mesh &mesh) {
+    const auto &view = mesh.getStruct().primitives[0].indexView.value();
+    const uint8_t *data = mesh.getData().buffer()->getData() + view.offset;
+    ccstd::vector<uint32_t> indices(view.count);
+    for (uint32_t i = 0; i < view.count; ++i) {
+        switch (view.stride) {
+            case 1:
+                indices[i] = data[i];
+                break;
+            case 2:
+                indices[i] = reinterpret_cast<const uint16_t *>(data)[i];
+                break;
+            default:
+                indices[i] = reinterpret_cast<const uint32_t *>(data)[i];
+                break;
+        }
+    }
+    return indices;
+}
+
+void expectVec3Near(const Vec3 &actual, const Vec3 &expected) {
+    EXPECT_NEAR(actual.x, expected.x, 1e-4F);
+    EXPECT_NEAR(actual.y, expected.y, 1e-4F);
+    EXPECT_NEAR(actual.z, expected.z, 1e-4F);
+}
+
+void expectVertices(Mesh &mesh, uint32_t first, const ccstd::vector<TestVertex> &vertices, const Mat4 *worldMatrix) {
+    Quaternion rotation;
+    if (worldMatrix) {
+        worldMatrix->getRotation(&rotation);
+    }
+    for (uint32_t i = 0; i < vertices.size(); ++i) {
+        Vec3 position = vertices[i].position;
+        Vec3 normal = vertices[i].normal;
+        if (worldMatrix) {
+            Vec3::transformMat4(vertices[i].position, *worldMatrix, &position);
+            normal.transformQuat(rotation);
+        }
+        expectVec3Near(readVec3(mesh, first + i, POSITION_OFFSET), position);
+        expectVec3Near(readVec3(mesh, first + i, NORMAL_OFFSET), normal);
+        EXPECT_EQ(memcmp(readColor(mesh, first + i), vertices[i].color, 4), 0);
+    }
+}
+
+} // namespace
+
+TEST(meshMergeTest, withoutWorldMatrix) {
+    auto meshA = createMesh(VERTICES_A, {0, 1, 2}, 2);
+    auto meshB = createMesh(VERTICES_B, {2, 1, 0}, 4);
+
+    IntrusivePtr<Mesh> merged = ccnew Mesh();
+    EXPECT_TRUE(merged->merge(meshA));
+    EXPECT_TRUE(merged->merge(meshB, nullptr, true));
+
+    const auto &bundle = merged->getStruct().vertexBundles[0];
+    EXPECT_EQ(bundle.view.count, 6U);
+    EXPECT_EQ(bundle.view.stride, VERTEX_STRIDE);
+    expectVertices(*merged, 0, VERTICES_A, nullptr);
+    expectVertices(*merged, 3, VERTICES_B, nullptr);
+
+    // the uint16 and uint32 indices are narrowed to the stride of the merged count, the appended ones rebased
+    EXPECT_EQ(merged->getStruct().primitives[0].indexView.value().stride, 1U);
+    EXPECT_EQ(readIndices(*merged), (ccstd::vector<uint32_t>{0, 1, 2, 5, 4, 3}));
+}
+
+TEST(meshMergeTest, withWorldMatrix) {
+    auto meshA = createMesh(VERTICES_A, {0, 1, 2}, 4);
+    auto meshB = createMesh(VERTICES_B, {1, 2, 0}, 2);
+
+    Quaternion rotation;
+    Quaternion::fromEuler(30.F, 45.F, -60.F, &rotation);
+    Mat4 worldMatrix;
+    Mat4::fromRTS(rotation, Vec3(1.F, -2.F, 3.F), Vec3(2.F, 2.F, 2.F), &worldMatrix);
+
+    // the first merge into an empty mesh transforms the vertices in place, the second one appends them
+    IntrusivePtr<Mesh> merged = ccnew Mesh();
+    EXPECT_TRUE(merged->merge(meshA, &worldMatrix));
+    expectVertices(*merged, 0, VERTICES_A, &worldMatrix);
+    EXPECT_TRUE(merged->merge(meshB, &worldMatrix, true));
+
+    EXPECT_EQ(merged->getStruct().vertexBundles[0].view.count, 6U);
+    expectVertices(*merged, 0, VERTICES_A, &worldMatrix);
+    expectVertices(*merged, 3, VERTICES_B, &worldMatrix);
+    EXPECT_EQ(readIndices(*merged), (ccstd::vector<uint32_t>{0, 1, 2, 4, 5, 3}));
+
+    // the source meshes are left untouched
+    expectVertices(*meshA, 0, VERTICES_A, nullptr);
+    expectVertices(*meshB, 0, VERTICES_B, nullptr);
+}
@@ -24,6 +24,7 @@
  ****************************************************************************/
 
 #include "core/scene-graph/Node.h"
+#include "core/scene-graph/TransformSystem.h"
 #include "gtest/gtest.h"
 #include "utils.h"
 
@@ -56,4 +57,63 @@ TEST(NodeTest, setSliblingIndex) {
     ExpectEq(child2->getSiblingIndex() == 1, true);
 }
 
+TEST(NodeTest, transformSystem) {
+    // Same hierarchy twice, one resolved by TransformSystem, the other lazily by Node.
+    IntrusivePtr<Node> roots[2];
+    ccstd::vector<IntrusivePtr<Node>> nodes[2];
+    for (auto k = 0; k < 2; ++k) {
+        roots[k] = new Node("root");
+        Node *parent = roots[k];
+        for (auto i = 0; i < 4; ++i) {
+            IntrusivePtr<Node> child = new Node("child");
+            IntrusivePtr<Node> sibling = new Node("sibling");
+            parent->addChild(child);
+            parent->addChild(sibling);
+            nodes[k].emplace_back(child);
+            nodes[k].emplace_back(sibling);
+            parent = child;
+        }
+    }
+
+    auto *system = TransformSystem::getInstance();
+    system->setEnabled(true);
+    system->addRoot(roots[0]);
+
+    auto check = [&]() {
+        system->update();
+        for (size_t i = 0; i < nodes[0].size(); ++i) {
+            const auto &expected = nodes[1][i]->getWorldMatrix();
+            const auto &actual = nodes[0][i]->getWorldMatrix();
+            for (auto j = 0; j < 16; ++j) {
+                ExpectEq(IsEqualF(expected.m[j], actual.m[j]), true);
+            }
+        }
+    };
+
+    for (auto k = 0; k < 2; ++k) {
+        roots[k]->setPosition(1.F, 2.F, 3.F);
+        nodes[k][0]->setRotationFromEuler(0.F, 45.F, 0.F);
+        nodes[k][3]->setScale(2.F, 2.F, 2.F);
+        nodes[k][6]->setPosition(-1.F, 0.F, 5.F);
+    }
+    check();
+    ExpectEq(system->getLevelCount() == 5, true);
+
+    // Only the position of an intermediate node changes.
+    for (auto k = 0; k < 2; ++k) {
+        nodes[k][2]->setPosition(0.F, 4.F, 0.F);
+    }
+    check();
+
+    // Hierarchy change triggers a rebuild.
+    for (auto k = 0; k < 2; ++k) {
+        nodes[k][7]->setParent(roots[k]);
+        roots[k]->setRotationFromEuler(90.F, 0.F, 0.F);
+    }
+    check();
+    ExpectEq(system->getNodeCount() == 9, true);
+
+    TransformSystem::destroyInstance();
+}
+
 } // namespace
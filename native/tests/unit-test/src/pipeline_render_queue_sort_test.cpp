@@ -0,0 +1,130 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "cocos/renderer/pipeline/RenderQueueSort.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+struct Entry {
+    uint32_t priority{0};
+    uint32_t hash{0};
+    float depth{0};
+    uint32_t shaderID{0};
+};
+
+std::vector<Entry> makeEntries(uint32_t count) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<uint32_t> priorityDist(0, 3);
+    std::uniform_int_distribution<uint32_t> hashDist(0, 4);
+    std::uniform_int_distribution<uint32_t> depthDist(0, 40);
+    std::uniform_int_distribution<uint32_t> shaderDist(0, 7);
+    std::vector<Entry> entries(count);
+    for (auto &entry : entries) {
+        entry.priority = priorityDist(rng);
+        entry.hash = (hashDist(rng) << 16) | (hashDist(rng) << 8);
+        // quantized depths so that ties happen, with a few negative ones
+        entry.depth = static_cast<float>(depthDist(rng)) * 0.5F - 2.0F;
+        entry.shaderID = shaderDist(rng);
+    }
+    return entries;
+}
+
+template <class MakeKey>
+std::vector<uint32_t> sortByKeys(const std::vector<Entry> &entries, const MakeKey &makeKey) {
+    const auto count = static_cast<uint32_t>(entries.size());
+    std::vector<cc::pipeline::RenderQueueSortKey> keys(count);
+    std::vector<cc::pipeline::RenderQueueSortKey> scratch(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        keys[i].index = i;
+        EXPECT_TRUE(makeKey(entries[i], &keys[i].key));
+    }
+    cc::pipeline::sortRenderQueueKeys(keys.data(), scratch.data(), count);
+    cc::pipeline::sortRenderQueueKeyTies(keys.data(), count, [&](uint32_t index) { return entries[index].shaderID; });
+    std::vector<uint32_t> order(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        order[i] = keys[i].index;
+    }
+    return order;
+}
+
+std::vector<uint32_t> makeIdentity(uint32_t count) {
+    std::vector<uint32_t> order(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    return order;
+}
+
+} // namespace
+
+TEST(pipelineRenderQueueSortTest, testSortableDepth) {
+    const float depths[] = {-100.0F, -1.5F, -0.0F, 0.0F, 1e-6F, 1.5F, 100.0F};
+    for (size_t i = 1; i < sizeof(depths) / sizeof(depths[0]); ++i) {
+        EXPECT_LE(cc::pipeline::getSortableDepth(depths[i - 1]), cc::pipeline::getSortableDepth(depths[i]));
+    }
+    EXPECT_LT(cc::pipeline::getSortableDepth(-1.5F), cc::pipeline::getSortableDepth(1.5F));
+}
+
+TEST(pipelineRenderQueueSortTest, testOpaque) {
+    for (const uint32_t count : {0U, 1U, 17U, 2000U}) {
+        const auto entries = makeEntries(count);
+        const auto order = sortByKeys(entries, [](const Entry &entry, uint64_t *key) {
+            *key = cc::pipeline::makeOpaqueSortKey(entry.hash, entry.depth);
+            return true;
+        });
+        auto expected = makeIdentity(count);
+        std::stable_sort(expected.begin(), expected.end(), [&](uint32_t lhs, uint32_t rhs) {
+            const auto &a = entries[lhs];
+            const auto &b = entries[rhs];
+            return std::forward_as_tuple(a.hash, a.depth, a.shaderID) < std::forward_as_tuple(b.hash, b.depth, b.shaderID);
+        });
+        EXPECT_EQ(order, expected);
+    }
+}
+
+TEST(pipelineRenderQueueSortTest, testTransparent) {
+    for (const uint32_t count : {0U, 1U, 17U, 2000U}) {
+        const auto entries = makeEntries(count);
+        const auto order = sortByKeys(entries, [](const Entry &entry, uint64_t *key) {
+            return cc::pipeline::makeTransparentSortKey(entry.priority, entry.hash, entry.depth, key);
+        });
+        auto expected = makeIdentity(count);
+        std::stable_sort(expected.begin(), expected.end(), [&](uint32_t lhs, uint32_t rhs) {
+            const auto &a = entries[lhs];
+            const auto &b = entries[rhs];
+            return std::forward_as_tuple(a.priority, a.hash, b.depth, a.shaderID) < std::forward_as_tuple(b.priority, b.hash, a.depth, b.shaderID);
+        });
+        EXPECT_EQ(order, expected);
+    }
+}
+
+TEST(pipelineRenderQueueSortTest, testOutOfRange) {
+    uint64_t key = 0;
+    EXPECT_FALSE(cc::pipeline::makeTransparentSortKey(0x100U, 0, 0.0F, &key));
+    EXPECT_FALSE(cc::pipeline::makeTransparentSortKey(0, 0x1000000U, 0.0F, &key));
+}
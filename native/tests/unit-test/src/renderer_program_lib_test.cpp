@@ -0,0 +1,125 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include "cocos/core/assets/EffectAsset.h"
+#include "cocos/renderer/core/ProgramLib.h"
+#include "cocos/renderer/gfx-base/GFXDevice.h"
+#include "cocos/renderer/pipeline/custom/RenderInterfaceTypes.h"
+#include "cocos/scene/Define.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace cc;
+
+// only the macros and the global set layout are read while creating shader variants
+class TestPipeline final : public render::PipelineRuntime {
+public:
+    TestPipeline() {
+        _descriptorSetLayout = gfx::Device::getInstance()->createDescriptorSetLayout(gfx::DescriptorSetLayoutInfo{});
+    }
+
+    bool activate(gfx::Swapchain * /*swapchain*/) override { return true; }
+    bool destroy() noexcept override { return true; }
+    void render(const ccstd::vector<scene::Camera *> & /*cameras*/) override {}
+    gfx::Device *getDevice() const override { return gfx::Device::getInstance(); }
+    const MacroRecord &getMacros() const override { return _macros; }
+    pipeline::GlobalDSManager *getGlobalDSManager() const override { return nullptr; }
+    gfx::DescriptorSetLayout *getDescriptorSetLayout() const override { return _descriptorSetLayout; }
+    gfx::DescriptorSet *getDescriptorSet() const override { return nullptr; }
+    const ccstd::vector<gfx::CommandBuffer *> &getCommandBuffers() const override { return _commandBuffers; }
+    pipeline::PipelineSceneData *getPipelineSceneData() const override { return nullptr; }
+    const ccstd::string &getConstantMacros() const override { return _constantMacros; }
+    scene::Model *getProfiler() const override { return nullptr; }
+    void setProfiler(scene::Model * /*profiler*/) override {}
+    pipeline::GeometryRenderer *getGeometryRenderer() const override { return nullptr; }
+    float getShadingScale() const override { return 1.F; }
+    void setShadingScale(float /*scale*/) override {}
+    const ccstd::string &getMacroString(const ccstd::string & /*name*/) const override { return _constantMacros; }
+    int32_t getMacroInt(const ccstd::string & /*name*/) const override { return 0; }
+    bool getMacroBool(const ccstd::string & /*name*/) const override { return false; }
+    void setMacroString(const ccstd::string & /*name*/, const ccstd::string & /*value*/) override {}
+    void setMacroInt(const ccstd::string & /*name*/, int32_t /*value*/) override {}
+    void setMacroBool(const ccstd::string & /*name*/, bool /*value*/) override {}
+    void onGlobalPipelineStateChanged() override {}
+    void setValue(const ccstd::string & /*name*/, int32_t /*value*/) override {}
+    void setValue(const ccstd::string & /*name*/, bool /*value*/) override {}
+    bool isOcclusionQueryEnabled() const override { return false; }
+    void resetRenderQueue(bool /*reset*/) override {}
+    bool isRenderQueueReset() const override { return false; }
+
+private:
+    MacroRecord _macros;
+    ccstd::string _constantMacros;
+    ccstd::vector<gfx::CommandBuffer *> _commandBuffers;
+    IntrusivePtr<gfx::DescriptorSetLayout> _descriptorSetLayout;
+};
+
+IShaderInfo makeShaderInfo() {
+    IShaderInfo info;
+    info.name = "test-program";
+    info.hash = 0x1234;
+    info.glsl1 = info.glsl3 = info.glsl4 = {"void main() {}", "void main() {}", {}};
+    info.defines.emplace_back();
+    info.defines.back().name = "USE_A";
+    info.defines.back().type = "boolean";
+    info.defines.emplace_back();
+    info.defines.back().name = "USE_B";
+    info.defines.back().type = "boolean";
+    return info;
+}
+
+} // namespace
+
+TEST(programLibTest, variantCache) {
+    auto *device = gfx::Device::getInstance();
+    TestPipeline pipeline;
+    ProgramLib lib;
+    auto shaderInfo = makeShaderInfo();
+    lib.define(shaderInfo);
+    const auto &name = shaderInfo.name;
+
+    const MacroRecord definesA{{"USE_A", true}};
+    auto *variantA = lib.getGFXShader(device, name, definesA, {}, &pipeline);
+    EXPECT_NE(variantA, nullptr);
+    EXPECT_EQ(lib.getGFXShader(device, name, definesA, {}, &pipeline), variantA);
+
+    // patches are looked up in place and resolve to the variant of the merged defines
+    const ccstd::vector<scene::IMacroPatch> patches{{"USE_B", true}};
+    auto *variantAB = lib.getGFXShader(device, name, definesA, patches, &pipeline);
+    EXPECT_NE(variantAB, variantA);
+    EXPECT_EQ(definesA.size(), 1U);
+    MacroRecord definesAB{{"USE_A", true}, {"USE_B", true}};
+    EXPECT_EQ(lib.getGFXShader(device, name, definesAB, &pipeline), variantAB);
+
+    // the last patch of the same name wins over the defines
+    const ccstd::vector<scene::IMacroPatch> unsetA{{"USE_A", false}, {"USE_B", true}};
+    auto *variantB = lib.getGFXShader(device, name, definesA, unsetA, &pipeline);
+    EXPECT_NE(variantB, variantA);
+    EXPECT_NE(variantB, variantAB);
+    EXPECT_EQ(lib.getVariantKey(name, {{"USE_B", true}}, {}, &pipeline), lib.getVariantKey(name, definesA, unsetA, &pipeline));
+
+    // only the variants matching the defines are destroyed
+    lib.destroyShaderByDefines({{"USE_B", true}});
+    EXPECT_EQ(lib.getGFXShader(device, name, definesA, {}, &pipeline), variantA);
+}
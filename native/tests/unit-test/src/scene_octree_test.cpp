@@ -0,0 +1,121 @@
+/****************************************************************************
+ Copyright (c) 2023 Xiamen Yaji Software Co., Ltd.
+
+ http://www.cocos.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+****************************************************************************/
+#include "cocos/core/geometry/AABB.h"
+#include "cocos/scene/Model.h"
+#include "cocos/scene/Octree.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using cc::IntrusivePtr;
+using cc::scene::Model;
+using cc::scene::Octree;
+
+constexpr float HALF_EXTENT = 0.05F;
+
+// root box [-64, 64], the deepest cells are 16 units wide
+void initOctree(Octree &octree) {
+    cc::scene::OctreeInfo info;
+    info.setEnabled(true);
+    info.setMinPos({-54.0F, -54.0F, -54.0F});
+    info.setMaxPos({64.0F, 64.0F, 64.0F});
+    info.setDepth(4);
+    octree.initialize(info);
+}
+
+IntrusivePtr<Model> createModel(float x, float y, float z) {
+    IntrusivePtr<Model> model = ccnew Model();
+    model->setWorldBounds(ccnew cc::geometry::AABB(x, y, z, HALF_EXTENT, HALF_EXTENT, HALF_EXTENT));
+    return model;
+}
+
+void moveModel(Model *model, float x, float y, float z) {
+    model->getWorldBounds()->setCenter(x, y, z);
+}
+
+} // namespace
+
+TEST(sceneOctreeTest, toggleLooseKeepsRootBox) {
+    Octree octree;
+    initOctree(octree);
+    auto model = createModel(15.9F, 8.0F, 8.0F);
+    octree.insert(model);
+    ASSERT_NE(model->getOctreeNode(), nullptr);
+
+    octree.setLooseEnabled(true);
+    EXPECT_TRUE(octree.isLooseEnabled());
+    EXPECT_NE(model->getOctreeNode(), nullptr);
+
+    // inserting near the corners only works if the rebuilt root kept its box
+    auto nearMin = createModel(-60.0F, -60.0F, -60.0F);
+    auto nearMax = createModel(60.0F, 60.0F, 60.0F);
+    octree.insert(nearMin);
+    octree.insert(nearMax);
+    EXPECT_NE(nearMin->getOctreeNode(), nullptr);
+    EXPECT_NE(nearMax->getOctreeNode(), nullptr);
+
+    octree.setLooseEnabled(false);
+    EXPECT_NE(model->getOctreeNode(), nullptr);
+    EXPECT_NE(nearMin->getOctreeNode(), nullptr);
+    EXPECT_NE(nearMax->getOctreeNode(), nullptr);
+}
+
+TEST(sceneOctreeTest, looseUpdateKeepsCellWhileContained) {
+    Octree octree;
+    initOctree(octree);
+    octree.setLooseEnabled(true);
+
+    // moved across the border of its deepest cell [0, 16] but still inside the loose cell [-8, 24]
+    auto model = createModel(15.9F, 8.0F, 8.0F);
+    auto reference = createModel(16.1F, 8.0F, 8.0F);
+    octree.insert(model);
+    octree.insert(reference);
+    const auto *node = model->getOctreeNode();
+    ASSERT_NE(node, nullptr);
+    ASSERT_NE(node, reference->getOctreeNode());
+
+    moveModel(model, 16.1F, 8.0F, 8.0F);
+    octree.update(model);
+    EXPECT_EQ(model->getOctreeNode(), node);
+
+    // leaving the loose cell reinserts the model
+    moveModel(model, 30.0F, 8.0F, 8.0F);
+    octree.update(model);
+    EXPECT_EQ(model->getOctreeNode(), reference->getOctreeNode());
+}
+
+TEST(sceneOctreeTest, tightUpdateReinserts) {
+    Octree octree;
+    initOctree(octree);
+
+    auto model = createModel(15.9F, 8.0F, 8.0F);
+    auto reference = createModel(16.1F, 8.0F, 8.0F);
+    octree.insert(model);
+    octree.insert(reference);
+    ASSERT_NE(model->getOctreeNode(), reference->getOctreeNode());
+
+    moveModel(model, 16.1F, 8.0F, 8.0F);
+    octree.update(model);
+    EXPECT_EQ(model->getOctreeNode(), reference->getOctreeNode());
+}